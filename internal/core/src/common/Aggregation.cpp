@@ -0,0 +1,237 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/Aggregation.h"
+
+#include <cmath>
+
+#include "common/EasyAssert.h"
+
+namespace milvus {
+
+std::string_view
+AggregateFunctionName(AggregateFunction function) {
+    switch (function) {
+        case AggregateFunction::kCount:
+            return "count";
+        case AggregateFunction::kCountDistinct:
+            return "count_distinct";
+        case AggregateFunction::kSum:
+            return "sum";
+        case AggregateFunction::kMin:
+            return "min";
+        case AggregateFunction::kMax:
+            return "max";
+        case AggregateFunction::kAvg:
+            return "avg";
+    }
+    return "unknown";
+}
+
+int
+CompareAggregateValues(const AggregateValue& a, const AggregateValue& b) {
+    auto is_number = [](const AggregateValue& v) {
+        return std::holds_alternative<int64_t>(v) ||
+               std::holds_alternative<double>(v);
+    };
+    if (is_number(a) && is_number(b)) {
+        if (std::holds_alternative<int64_t>(a) &&
+            std::holds_alternative<int64_t>(b)) {
+            auto x = std::get<int64_t>(a);
+            auto y = std::get<int64_t>(b);
+            return x < y ? -1 : (x > y ? 1 : 0);
+        }
+        auto as_double = [](const AggregateValue& v) {
+            return std::holds_alternative<int64_t>(v)
+                       ? static_cast<double>(std::get<int64_t>(v))
+                       : std::get<double>(v);
+        };
+        auto x = as_double(a);
+        auto y = as_double(b);
+        return x < y ? -1 : (x > y ? 1 : 0);
+    }
+    if (a.index() != b.index()) {
+        return a.index() < b.index() ? -1 : 1;
+    }
+    if (a < b) {
+        return -1;
+    }
+    return b < a ? 1 : 0;
+}
+
+AggregateValue
+NormalizeNumber(const AggregateValue& value) {
+    if (!std::holds_alternative<double>(value)) {
+        return value;
+    }
+    auto number = std::get<double>(value);
+    // the range check also rules out nan and infinities
+    if (number >= -0x1p63 && number < 0x1p63 &&
+        std::trunc(number) == number) {
+        return static_cast<int64_t>(number);
+    }
+    return value;
+}
+
+size_t
+GroupKeyHash::operator()(const GroupKey& key) const {
+    size_t hash = key.size();
+    for (auto& value : key) {
+        hash ^= std::hash<AggregateValue>()(value) + 0x9e3779b9 +
+                (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+
+void
+AggregateState::Add(AggregateFunction function, const AggregateValue& value) {
+    switch (function) {
+        case AggregateFunction::kCount:
+            break;
+        case AggregateFunction::kCountDistinct:
+            if (distinct == nullptr) {
+                distinct =
+                    std::make_unique<std::unordered_set<AggregateValue>>();
+            }
+            distinct->insert(NormalizeNumber(value));
+            break;
+        case AggregateFunction::kSum:
+        case AggregateFunction::kAvg:
+            // non-numeric values, e.g. of a JSON path, do not add up
+            if (std::holds_alternative<int64_t>(value)) {
+                int_sum += std::get<int64_t>(value);
+            } else if (std::holds_alternative<double>(value)) {
+                float_sum += std::get<double>(value);
+                has_float = true;
+            }
+            break;
+        case AggregateFunction::kMin:
+            if (std::holds_alternative<std::monostate>(min) ||
+                CompareAggregateValues(value, min) < 0) {
+                min = value;
+            }
+            break;
+        case AggregateFunction::kMax:
+            if (std::holds_alternative<std::monostate>(max) ||
+                CompareAggregateValues(value, max) > 0) {
+                max = value;
+            }
+            break;
+    }
+}
+
+void
+AggregateState::Merge(AggregateFunction function, const AggregateState& other) {
+    count += other.count;
+    int_sum += other.int_sum;
+    float_sum += other.float_sum;
+    has_float = has_float || other.has_float;
+    if (other.has_int_range) {
+        AddIntRange(other.int_min, other.int_max);
+    }
+    if (other.has_float_range) {
+        AddFloatRange(other.float_min, other.float_max);
+    }
+    if (!std::holds_alternative<std::monostate>(other.min)) {
+        Add(AggregateFunction::kMin, other.min);
+    }
+    if (!std::holds_alternative<std::monostate>(other.max)) {
+        Add(AggregateFunction::kMax, other.max);
+    }
+    if (function == AggregateFunction::kCountDistinct &&
+        other.distinct != nullptr) {
+        for (auto& value : *other.distinct) {
+            Add(function, value);
+        }
+    }
+}
+
+AggregateValue
+AggregateState::Extreme(AggregateFunction function) const {
+    bool is_min = function == AggregateFunction::kMin;
+    AggregateValue result = is_min ? min : max;
+    auto fold = [&](AggregateValue value) {
+        if (std::holds_alternative<std::monostate>(result)) {
+            result = std::move(value);
+            return;
+        }
+        auto cmp = CompareAggregateValues(value, result);
+        if (is_min ? cmp < 0 : cmp > 0) {
+            result = std::move(value);
+        }
+    };
+    if (has_int_range) {
+        fold(is_min ? int_min : int_max);
+    }
+    if (has_float_range) {
+        fold(is_min ? float_min : float_max);
+    }
+    return result;
+}
+
+AggregateValue
+AggregateState::Final(AggregateFunction function) const {
+    switch (function) {
+        case AggregateFunction::kCount:
+            return count;
+        case AggregateFunction::kCountDistinct:
+            return static_cast<int64_t>(
+                distinct == nullptr ? 0 : distinct->size());
+        case AggregateFunction::kSum:
+            if (count == 0) {
+                return {};
+            }
+            if (has_float) {
+                return static_cast<double>(int_sum) + float_sum;
+            }
+            return int_sum;
+        case AggregateFunction::kAvg:
+            if (count == 0) {
+                return {};
+            }
+            return (static_cast<double>(int_sum) + float_sum) / count;
+        case AggregateFunction::kMin:
+        case AggregateFunction::kMax:
+            return Extreme(function);
+    }
+    ThrowInfo(UnexpectedError,
+              "unknown aggregate function {}",
+              static_cast<int>(function));
+}
+
+int64_t
+AggregationResult::FindOrAddGroup(const GroupKey& key) {
+    auto [it, inserted] = groups_.try_emplace(key, keys_.size());
+    if (inserted) {
+        keys_.push_back(key);
+        states_.resize(states_.size() + functions_.size());
+    }
+    return it->second;
+}
+
+void
+AggregationResult::Merge(const AggregationResult& other) {
+    AssertInfo(functions_ == other.functions_,
+               "merge aggregation results of different aggregates");
+    for (int64_t i = 0; i < other.num_groups(); ++i) {
+        auto group = FindOrAddGroup(other.key(i));
+        for (size_t j = 0; j < functions_.size(); ++j) {
+            state(group, j).Merge(functions_[j], other.state(i, j));
+        }
+    }
+}
+
+}  // namespace milvus
@@ -0,0 +1,210 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace milvus {
+
+enum class AggregateFunction {
+    // COUNT(*) without a column, COUNT(column) counts non-null values
+    kCount,
+    kCountDistinct,
+    kSum,
+    kMin,
+    kMax,
+    kAvg,
+};
+
+std::string_view
+AggregateFunctionName(AggregateFunction function);
+
+// null, bool, integer, floating point or string value of a group key column
+// or an aggregated column
+using AggregateValue =
+    std::variant<std::monostate, bool, int64_t, double, std::string>;
+
+using GroupKey = std::vector<AggregateValue>;
+
+// Numbers compare by value across int64_t and double, other values compare
+// by type first. Returns <0, 0 or >0.
+int
+CompareAggregateValues(const AggregateValue& a, const AggregateValue& b);
+
+// Integral doubles within the range of int64_t as int64_t, other values as
+// is, so that values comparing equal by CompareAggregateValues hash alike.
+AggregateValue
+NormalizeNumber(const AggregateValue& value);
+
+struct GroupKeyHash {
+    size_t
+    operator()(const GroupKey& key) const;
+};
+
+// Partial state of one aggregate over the rows of one group, mergeable with
+// the state of the same aggregate over other rows.
+struct AggregateState {
+    // non-null values added, or rows for COUNT(*)
+    int64_t count = 0;
+    int64_t int_sum = 0;
+    double float_sum = 0;
+    bool has_float = false;
+    // MIN and MAX of the values added by AddInt and AddFloat, unboxed until
+    // Final folds them into min and max
+    bool has_int_range = false;
+    int64_t int_min = 0;
+    int64_t int_max = 0;
+    bool has_float_range = false;
+    double float_min = 0;
+    double float_max = 0;
+    AggregateValue min;
+    AggregateValue max;
+    // only allocated for COUNT DISTINCT, numbers are kept normalized by
+    // NormalizeNumber so that 5 and 5.0 count once
+    std::unique_ptr<std::unordered_set<AggregateValue>> distinct;
+
+    void
+    AddInt(AggregateFunction function, int64_t value) {
+        ++count;
+        switch (function) {
+            case AggregateFunction::kSum:
+            case AggregateFunction::kAvg:
+                int_sum += value;
+                break;
+            case AggregateFunction::kMin:
+            case AggregateFunction::kMax:
+                AddIntRange(value, value);
+                break;
+            case AggregateFunction::kCountDistinct:
+                Add(function, AggregateValue(value));
+                break;
+            case AggregateFunction::kCount:
+                break;
+        }
+    }
+
+    void
+    AddFloat(AggregateFunction function, double value) {
+        ++count;
+        switch (function) {
+            case AggregateFunction::kSum:
+            case AggregateFunction::kAvg:
+                float_sum += value;
+                has_float = true;
+                break;
+            case AggregateFunction::kMin:
+            case AggregateFunction::kMax:
+                AddFloatRange(value, value);
+                break;
+            case AggregateFunction::kCountDistinct:
+                Add(function, AggregateValue(value));
+                break;
+            case AggregateFunction::kCount:
+                break;
+        }
+    }
+
+    // adds a non-null value, without counting it for AddInt and AddFloat
+    void
+    Add(AggregateFunction function, const AggregateValue& value);
+
+    void
+    Merge(AggregateFunction function, const AggregateState& other);
+
+    // the aggregate of the rows added or merged, null for SUM, AVG, MIN and
+    // MAX without any value
+    AggregateValue
+    Final(AggregateFunction function) const;
+
+ private:
+    void
+    AddIntRange(int64_t lo, int64_t hi) {
+        int_min = has_int_range ? std::min(int_min, lo) : lo;
+        int_max = has_int_range ? std::max(int_max, hi) : hi;
+        has_int_range = true;
+    }
+
+    void
+    AddFloatRange(double lo, double hi) {
+        float_min = has_float_range ? std::min(float_min, lo) : lo;
+        float_max = has_float_range ? std::max(float_max, hi) : hi;
+        has_float_range = true;
+    }
+
+    // min or max together with the unboxed ranges
+    AggregateValue
+    Extreme(AggregateFunction function) const;
+};
+
+// Partial aggregates of some rows per group key. Results of several segments
+// are merged into the aggregates of all of their rows.
+class AggregationResult {
+ public:
+    explicit AggregationResult(std::vector<AggregateFunction> functions)
+        : functions_(std::move(functions)) {
+    }
+
+    // index of the group of key, a new group starts with empty states
+    int64_t
+    FindOrAddGroup(const GroupKey& key);
+
+    int64_t
+    num_groups() const {
+        return keys_.size();
+    }
+
+    const GroupKey&
+    key(int64_t group) const {
+        return keys_[group];
+    }
+
+    const std::vector<AggregateFunction>&
+    functions() const {
+        return functions_;
+    }
+
+    AggregateState&
+    state(int64_t group, size_t aggregate) {
+        return states_[group * functions_.size() + aggregate];
+    }
+
+    const AggregateState&
+    state(int64_t group, size_t aggregate) const {
+        return states_[group * functions_.size() + aggregate];
+    }
+
+    void
+    Merge(const AggregationResult& other);
+
+ private:
+    std::vector<AggregateFunction> functions_;
+    std::vector<GroupKey> keys_;
+    // states of group i are [i * functions_.size(), (i + 1) * ...)
+    std::vector<AggregateState> states_;
+    std::unordered_map<GroupKey, int64_t, GroupKeyHash> groups_;
+};
+
+}  // namespace milvus
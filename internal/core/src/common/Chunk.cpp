@@ -44,7 +44,7 @@ StringChunk::StringViews(
     ret.reserve(len);
     auto end_offset = start_offset + len;
     for (auto i = start_offset; i < end_offset; i++) {
-        ret.emplace_back(data_ + offsets_[i], offsets_[i + 1] - offsets_[i]);
+        ret.emplace_back(RowValue(i));
     }
     if (nullable_) {
         FixedVector<bool> res_valid(valid_.begin() + start_offset,
@@ -62,11 +62,114 @@ StringChunk::ViewsByOffsets(const FixedVector<int32_t>& offsets) {
     ret.reserve(size);
     valid_res.reserve(size);
     for (auto i = 0; i < size; ++i) {
-        ret.emplace_back(data_ + offsets_[offsets[i]],
-                         offsets_[offsets[i] + 1] - offsets_[offsets[i]]);
+        ret.emplace_back(RowValue(offsets[i]));
         valid_res.emplace_back(isValid(offsets[i]));
     }
     return {ret, valid_res};
 }
 
+namespace {
+
+// whether the bits of bitmap equal to is_set form a single run, starting at
+// first, of count bits
+bool
+IsSingleRun(const TargetBitmap& bitmap,
+            bool is_set,
+            int64_t first,
+            int64_t count) {
+    auto next = bitmap.find_next(first, !is_set);
+    return !next.has_value() || next.value() == first + count;
+}
+
+template <typename CodeType>
+void
+MatchCodesImpl(const TargetBitmap& matched,
+               const CodeType* codes,
+               int64_t len,
+               TargetBitmapView res) {
+    auto dict_size = static_cast<int64_t>(matched.size());
+    auto num_matched = static_cast<int64_t>(matched.count());
+    if (num_matched == 0) {
+        res.reset();
+        return;
+    }
+    if (num_matched == dict_size) {
+        res.set();
+        return;
+    }
+
+    // a sorted dictionary keeps the entries matched by an equality, a range
+    // or a prefix in a single run, and those not matched by an inequality,
+    // which the codes are compared against with the simd kernels
+    auto first = static_cast<int64_t>(matched.find_first().value());
+    if (IsSingleRun(matched, true, first, num_matched)) {
+        auto lower = static_cast<CodeType>(first);
+        auto upper = static_cast<CodeType>(first + num_matched - 1);
+        if (lower == upper) {
+            res.inplace_compare_val<CodeType,
+                                    milvus::bitset::CompareOpType::EQ>(
+                codes, len, lower);
+        } else {
+            res.inplace_within_range_val<CodeType,
+                                         milvus::bitset::RangeType::IncInc>(
+                lower, upper, codes, len);
+        }
+        return;
+    }
+    auto first_unmatched =
+        static_cast<int64_t>(matched.find_first(false).value());
+    auto num_unmatched = dict_size - num_matched;
+    if (IsSingleRun(matched, false, first_unmatched, num_unmatched)) {
+        auto lower = static_cast<CodeType>(first_unmatched);
+        auto upper =
+            static_cast<CodeType>(first_unmatched + num_unmatched - 1);
+        if (lower == upper) {
+            res.inplace_compare_val<CodeType,
+                                    milvus::bitset::CompareOpType::NE>(
+                codes, len, lower);
+        } else {
+            res.inplace_within_range_val<CodeType,
+                                         milvus::bitset::RangeType::IncInc>(
+                lower, upper, codes, len);
+            res.flip();
+        }
+        return;
+    }
+
+    for (int64_t i = 0; i < len; ++i) {
+        res[i] = matched[codes[i]];
+    }
+}
+
+}  // namespace
+
+void
+StringChunk::MatchCodes(const TargetBitmap& matched,
+                        int64_t start,
+                        int64_t len,
+                        TargetBitmapView res) const {
+    AssertInfo(dictionary_encoded_,
+               "match codes on a string chunk not dictionary encoded");
+    AssertInfo(matched.size() == dictionary_size_,
+               "matched size {} not equal to dictionary size {}",
+               matched.size(),
+               dictionary_size_);
+    AssertInfo(start >= 0 && len >= 0 && start + len <= row_nums_,
+               "match codes with out-of-bound offset:{}, len:{}",
+               start,
+               len);
+    auto batch_res = res.view(0, len);
+    if (dictionary_size_ <= MAX_INT8_DICTIONARY_SIZE) {
+        MatchCodesImpl(matched,
+                       reinterpret_cast<const int8_t*>(codes_) + start,
+                       len,
+                       batch_res);
+    } else {
+        MatchCodesImpl(matched,
+                       reinterpret_cast<const int16_t*>(codes_) + start,
+                       len,
+                       batch_res);
+    }
+}
+
 }  // namespace milvus
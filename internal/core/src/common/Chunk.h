@@ -15,6 +15,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -101,6 +102,12 @@ class Chunk {
         return true;
     };
 
+    // validity of each row, nullptr when not nullable
+    const bool*
+    ValidData() const {
+        return nullable_ ? valid_.data() : nullptr;
+    }
+
  protected:
     char* data_;
     int64_t row_nums_;
@@ -173,18 +180,55 @@ class FixedWidthChunk : public Chunk {
 //
 // In this example, 'exampleChunk' is a StringChunk with 3 rows, a pointer to the data stored in 'dataPointer',
 // a total data size of 'dataSize', and it does not support nullability.
+//
+// A chunk of few distinct strings may instead be dictionary encoded. The distinct strings are stored once,
+// sorted, and each row holds the code of its string, that is the rank of the string in the dictionary:
+//
+// [null_bitmap][dict_size][dict_offsets][dict_data][alignment][codes]
+// [00000000] [2, 16, 21, 27]  ["apple", "banana"] [..] [1, 0, 1]
+//
+// for the rows "banana", "apple" and "banana". Codes are int8 for up to 128 distinct strings and int16
+// beyond, so that they can be compared with the bitset kernels, and start at an 8-byte aligned offset.
 
 class StringChunk : public Chunk {
  public:
+    // codes of dictionaries up to this size fit in int8
+    static constexpr int64_t MAX_INT8_DICTIONARY_SIZE = 128;
+    static constexpr int64_t MAX_DICTIONARY_SIZE = 32768;
+
     StringChunk() = default;
     StringChunk(int32_t row_nums,
                 char* data,
                 uint64_t size,
                 bool nullable,
-                std::unique_ptr<MmapFileRAII> mmap_file_raii = nullptr)
-        : Chunk(row_nums, data, size, nullable, std::move(mmap_file_raii)) {
+                std::unique_ptr<MmapFileRAII> mmap_file_raii = nullptr,
+                bool dictionary_encoded = false)
+        : Chunk(row_nums, data, size, nullable, std::move(mmap_file_raii)),
+          dictionary_encoded_(dictionary_encoded) {
         auto null_bitmap_bytes_num = nullable_ ? (row_nums_ + 7) / 8 : 0;
-        offsets_ = reinterpret_cast<uint32_t*>(data + null_bitmap_bytes_num);
+        if (!dictionary_encoded_) {
+            offsets_ =
+                reinterpret_cast<uint32_t*>(data + null_bitmap_bytes_num);
+            return;
+        }
+        dictionary_size_ =
+            *reinterpret_cast<uint32_t*>(data + null_bitmap_bytes_num);
+        offsets_ = reinterpret_cast<uint32_t*>(data + null_bitmap_bytes_num +
+                                               sizeof(uint32_t));
+        codes_ = data + DictionaryCodesStart(offsets_[dictionary_size_]);
+    }
+
+    // size in bytes of the code of each row of a dictionary of dict_size
+    static int64_t
+    DictionaryCodeWidth(int64_t dict_size) {
+        return dict_size <= MAX_INT8_DICTIONARY_SIZE ? sizeof(int8_t)
+                                                     : sizeof(int16_t);
+    }
+
+    // offset of the codes, given the end offset of the dictionary data
+    static uint64_t
+    DictionaryCodesStart(uint64_t dict_end) {
+        return (dict_end + 7) & ~uint64_t(7);
     }
 
     std::string_view
@@ -196,9 +240,41 @@ class StringChunk : public Chunk {
                       row_nums_);
         }
 
-        return {data_ + offsets_[i], offsets_[i + 1] - offsets_[i]};
+        return RowValue(i);
+    }
+
+    bool
+    IsDictionaryEncoded() const {
+        return dictionary_encoded_;
     }
 
+    int64_t
+    DictionarySize() const {
+        return dictionary_size_;
+    }
+
+    // the string of code, in ascending order of code
+    std::string_view
+    DictionaryValue(int64_t code) const {
+        return Entry(code);
+    }
+
+    int64_t
+    Code(int64_t i) const {
+        if (dictionary_size_ <= MAX_INT8_DICTIONARY_SIZE) {
+            return reinterpret_cast<const int8_t*>(codes_)[i];
+        }
+        return reinterpret_cast<const int16_t*>(codes_)[i];
+    }
+
+    // Sets res[i] to whether the code of row start + i is set in matched,
+    // matched holding a bit per dictionary entry. Null rows are not masked.
+    void
+    MatchCodes(const TargetBitmap& matched,
+               int64_t start,
+               int64_t len,
+               TargetBitmapView res) const;
+
     std::pair<std::vector<std::string_view>, FixedVector<bool>>
     StringViews(std::optional<std::pair<int64_t, int64_t>> offset_len);
 
@@ -270,16 +346,79 @@ class StringChunk : public Chunk {
         return (*this)[idx].data();
     }
 
+    // offsets of the dictionary entries when dictionary encoded
     uint32_t*
     Offsets() {
         return offsets_;
     }
 
  protected:
+    std::string_view
+    Entry(int64_t idx) const {
+        return {data_ + offsets_[idx], offsets_[idx + 1] - offsets_[idx]};
+    }
+
+    std::string_view
+    RowValue(int64_t i) const {
+        return Entry(dictionary_encoded_ ? Code(i) : i);
+    }
+
     uint32_t* offsets_;
+    bool dictionary_encoded_ = false;
+    int64_t dictionary_size_ = 0;
+    const char* codes_ = nullptr;
+};
+
+// A JSONChunk is a StringChunk of json texts, each followed by at least
+// SIMDJSON_PADDING bytes. It may also hold the key index of every row, built
+// by JsonKeyIndex::Build, after the padding of the last text:
+//
+// [null_bitmap][offsets][json_data][padding][alignment][key_index_offsets][key_indexes]
+//
+// where the key index of row i spans [key_index_offsets[i], key_index_offsets[i + 1]),
+// empty for rows without one, such as null rows and rows that are not objects.
+class JSONChunk : public StringChunk {
+ public:
+    JSONChunk() = default;
+    JSONChunk(int32_t row_nums,
+              char* data,
+              uint64_t size,
+              bool nullable,
+              std::unique_ptr<MmapFileRAII> mmap_file_raii = nullptr,
+              bool has_key_index = false)
+        : StringChunk(
+              row_nums, data, size, nullable, std::move(mmap_file_raii)) {
+        if (has_key_index) {
+            key_index_offsets_ = reinterpret_cast<const uint32_t*>(
+                data_ + KeyIndexStart(offsets_[row_nums_]));
+        }
+    }
+
+    // offset of the key index offsets, given the end offset of the json data
+    static uint64_t
+    KeyIndexStart(uint64_t json_end) {
+        return (json_end + simdjson::SIMDJSON_PADDING + 3) & ~uint64_t(3);
+    }
+
+    bool
+    HasKeyIndex() const {
+        return key_index_offsets_ != nullptr;
+    }
+
+    // key index of row i, empty if the chunk or the row has none
+    JsonKeyIndex
+    KeyIndex(int64_t i) const {
+        if (key_index_offsets_ == nullptr ||
+            key_index_offsets_[i] == key_index_offsets_[i + 1]) {
+            return JsonKeyIndex();
+        }
+        return JsonKeyIndex(data_ + key_index_offsets_[i]);
+    }
+
+ private:
+    const uint32_t* key_index_offsets_ = nullptr;
 };
 
-using JSONChunk = StringChunk;
 using GeometryChunk = StringChunk;
 
 // An ArrayChunk is a class that represents a collection of arrays stored in a contiguous memory block.
@@ -518,6 +657,15 @@ class VectorArrayChunk : public Chunk {
     std::vector<size_t> offsets_;
 };
 
+// A SparseFloatVectorChunk is laid out by SparseFloatVectorChunkWriter as
+//
+// [null_bitmap][dim][offsets][rows]
+//
+// dim is the uint64 dim of the widest row, offsets are the row_nums + 1
+// uint64 offsets of the rows from the start of the chunk, and each row is
+// its sorted (index, value) elements. Rows are read in place through the
+// offsets; the knowhere::sparse::SparseRow views knowhere takes are only
+// created, for the whole chunk, the first time Data or ValueAt is called.
 class SparseFloatVectorChunk : public Chunk {
  public:
     SparseFloatVectorChunk(
@@ -527,44 +675,60 @@ class SparseFloatVectorChunk : public Chunk {
         bool nullable,
         std::unique_ptr<MmapFileRAII> mmap_file_raii = nullptr)
         : Chunk(row_nums, data, size, nullable, std::move(mmap_file_raii)) {
-        vec_.resize(row_nums);
         auto null_bitmap_bytes_num = (row_nums + 7) / 8;
-        auto offsets_ptr =
-            reinterpret_cast<uint64_t*>(data + null_bitmap_bytes_num);
-        for (int i = 0; i < row_nums; i++) {
-            vec_[i] = {(offsets_ptr[i + 1] - offsets_ptr[i]) /
-                           knowhere::sparse::SparseRow<
-                               SparseValueType>::element_size(),
-                       reinterpret_cast<uint8_t*>(data + offsets_ptr[i]),
-                       false};
-            dim_ = std::max(dim_, vec_[i].dim());
-        }
+        auto header =
+            reinterpret_cast<const uint64_t*>(data + null_bitmap_bytes_num);
+        dim_ = header[0];
+        offsets_ = header + 1;
     }
 
     const char*
     Data() const override {
-        return static_cast<const char*>(static_cast<const void*>(vec_.data()));
+        return static_cast<const char*>(static_cast<const void*>(Rows()));
     }
 
     const char*
     ValueAt(int64_t i) const override {
-        return static_cast<const char*>(
-            static_cast<const void*>(vec_.data() + i));
+        return static_cast<const char*>(static_cast<const void*>(Rows() + i));
     }
 
-    // only for test
-    std::vector<knowhere::sparse::SparseRow<SparseValueType>>&
-    Vec() {
-        return vec_;
+    // view of row i on the chunk, without creating the views of all rows
+    knowhere::sparse::SparseRow<SparseValueType>
+    Row(int64_t i) const {
+        return {NumElements(i), RowData(i), false};
     }
 
     int64_t
-    Dim() {
+    Dim() const {
         return dim_;
     }
 
  private:
+    const knowhere::sparse::SparseRow<SparseValueType>*
+    Rows() const {
+        std::call_once(rows_once_, [this] {
+            rows_.reserve(row_nums_);
+            for (int64_t i = 0; i < row_nums_; i++) {
+                rows_.emplace_back(NumElements(i), RowData(i), false);
+            }
+        });
+        return rows_.data();
+    }
+
+    size_t
+    NumElements(int64_t i) const {
+        return (offsets_[i + 1] - offsets_[i]) /
+               knowhere::sparse::SparseRow<SparseValueType>::element_size();
+    }
+
+    uint8_t*
+    RowData(int64_t i) const {
+        return reinterpret_cast<uint8_t*>(data_ + offsets_[i]);
+    }
+
     int64_t dim_ = 0;
-    std::vector<knowhere::sparse::SparseRow<SparseValueType>> vec_;
+    const uint64_t* offsets_ = nullptr;
+    mutable std::once_flag rows_once_;
+    mutable std::vector<knowhere::sparse::SparseRow<SparseValueType>> rows_;
 };
 }  // namespace milvus
\ No newline at end of file
@@ -9,9 +9,11 @@
 // is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
+#include <algorithm>
 #include <fcntl.h>
 #include <gtest/gtest.h>
 #include <arrow/buffer.h>
+#include <arrow/builder.h>
 #include <arrow/io/memory.h>
 #include <parquet/arrow/reader.h>
 #include <unistd.h>
@@ -23,6 +25,7 @@
 #include "boost/filesystem/path.hpp"
 #include "common/Chunk.h"
 #include "common/ChunkWriter.h"
+#include "common/Common.h"
 #include "common/EasyAssert.h"
 #include "common/FieldDataInterface.h"
 #include "common/FieldMeta.h"
@@ -208,6 +211,88 @@ TEST(chunk, test_variable_field_nullable) {
     }
 }
 
+class ScopedStringDictionaryMaxCardinality {
+ public:
+    explicit ScopedStringDictionaryMaxCardinality(int64_t max_cardinality)
+        : saved_(STRING_DICTIONARY_MAX_CARDINALITY.load()) {
+        STRING_DICTIONARY_MAX_CARDINALITY.store(max_cardinality);
+    }
+
+    ~ScopedStringDictionaryMaxCardinality() {
+        STRING_DICTIONARY_MAX_CARDINALITY.store(saved_);
+    }
+
+ private:
+    int64_t saved_;
+};
+
+TEST(chunk, test_variable_field_dictionary) {
+    // dictionary encoding is off by default
+    ScopedStringDictionaryMaxCardinality max_cardinality(1024);
+    std::vector<std::string> values = {"pear", "apple", "fig", "cherry"};
+    arrow::StringBuilder builder;
+    std::vector<std::string> data;
+    for (int i = 0; i < 1000; ++i) {
+        data.push_back(values[(i * 3) % values.size()]);
+        EXPECT_TRUE(builder.Append(data.back()).ok());
+    }
+    std::shared_ptr<arrow::Array> array;
+    EXPECT_TRUE(builder.Finish(&array).ok());
+
+    FieldMeta field_meta(FieldName("a"),
+                         milvus::FieldId(1),
+                         DataType::STRING,
+                         false,
+                         std::nullopt);
+    auto chunk = create_chunk(field_meta, {array});
+    auto string_chunk = static_cast<StringChunk*>(chunk.get());
+    ASSERT_TRUE(string_chunk->IsDictionaryEncoded());
+    ASSERT_EQ(string_chunk->DictionarySize(), values.size());
+    std::sort(values.begin(), values.end());
+    for (size_t code = 0; code < values.size(); ++code) {
+        EXPECT_EQ(string_chunk->DictionaryValue(code), values[code]);
+    }
+    auto views = string_chunk->StringViews(std::nullopt);
+    for (size_t i = 0; i < data.size(); ++i) {
+        EXPECT_EQ(views.first[i], data[i]);
+        EXPECT_EQ((*string_chunk)[i], data[i]);
+        EXPECT_EQ(values[string_chunk->Code(i)], data[i]);
+    }
+
+    // a run of matched entries and a scattered set of them
+    for (auto matched_values :
+         {std::vector<std::string>{"cherry", "fig"},
+          std::vector<std::string>{"apple", "fig"}}) {
+        TargetBitmap matched(values.size());
+        for (size_t code = 0; code < values.size(); ++code) {
+            matched[code] =
+                std::find(matched_values.begin(),
+                          matched_values.end(),
+                          values[code]) != matched_values.end();
+        }
+        TargetBitmap res(data.size() - 10);
+        string_chunk->MatchCodes(matched, 10, res.size(), res);
+        for (size_t i = 0; i < res.size(); ++i) {
+            EXPECT_EQ(res[i],
+                      std::find(matched_values.begin(),
+                                matched_values.end(),
+                                data[i + 10]) != matched_values.end());
+        }
+    }
+
+    // disabled by the knob
+    {
+        ScopedStringDictionaryMaxCardinality disabled(0);
+        chunk = create_chunk(field_meta, {array});
+    }
+    string_chunk = static_cast<StringChunk*>(chunk.get());
+    ASSERT_FALSE(string_chunk->IsDictionaryEncoded());
+    views = string_chunk->StringViews(std::nullopt);
+    for (size_t i = 0; i < data.size(); ++i) {
+        EXPECT_EQ(views.first[i], data[i]);
+    }
+}
+
 TEST(chunk, test_json_field) {
     auto row_num = 100;
     FixedVector<Json> data;
@@ -328,6 +413,85 @@ TEST(chunk, test_json_field) {
     }
 }
 
+TEST(chunk, test_json_field_key_index) {
+    std::vector<std::string> data = {
+        R"({"a": 1, "b": {"c": "x", "d": 2.5}, "e": true})",
+        R"({"a": 2.5, "b": [1, {"c": "y"}], "f/g": null})",
+        R"({"a": "3", "a": 4, "b": {}})",
+        R"([1, 2])",
+        R"(7)",
+        R"({})",
+    };
+    std::vector<std::string> pointers = {
+        "/a", "/b", "/b/c", "/b/d", "/b/1/c", "/e", "/f~1g", "/x", ""};
+    arrow::BinaryBuilder builder;
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_TRUE(builder.Append(data[i % data.size()]).ok());
+    }
+    std::shared_ptr<arrow::Array> array;
+    EXPECT_TRUE(builder.Finish(&array).ok());
+
+    FieldMeta field_meta(FieldName("a"),
+                         milvus::FieldId(1),
+                         DataType::JSON,
+                         false,
+                         std::nullopt);
+    auto enabled = JSON_CHUNK_KEY_INDEX_ENABLED.load();
+    JSON_CHUNK_KEY_INDEX_ENABLED.store(true);
+    auto chunk = create_chunk(field_meta, {array});
+    JSON_CHUNK_KEY_INDEX_ENABLED.store(enabled);
+    auto json_chunk = static_cast<JSONChunk*>(chunk.get());
+    ASSERT_TRUE(json_chunk->HasKeyIndex());
+
+    // the key index gives the same results as parsing the json
+    auto views = json_chunk->StringViews(std::nullopt).first;
+    ASSERT_EQ(views.size(), 100);
+    for (size_t i = 0; i < views.size(); ++i) {
+        const auto& json_str = data[i % data.size()];
+        EXPECT_EQ(views[i], json_str);
+        auto key_index = json_chunk->KeyIndex(i);
+        EXPECT_EQ(key_index.empty(), json_str[0] != '{');
+        Json indexed(views[i], key_index);
+        Json parsed(views[i].data(), views[i].size());
+        for (const auto& pointer : pointers) {
+            auto check = [&](auto tag) {
+                using T = decltype(tag);
+                // copied out, the parser of the next lookup may reuse the
+                // buffer a string value points into
+                using V =
+                    std::conditional_t<std::is_same_v<T, std::string_view>,
+                                       std::string,
+                                       T>;
+                auto expected = parsed.at<T>(pointer);
+                auto expected_error = expected.error();
+                V expected_value{};
+                if (expected_error == simdjson::SUCCESS) {
+                    expected_value = V(expected.value());
+                }
+                auto actual = indexed.at<T>(pointer);
+                ASSERT_EQ(actual.error(), expected_error)
+                    << json_str << " " << pointer;
+                if (expected_error == simdjson::SUCCESS) {
+                    EXPECT_EQ(V(actual.value()), expected_value)
+                        << json_str << " " << pointer;
+                }
+            };
+            check(bool{});
+            check(int64_t{});
+            check(double{});
+            check(std::string_view{});
+        }
+    }
+
+    // disabled by the knob
+    JSON_CHUNK_KEY_INDEX_ENABLED.store(false);
+    chunk = create_chunk(field_meta, {array});
+    JSON_CHUNK_KEY_INDEX_ENABLED.store(enabled);
+    json_chunk = static_cast<JSONChunk*>(chunk.get());
+    ASSERT_FALSE(json_chunk->HasKeyIndex());
+    ASSERT_TRUE(json_chunk->KeyIndex(0).empty());
+}
+
 TEST(chunk, test_null_int64) {
     FixedVector<int64_t> data = {1, 2, 3, 4, 5};
     auto field_data = milvus::storage::CreateFieldData(
@@ -650,14 +814,27 @@ TEST(chunk, test_sparse_float) {
     arrow::ArrayVector array_vec = read_single_column_batches(rb_reader);
     auto chunk = create_chunk(field_meta, array_vec);
     auto vec_chunk = static_cast<SparseFloatVectorChunk*>(chunk.get());
-    auto vec = vec_chunk->Vec();
+    int64_t dim = 0;
     for (size_t i = 0; i < n_rows; ++i) {
-        auto v1 = vec[i];
-        auto v2 = vecs[i];
+        auto v1 = vec_chunk->Row(i);
+        auto& v2 = vecs[i];
         EXPECT_EQ(v1.size(), v2.size());
         for (size_t j = 0; j < v1.size(); ++j) {
+            EXPECT_EQ(v1[j].id, v2[j].id);
             EXPECT_EQ(v1[j].val, v2[j].val);
         }
+        dim = std::max(dim, v2.dim());
+    }
+    EXPECT_EQ(vec_chunk->Dim(), dim);
+
+    // the views knowhere takes point to the same rows
+    auto rows = reinterpret_cast<
+        const knowhere::sparse::SparseRow<SparseValueType>*>(vec_chunk->Data());
+    for (size_t i = 0; i < n_rows; ++i) {
+        EXPECT_EQ(rows[i].data(), vec_chunk->Row(i).data());
+        EXPECT_EQ(rows[i].size(), vecs[i].size());
+        EXPECT_EQ(vec_chunk->ValueAt(i),
+                  reinterpret_cast<const char*>(rows + i));
     }
 }
 
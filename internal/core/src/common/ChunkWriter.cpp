@@ -10,8 +10,10 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
 #include "common/ChunkWriter.h"
+#include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <numeric>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
@@ -21,9 +23,11 @@
 #include "arrow/record_batch.h"
 #include "arrow/type_fwd.h"
 #include "common/Chunk.h"
+#include "common/Common.h"
 #include "common/EasyAssert.h"
 #include "common/FieldDataInterface.h"
 #include "common/Geometry.h"
+#include "common/JsonKeyIndex.h"
 #include "common/Types.h"
 #include "common/VectorTrait.h"
 #include "simdjson/common_defs.h"
@@ -56,6 +60,10 @@ StringChunkWriter::write(const arrow::ArrayVector& array_vec) {
         row_nums_ += array->length();
     }
 
+    if (write_dictionary(strs, null_bitmaps)) {
+        return;
+    }
+
     size += sizeof(uint32_t) * (row_nums_ + 1) + MMAP_STRING_PADDING;
     if (!file_path_.empty()) {
         target_ = std::make_shared<MmapChunkTarget>(file_path_);
@@ -84,6 +92,109 @@ StringChunkWriter::write(const arrow::ArrayVector& array_vec) {
     }
 }
 
+template <typename CodeType>
+static void
+write_codes(ChunkTarget& target, const std::vector<int32_t>& codes) {
+    std::vector<CodeType> typed_codes(codes.begin(), codes.end());
+    target.write(typed_codes.data(), typed_codes.size() * sizeof(CodeType));
+}
+
+bool
+StringChunkWriter::write_dictionary(
+    const std::vector<std::string_view>& strs,
+    const std::vector<std::tuple<const uint8_t*, int64_t, int64_t>>&
+        null_bitmaps) {
+    auto max_cardinality = std::min(STRING_DICTIONARY_MAX_CARDINALITY.load(),
+                                    StringChunk::MAX_DICTIONARY_SIZE);
+    if (max_cardinality <= 0 || strs.empty()) {
+        return false;
+    }
+
+    // ids in order of first occurrence, given up as soon as there are too
+    // many distinct strings
+    std::unordered_map<std::string_view, int32_t> ids;
+    std::vector<int32_t> codes;
+    codes.reserve(strs.size());
+    int64_t raw_data_size = 0;
+    for (auto str : strs) {
+        auto [it, inserted] = ids.emplace(str, ids.size());
+        if (inserted && static_cast<int64_t>(ids.size()) > max_cardinality) {
+            return false;
+        }
+        codes.push_back(it->second);
+        raw_data_size += str.size();
+    }
+
+    // codes are the ranks of the strings in the sorted dictionary
+    std::vector<std::string_view> dictionary(ids.size());
+    for (const auto& [str, id] : ids) {
+        dictionary[id] = str;
+    }
+    std::vector<int32_t> order(dictionary.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int32_t lhs, int32_t rhs) {
+        return dictionary[lhs] < dictionary[rhs];
+    });
+    std::vector<int32_t> ranks(dictionary.size());
+    for (size_t rank = 0; rank < order.size(); ++rank) {
+        ranks[order[rank]] = rank;
+    }
+    for (auto& code : codes) {
+        code = ranks[code];
+    }
+
+    auto dict_size = static_cast<int64_t>(dictionary.size());
+    int64_t null_bitmap_size = nullable_ ? (row_nums_ + 7) / 8 : 0;
+    int64_t dict_data_size = 0;
+    for (auto str : dictionary) {
+        dict_data_size += str.size();
+    }
+    uint64_t dict_end = null_bitmap_size + sizeof(uint32_t) +
+                        sizeof(uint32_t) * (dict_size + 1) + dict_data_size;
+    auto codes_start = StringChunk::DictionaryCodesStart(dict_end);
+    auto code_width = StringChunk::DictionaryCodeWidth(dict_size);
+    int64_t size = codes_start + code_width * row_nums_ + MMAP_STRING_PADDING;
+    int64_t raw_size = null_bitmap_size + sizeof(uint32_t) * (row_nums_ + 1) +
+                       raw_data_size + MMAP_STRING_PADDING;
+    if (size >= raw_size) {
+        return false;
+    }
+
+    if (!file_path_.empty()) {
+        target_ = std::make_shared<MmapChunkTarget>(file_path_);
+    } else {
+        target_ = std::make_shared<MemChunkTarget>(size);
+    }
+
+    // chunk layout: null bitmap, dictionary size, dictionary offsets,
+    // dictionary strings, alignment, codes, padding
+    write_null_bit_maps(null_bitmaps);
+    uint32_t dict_size_value = dict_size;
+    target_->write(&dict_size_value, sizeof(uint32_t));
+    uint32_t offset_start_pos =
+        target_->tell() + sizeof(uint32_t) * (dict_size + 1);
+    std::vector<uint32_t> offsets;
+    offsets.reserve(dict_size + 1);
+    for (auto idx : order) {
+        offsets.push_back(offset_start_pos);
+        offset_start_pos += dictionary[idx].size();
+    }
+    offsets.push_back(offset_start_pos);
+    target_->write(offsets.data(), offsets.size() * sizeof(uint32_t));
+    for (auto idx : order) {
+        target_->write(dictionary[idx].data(), dictionary[idx].size());
+    }
+    char alignment[8] = {0};
+    target_->write(alignment, codes_start - dict_end);
+    if (code_width == sizeof(int8_t)) {
+        write_codes<int8_t>(*target_, codes);
+    } else {
+        write_codes<int16_t>(*target_, codes);
+    }
+    dictionary_encoded_ = true;
+    return true;
+}
+
 std::unique_ptr<Chunk>
 StringChunkWriter::finish() {
     // write padding, maybe not needed anymore
@@ -94,13 +205,17 @@ StringChunkWriter::finish() {
     auto mmap_file_raii = file_path_.empty()
                               ? nullptr
                               : std::make_unique<MmapFileRAII>(file_path_);
-    return std::make_unique<StringChunk>(
-        row_nums_, data, size, nullable_, std::move(mmap_file_raii));
+    return std::make_unique<StringChunk>(row_nums_,
+                                         data,
+                                         size,
+                                         nullable_,
+                                         std::move(mmap_file_raii),
+                                         dictionary_encoded_);
 }
 
 void
 JSONChunkWriter::write(const arrow::ArrayVector& array_vec) {
-    auto size = 0;
+    int64_t size = 0;
     std::vector<Json> jsons;
     // tuple <data, size, offset>
     std::vector<std::tuple<const uint8_t*, int64_t, int64_t>> null_bitmaps;
@@ -122,6 +237,17 @@ JSONChunkWriter::write(const arrow::ArrayVector& array_vec) {
         row_nums_ += array->length();
     }
     size += sizeof(uint32_t) * (row_nums_ + 1) + simdjson::SIMDJSON_PADDING;
+
+    has_key_index_ = JSON_CHUNK_KEY_INDEX_ENABLED.load();
+    if (has_key_index_) {
+        // at most 3 bytes of alignment, key index offsets, key indexes
+        size += 3 + sizeof(uint32_t) * (row_nums_ + 1);
+        key_indexes_.reserve(row_nums_);
+        for (const auto& json : jsons) {
+            key_indexes_.push_back(JsonKeyIndex::Build(json.data()));
+            size += key_indexes_.back().size();
+        }
+    }
     if (!file_path_.empty()) {
         target_ = std::make_shared<MmapChunkTarget>(file_path_);
     } else {
@@ -141,6 +267,7 @@ JSONChunkWriter::write(const arrow::ArrayVector& array_vec) {
         offset_start_pos += json.data().size();
     }
     offsets.push_back(offset_start_pos);
+    json_end_ = offset_start_pos;
 
     target_->write(offsets.data(), offset_num * sizeof(uint32_t));
 
@@ -152,15 +279,38 @@ JSONChunkWriter::write(const arrow::ArrayVector& array_vec) {
 
 std::unique_ptr<Chunk>
 JSONChunkWriter::finish() {
-    char padding[simdjson::SIMDJSON_PADDING];
+    char padding[simdjson::SIMDJSON_PADDING] = {0};
     target_->write(padding, simdjson::SIMDJSON_PADDING);
 
+    // chunk layout continued: alignment, key index offsets, key indexes
+    if (has_key_index_) {
+        auto key_index_start = JSONChunk::KeyIndexStart(json_end_);
+        target_->write(padding, key_index_start - target_->tell());
+        uint32_t offset = key_index_start + sizeof(uint32_t) * (row_nums_ + 1);
+        std::vector<uint32_t> offsets;
+        offsets.reserve(row_nums_ + 1);
+        for (const auto& key_index : key_indexes_) {
+            offsets.push_back(offset);
+            offset += key_index.size();
+        }
+        offsets.push_back(offset);
+        target_->write(offsets.data(), offsets.size() * sizeof(uint32_t));
+        for (const auto& key_index : key_indexes_) {
+            target_->write(key_index.data(), key_index.size());
+        }
+        key_indexes_.clear();
+    }
+
     auto [data, size] = target_->get();
     auto mmap_file_raii = file_path_.empty()
                               ? nullptr
                               : std::make_unique<MmapFileRAII>(file_path_);
-    return std::make_unique<JSONChunk>(
-        row_nums_, data, size, nullable_, std::move(mmap_file_raii));
+    return std::make_unique<JSONChunk>(row_nums_,
+                                       data,
+                                       size,
+                                       nullable_,
+                                       std::move(mmap_file_raii),
+                                       has_key_index_);
 }
 
 void
@@ -448,26 +598,33 @@ SparseFloatVectorChunkWriter::write(const arrow::ArrayVector& array_vec) {
     auto size = 0;
     std::vector<std::string> strs;
     std::vector<std::pair<const uint8_t*, int64_t>> null_bitmaps;
+    uint64_t dim = 0;
     for (const auto& data : array_vec) {
         auto array = std::dynamic_pointer_cast<arrow::BinaryArray>(data);
         for (int i = 0; i < array->length(); i++) {
             auto str = array->GetView(i);
             strs.emplace_back(str);
             size += str.size();
+            knowhere::sparse::SparseRow<SparseValueType> row(
+                str.size() / knowhere::sparse::SparseRow<
+                                 SparseValueType>::element_size(),
+                reinterpret_cast<uint8_t*>(strs.back().data()),
+                false);
+            dim = std::max<uint64_t>(dim, row.dim());
         }
         auto null_bitmap_n = (data->length() + 7) / 8;
         null_bitmaps.emplace_back(data->null_bitmap_data(), null_bitmap_n);
         size += null_bitmap_n;
         row_nums_ += array->length();
     }
-    size += sizeof(uint64_t) * (row_nums_ + 1);
+    size += sizeof(uint64_t) + sizeof(uint64_t) * (row_nums_ + 1);
     if (!file_path_.empty()) {
         target_ = std::make_shared<MmapChunkTarget>(file_path_);
     } else {
         target_ = std::make_shared<MemChunkTarget>(size);
     }
 
-    // chunk layout: null bitmap, offset1, offset2, ..., offsetn, str1, str2, ..., strn
+    // chunk layout: null bitmap, dim, offset1, offset2, ..., offsetn, str1, str2, ..., strn
     // write null bitmaps
     for (auto [data, size] : null_bitmaps) {
         if (data == nullptr) {
@@ -478,6 +635,9 @@ SparseFloatVectorChunkWriter::write(const arrow::ArrayVector& array_vec) {
         }
     }
 
+    // the chunk reads dim from here instead of walking all rows
+    target_->write(&dim, sizeof(uint64_t));
+
     // write data
 
     int offset_num = row_nums_ + 1;
@@ -211,6 +211,18 @@ class StringChunkWriter : public ChunkWriterBase {
 
     std::unique_ptr<Chunk>
     finish() override;
+
+ private:
+    // writes strs dictionary encoded if they have at most
+    // STRING_DICTIONARY_MAX_CARDINALITY distinct values and the encoding is
+    // smaller, returns whether it did
+    bool
+    write_dictionary(
+        const std::vector<std::string_view>& strs,
+        const std::vector<std::tuple<const uint8_t*, int64_t, int64_t>>&
+            null_bitmaps);
+
+    bool dictionary_encoded_ = false;
 };
 
 class JSONChunkWriter : public ChunkWriterBase {
@@ -222,6 +234,13 @@ class JSONChunkWriter : public ChunkWriterBase {
 
     std::unique_ptr<Chunk>
     finish() override;
+
+ private:
+    // key indexes of the rows, written after the json data when
+    // JSON_CHUNK_KEY_INDEX_ENABLED
+    std::vector<std::string> key_indexes_;
+    bool has_key_index_ = false;
+    uint64_t json_end_ = 0;
 };
 
 class GeometryChunkWriter : public ChunkWriterBase {
@@ -24,7 +24,18 @@ std::atomic<int64_t> FILE_SLICE_SIZE(DEFAULT_INDEX_FILE_SLICE_SIZE);
 std::atomic<int64_t> EXEC_EVAL_EXPR_BATCH_SIZE(
     DEFAULT_EXEC_EVAL_EXPR_BATCH_SIZE);
 std::atomic<int64_t> DELETE_DUMP_BATCH_SIZE(DEFAULT_DELETE_DUMP_BATCH_SIZE);
+std::atomic<int64_t> BRUTE_FORCE_SEARCH_PARALLELISM(
+    DEFAULT_BRUTE_FORCE_SEARCH_PARALLELISM);
+std::atomic<int64_t> BLOCKED_BRUTE_FORCE_MIN_NQ(
+    DEFAULT_BLOCKED_BRUTE_FORCE_MIN_NQ);
+std::atomic<int64_t> REDUCE_PARALLELISM(DEFAULT_REDUCE_PARALLELISM);
+std::atomic<int64_t> STRING_DICTIONARY_MAX_CARDINALITY(
+    DEFAULT_STRING_DICTIONARY_MAX_CARDINALITY);
+std::atomic<bool> JSON_CHUNK_KEY_INDEX_ENABLED(
+    DEFAULT_JSON_CHUNK_KEY_INDEX_ENABLED);
 std::atomic<bool> OPTIMIZE_EXPR_ENABLED(DEFAULT_OPTIMIZE_EXPR_ENABLED);
+std::atomic<bool> ADAPTIVE_CONJUNCT_REORDER_ENABLED(
+    DEFAULT_ADAPTIVE_CONJUNCT_REORDER_ENABLED);
 
 std::atomic<bool> GROWING_JSON_KEY_STATS_ENABLED(
     DEFAULT_GROWING_JSON_KEY_STATS_ENABLED);
@@ -53,6 +64,40 @@ SetDefaultDeleteDumpBatchSize(int64_t val) {
              DELETE_DUMP_BATCH_SIZE.load());
 }
 
+void
+SetDefaultBruteForceSearchParallelism(int64_t val) {
+    BRUTE_FORCE_SEARCH_PARALLELISM.store(val);
+    LOG_INFO("set default brute force search parallelism: {}",
+             BRUTE_FORCE_SEARCH_PARALLELISM.load());
+}
+
+void
+SetDefaultBlockedBruteForceMinNq(int64_t val) {
+    BLOCKED_BRUTE_FORCE_MIN_NQ.store(val);
+    LOG_INFO("set default blocked brute force min nq: {}",
+             BLOCKED_BRUTE_FORCE_MIN_NQ.load());
+}
+
+void
+SetDefaultReduceParallelism(int64_t val) {
+    REDUCE_PARALLELISM.store(val);
+    LOG_INFO("set default reduce parallelism: {}", REDUCE_PARALLELISM.load());
+}
+
+void
+SetDefaultStringDictionaryMaxCardinality(int64_t val) {
+    STRING_DICTIONARY_MAX_CARDINALITY.store(val);
+    LOG_INFO("set default string dictionary max cardinality: {}",
+             STRING_DICTIONARY_MAX_CARDINALITY.load());
+}
+
+void
+SetDefaultJsonChunkKeyIndexEnable(bool val) {
+    JSON_CHUNK_KEY_INDEX_ENABLED.store(val);
+    LOG_INFO("set default json chunk key index enabled: {}",
+             JSON_CHUNK_KEY_INDEX_ENABLED.load());
+}
+
 void
 SetDefaultOptimizeExprEnable(bool val) {
     OPTIMIZE_EXPR_ENABLED.store(val);
@@ -60,6 +105,13 @@ SetDefaultOptimizeExprEnable(bool val) {
              OPTIMIZE_EXPR_ENABLED.load());
 }
 
+void
+SetDefaultAdaptiveConjunctReorderEnable(bool val) {
+    ADAPTIVE_CONJUNCT_REORDER_ENABLED.store(val);
+    LOG_INFO("set default adaptive conjunct reorder enabled: {}",
+             ADAPTIVE_CONJUNCT_REORDER_ENABLED.load());
+}
+
 void
 SetDefaultGrowingJSONKeyStatsEnable(bool val) {
     GROWING_JSON_KEY_STATS_ENABLED.store(val);
@@ -28,7 +28,13 @@ namespace milvus {
 extern std::atomic<int64_t> FILE_SLICE_SIZE;
 extern std::atomic<int64_t> EXEC_EVAL_EXPR_BATCH_SIZE;
 extern std::atomic<int64_t> DELETE_DUMP_BATCH_SIZE;
+extern std::atomic<int64_t> BRUTE_FORCE_SEARCH_PARALLELISM;
+extern std::atomic<int64_t> BLOCKED_BRUTE_FORCE_MIN_NQ;
+extern std::atomic<int64_t> REDUCE_PARALLELISM;
+extern std::atomic<int64_t> STRING_DICTIONARY_MAX_CARDINALITY;
+extern std::atomic<bool> JSON_CHUNK_KEY_INDEX_ENABLED;
 extern std::atomic<bool> OPTIMIZE_EXPR_ENABLED;
+extern std::atomic<bool> ADAPTIVE_CONJUNCT_REORDER_ENABLED;
 extern std::atomic<bool> GROWING_JSON_KEY_STATS_ENABLED;
 extern std::atomic<bool> CONFIG_PARAM_TYPE_CHECK_ENABLED;
 extern std::atomic<bool> ENABLE_PARQUET_STATS_SKIP_INDEX;
@@ -42,9 +48,27 @@ SetDefaultExecEvalExprBatchSize(int64_t val);
 void
 SetDefaultDeleteDumpBatchSize(int64_t val);
 
+void
+SetDefaultBruteForceSearchParallelism(int64_t val);
+
+void
+SetDefaultBlockedBruteForceMinNq(int64_t val);
+
+void
+SetDefaultReduceParallelism(int64_t val);
+
+void
+SetDefaultStringDictionaryMaxCardinality(int64_t val);
+
+void
+SetDefaultJsonChunkKeyIndexEnable(bool val);
+
 void
 SetDefaultOptimizeExprEnable(bool val);
 
+void
+SetDefaultAdaptiveConjunctReorderEnable(bool val);
+
 void
 SetDefaultGrowingJSONKeyStatsEnable(bool val);
 
@@ -51,6 +51,7 @@ const char VEC_OPT_FIELDS[] = "opt_fields";
 const char PAGE_RETAIN_ORDER[] = "page_retain_order";
 const char TEXT_LOG_ROOT_PATH[] = "text_log";
 const char ITERATIVE_FILTER[] = "iterative_filter";
+const char ADAPTIVE_FILTER[] = "adaptive_filter";
 const char HINTS[] = "hints";
 // json stats related
 const char JSON_KEY_INDEX_LOG_ROOT_PATH[] = "json_key_index_log";
@@ -80,6 +81,15 @@ const int64_t DEFAULT_INDEX_FILE_SLICE_SIZE = 16 << 20;  // bytes
 const int64_t DEFAULT_EXEC_EVAL_EXPR_BATCH_SIZE = 8192;
 
 const int64_t DEFAULT_DELETE_DUMP_BATCH_SIZE = 10000;
+// max chunks of one segment brute-force searched in parallel, 1 to disable
+const int64_t DEFAULT_BRUTE_FORCE_SEARCH_PARALLELISM = 1;
+// min nq of a brute-force search to use the query-blocked kernel, 0 to disable
+const int64_t DEFAULT_BLOCKED_BRUTE_FORCE_MIN_NQ = 0;
+// max distinct values of a sealed string chunk to dictionary encode it, 0 to
+// disable
+const int64_t DEFAULT_STRING_DICTIONARY_MAX_CARDINALITY = 0;
+// whether sealed json chunks hold the key index of their rows
+const bool DEFAULT_JSON_CHUNK_KEY_INDEX_ENABLED = false;
 
 constexpr const char* RADIUS = knowhere::meta::RADIUS;
 constexpr const char* RANGE_FILTER = knowhere::meta::RANGE_FILTER;
@@ -98,12 +108,20 @@ const std::string JSON_CAST_TYPE = "json_cast_type";
 const std::string JSON_PATH = "json_path";
 const std::string JSON_CAST_FUNCTION = "json_cast_function";
 const bool DEFAULT_OPTIMIZE_EXPR_ENABLED = true;
+const bool DEFAULT_ADAPTIVE_CONJUNCT_REORDER_ENABLED = false;
+// batches sampled before a conjunction re-sorts its inputs
+const int64_t DEFAULT_ADAPTIVE_REORDER_SAMPLE_BATCHES = 2;
 const int64_t DEFAULT_CONVERT_OR_TO_IN_NUMERIC_LIMIT = 150;
 const int64_t DEFAULT_JSON_INDEX_MEMORY_BUDGET = 16777216;  // bytes, 16MB
 const bool DEFAULT_GROWING_JSON_KEY_STATS_ENABLED = false;
 const bool DEFAULT_CONFIG_PARAM_TYPE_CHECK_ENABLED = true;
 const bool DEFAULT_ENABLE_PARQUET_STATS_SKIP_INDEX = false;
 
+// reduce related, fewer nqs per thread are merged on the calling thread
+const int64_t REDUCE_MIN_NQ_PER_TASK = 4;
+// max tasks merging the nqs of one reduce in parallel, 1 to disable
+const int64_t DEFAULT_REDUCE_PARALLELISM = 1;
+
 // skipindex stats related
 const double DEFAULT_BLOOM_FILTER_FALSE_POSITIVE_RATE = 0.01;
 const int64_t DEFAULT_SKIPINDEX_MIN_NGRAM_LENGTH = 3;
@@ -26,6 +26,7 @@
 #include <string_view>
 
 #include "common/EasyAssert.h"
+#include "common/JsonKeyIndex.h"
 #include "simdjson.h"
 #include "fmt/core.h"
 #include "simdjson/common_defs.h"
@@ -115,6 +116,12 @@ class Json {
         : data_(data, len, len + simdjson::SIMDJSON_PADDING) {
     }
 
+    // same as above, the values of data are looked up in key_index first
+    Json(const std::string_view& data, JsonKeyIndex key_index)
+        : Json(data.data(), data.size()) {
+        key_index_ = key_index;
+    }
+
     Json(const Json& json) {
         if (json.own_data_.has_value()) {
             own_data_ = simdjson::padded_string(
@@ -123,6 +130,7 @@ class Json {
         } else {
             data_ = json.data_;
         }
+        key_index_ = json.key_index_;
     };
     Json(Json&& json) noexcept {
         if (json.own_data_.has_value()) {
@@ -131,6 +139,7 @@ class Json {
         } else {
             data_ = json.data_;
         }
+        key_index_ = json.key_index_;
     }
 
     Json&
@@ -142,6 +151,7 @@ class Json {
         } else {
             data_ = json.data_;
         }
+        key_index_ = json.key_index_;
         return *this;
     }
 
@@ -273,6 +283,15 @@ class Json {
             }
         }
 
+        if constexpr (std::is_same_v<bool, T> || std::is_same_v<int64_t, T> ||
+                      std::is_same_v<double, T> ||
+                      std::is_same_v<std::string_view, T>) {
+            if (!key_index_.empty()) {
+                if (auto res = key_index_.At<T>(pointer); res.has_value()) {
+                    return std::move(res.value());
+                }
+            }
+        }
         return doc().at_pointer(pointer).get<T>();
     }
 
@@ -338,6 +357,8 @@ class Json {
     std::optional<simdjson::padded_string>
         own_data_{};  // this could be empty, then the Json will be just s view on bytes
     simdjson::padded_string_view data_{};
+    // empty unless the json is a row of a json chunk with a key index
+    JsonKeyIndex key_index_{};
 };
 
 inline bool
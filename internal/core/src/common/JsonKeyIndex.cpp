@@ -0,0 +1,236 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "common/JsonKeyIndex.h"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <bsoncxx/builder/basic/array.hpp>
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <bsoncxx/types.hpp>
+
+#include "common/bson_view.h"
+#include "index/json_stats/bson_builder.h"
+
+namespace milvus {
+
+namespace {
+
+using bsoncxx::builder::basic::kvp;
+
+uint32_t
+Align4(uint32_t size) {
+    return (size + 3) & ~uint32_t(3);
+}
+
+void
+AppendUint32(std::string& out, uint32_t value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(uint32_t));
+}
+
+// Appends the fields of object to out. Only the first of duplicated keys is
+// kept, the one a lookup by pointer finds in the json text. Returns false if
+// a key can not be stored in bson.
+bool
+AppendObject(simdjson::dom::object object,
+             bsoncxx::builder::basic::document& out) {
+    using simdjson::dom::element_type;
+
+    std::unordered_set<std::string_view> keys;
+    for (auto [key, value] : object) {
+        // bson keys are null terminated
+        if (key.find('\0') != std::string_view::npos) {
+            return false;
+        }
+        if (!keys.insert(key).second) {
+            continue;
+        }
+        auto name = std::string(key);
+        switch (value.type()) {
+            case element_type::STRING:
+                out.append(kvp(name, std::string(value.get_string().value())));
+                break;
+            case element_type::INT64:
+                out.append(kvp(name, value.get_int64().value()));
+                break;
+            // out of the range of int64, Json::at reads it as a double only
+            case element_type::UINT64:
+            case element_type::DOUBLE:
+                out.append(kvp(name, value.get_double().value()));
+                break;
+            case element_type::BOOL:
+                out.append(kvp(name, value.get_bool().value()));
+                break;
+            case element_type::OBJECT: {
+                bsoncxx::builder::basic::document sub;
+                if (!AppendObject(value.get_object().value(), sub)) {
+                    return false;
+                }
+                out.append(kvp(name, sub.extract()));
+                break;
+            }
+            case element_type::ARRAY:
+                // only the type is kept, arrays are read from the json text
+                out.append(kvp(name, bsoncxx::builder::basic::array{}));
+                break;
+            default:
+                out.append(kvp(name, bsoncxx::types::b_null{}));
+                break;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+std::string
+JsonKeyIndex::Build(std::string_view json) {
+    thread_local simdjson::dom::parser parser;
+    auto doc = parser.parse(json.data(), json.size());
+    if (doc.error() != simdjson::SUCCESS || !doc.value().is_object()) {
+        return {};
+    }
+    bsoncxx::builder::basic::document builder;
+    if (!AppendObject(doc.value().get_object().value(), builder)) {
+        return {};
+    }
+    auto bson = builder.extract();
+    auto key_offsets = index::BsonBuilder::ExtractBsonKeyOffsets(bson.view());
+    std::sort(key_offsets.begin(), key_offsets.end());
+
+    std::string out;
+    uint32_t num_keys = key_offsets.size();
+    AppendUint32(out, num_keys);
+    uint32_t key_end = 0;
+    for (const auto& [key, offset] : key_offsets) {
+        key_end += key.size();
+        AppendUint32(out, key_end);
+    }
+    for (const auto& [key, offset] : key_offsets) {
+        AppendUint32(out, offset);
+    }
+    for (const auto& [key, offset] : key_offsets) {
+        out.append(key);
+    }
+    out.resize(out.size() + Align4(key_end) - key_end, '\0');
+    out.append(reinterpret_cast<const char*>(bson.view().data()),
+               bson.view().length());
+    out.resize(Align4(out.size()), '\0');
+    return out;
+}
+
+std::string_view
+JsonKeyIndex::Key(uint32_t idx) const {
+    auto key_ends = reinterpret_cast<const uint32_t*>(data_) + 1;
+    auto keys = data_ + sizeof(uint32_t) * (1 + 2 * num_keys());
+    auto begin = idx == 0 ? 0 : key_ends[idx - 1];
+    return {keys + begin, key_ends[idx] - begin};
+}
+
+const uint8_t*
+JsonKeyIndex::Element(uint32_t idx) const {
+    auto n = num_keys();
+    auto key_ends = reinterpret_cast<const uint32_t*>(data_) + 1;
+    auto element_offsets = key_ends + n;
+    auto keys = data_ + sizeof(uint32_t) * (1 + 2 * n);
+    auto bson = keys + Align4(n == 0 ? 0 : key_ends[n - 1]);
+    return reinterpret_cast<const uint8_t*>(bson) + element_offsets[idx];
+}
+
+std::optional<uint32_t>
+JsonKeyIndex::Find(std::string_view pointer) const {
+    uint32_t left = 0;
+    uint32_t right = num_keys();
+    while (left < right) {
+        auto mid = left + (right - left) / 2;
+        if (Key(mid) < pointer) {
+            left = mid + 1;
+        } else {
+            right = mid;
+        }
+    }
+    if (left < num_keys() && Key(left) == pointer) {
+        return left;
+    }
+    return std::nullopt;
+}
+
+template <typename T>
+std::optional<simdjson::simdjson_result<T>>
+JsonKeyIndex::At(std::string_view pointer) const {
+    if (data_ == nullptr || pointer.empty()) {
+        return std::nullopt;
+    }
+    auto idx = Find(pointer);
+    if (!idx.has_value()) {
+        // the values of arrays are not indexed, nor are nulls, the longest
+        // indexed prefix of pointer tells whether it leads into an array
+        for (auto pos = pointer.rfind('/'); pos != 0 && pos != pointer.npos;
+             pos = pointer.rfind('/', pos - 1)) {
+            auto prefix = Find(pointer.substr(0, pos));
+            if (prefix.has_value()) {
+                if (static_cast<bsoncxx::type>(*Element(prefix.value())) ==
+                    bsoncxx::type::k_array) {
+                    return std::nullopt;
+                }
+                break;
+            }
+        }
+        return simdjson::simdjson_result<T>(simdjson::NO_SUCH_FIELD);
+    }
+
+    auto element = Element(idx.value());
+    auto type = static_cast<bsoncxx::type>(*element);
+    auto key = reinterpret_cast<const char*>(element + 1);
+    auto value = element + 1 + std::strlen(key) + 1;
+    if constexpr (std::is_same_v<T, bool>) {
+        if (type == bsoncxx::type::k_bool) {
+            return simdjson::simdjson_result<T>(GetValue<bool>(value));
+        }
+    } else if constexpr (std::is_same_v<T, int64_t>) {
+        if (type == bsoncxx::type::k_int64) {
+            return simdjson::simdjson_result<T>(GetValue<int64_t>(value));
+        }
+    } else if constexpr (std::is_same_v<T, double>) {
+        if (type == bsoncxx::type::k_double) {
+            return simdjson::simdjson_result<T>(GetValue<double>(value));
+        }
+        if (type == bsoncxx::type::k_int64) {
+            return simdjson::simdjson_result<T>(
+                static_cast<double>(GetValue<int64_t>(value)));
+        }
+    } else if constexpr (std::is_same_v<T, std::string_view>) {
+        if (type == bsoncxx::type::k_string) {
+            return simdjson::simdjson_result<T>(
+                GetValue<std::string_view>(value));
+        }
+    } else {
+        static_assert(!std::is_same_v<T, T>,
+                      "unsupported type of json key index lookup");
+    }
+    return simdjson::simdjson_result<T>(simdjson::INCORRECT_TYPE);
+}
+
+template std::optional<simdjson::simdjson_result<bool>>
+JsonKeyIndex::At<bool>(std::string_view pointer) const;
+template std::optional<simdjson::simdjson_result<int64_t>>
+JsonKeyIndex::At<int64_t>(std::string_view pointer) const;
+template std::optional<simdjson::simdjson_result<double>>
+JsonKeyIndex::At<double>(std::string_view pointer) const;
+template std::optional<simdjson::simdjson_result<std::string_view>>
+JsonKeyIndex::At<std::string_view>(std::string_view pointer) const;
+
+}  // namespace milvus
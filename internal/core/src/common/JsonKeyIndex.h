@@ -0,0 +1,81 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "simdjson.h"
+
+namespace milvus {
+
+// Pre-indexed binary layout of a json object, so that the value at a json
+// pointer is found without parsing the json.
+//
+// The object is stored in bson, and the json pointers of all its values are
+// kept sorted, each with the offset of its bson element:
+//
+// [num_keys][key_ends][element_offsets][keys][alignment][bson][alignment]
+//
+// The key of entry i spans [key_ends[i - 1], key_ends[i]) of keys, key_ends
+// and element_offsets are uint32. The values of arrays are not stored, a
+// pointer into an array is read from the json text. A JsonKeyIndex is a view
+// on such a layout, built by Build.
+class JsonKeyIndex {
+ public:
+    JsonKeyIndex() = default;
+
+    explicit JsonKeyIndex(const char* data) : data_(data) {
+    }
+
+    // Serializes the key index of json, a multiple of 4 bytes long. Returns
+    // an empty string when json is not an object or can not be indexed.
+    static std::string
+    Build(std::string_view json);
+
+    bool
+    empty() const {
+        return data_ == nullptr;
+    }
+
+    // The value of type T at pointer, or the error Json::at would return for
+    // it. Returns std::nullopt when the value has to be read from the json
+    // text, that is when pointer is empty or may lead into an array. T is
+    // bool, int64_t, double or std::string_view, an integer is read as a
+    // double but a double is not read as an integer, like Json::at.
+    template <typename T>
+    std::optional<simdjson::simdjson_result<T>>
+    At(std::string_view pointer) const;
+
+ private:
+    uint32_t
+    num_keys() const {
+        return reinterpret_cast<const uint32_t*>(data_)[0];
+    }
+
+    std::string_view
+    Key(uint32_t idx) const;
+
+    // bson element of entry idx, its type tag followed by its key and value
+    const uint8_t*
+    Element(uint32_t idx) const;
+
+    // entry of pointer, std::nullopt if there is none
+    std::optional<uint32_t>
+    Find(std::string_view pointer) const;
+
+    const char* data_ = nullptr;
+};
+
+}  // namespace milvus
@@ -27,6 +27,7 @@
 #include <boost/dynamic_bitset.hpp>
 #include <NamedType/named_type.hpp>
 
+#include "common/Aggregation.h"
 #include "common/FieldMeta.h"
 #include "pb/schema.pb.h"
 #include "knowhere/index/index_node.h"
@@ -291,6 +292,8 @@ struct RetrieveResult {
     bool has_more_result = true;
     // record the storage usage in retrieve
     StorageCost retrieve_storage_cost_;
+    // partial aggregates, set if the plan has an AggregationNode
+    std::shared_ptr<AggregationResult> aggregation_result_;
 };
 
 using RetrieveResultPtr = std::shared_ptr<RetrieveResult>;
@@ -9,6 +9,8 @@
 // is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
+#include <cstring>
+
 #include <re2/re2.h>
 
 #include "common/RegexQuery.h"
@@ -60,4 +62,148 @@ translate_pattern_match_to_regex(const std::string& pattern) {
     }
     return r;
 }
+
+namespace {
+// rough frequency of a byte in text, higher is more common
+uint8_t
+byte_frequency_rank(uint8_t c) {
+    static const char* common_bytes = " etaoinsrhldcumfpgwybvkxjqz";
+    if (c >= 'A' && c <= 'Z') {
+        c = c - 'A' + 'a';
+    }
+    for (int i = 0; common_bytes[i] != '\0'; i++) {
+        if (common_bytes[i] == c) {
+            return 255 - i;
+        }
+    }
+    if (c >= '0' && c <= '9') {
+        return 200;
+    }
+    return c < 0x80 ? 100 : 50;
+}
+}  // namespace
+
+LikePatternMatcher::LikePatternMatcher(const std::string& pattern) {
+    segments_.emplace_back();
+    bool escape_mode = false;
+    for (char c : pattern) {
+        auto& segment = segments_.back();
+        if (escape_mode) {
+            segment.bytes += c;
+            segment.wildcard.push_back(false);
+            escape_mode = false;
+        } else if (c == '\\') {
+            escape_mode = true;
+        } else if (c == '%') {
+            segments_.emplace_back();
+        } else {
+            segment.bytes += c;
+            segment.wildcard.push_back(c == '_');
+        }
+    }
+
+    for (auto& segment : segments_) {
+        size_t run_begin = 0;
+        for (size_t i = 0; i <= segment.bytes.size(); i++) {
+            if (i < segment.bytes.size() && !segment.wildcard[i]) {
+                continue;
+            }
+            if (i - run_begin > segment.anchor_len) {
+                segment.anchor_pos = run_begin;
+                segment.anchor_len = i - run_begin;
+            }
+            run_begin = i + 1;
+        }
+        segment.rare_pos = segment.anchor_pos;
+        for (size_t i = segment.anchor_pos;
+             i < segment.anchor_pos + segment.anchor_len;
+             i++) {
+            if (byte_frequency_rank(segment.bytes[i]) <
+                byte_frequency_rank(segment.bytes[segment.rare_pos])) {
+                segment.rare_pos = i;
+            }
+        }
+    }
+}
+
+bool
+LikePatternMatcher::MatchAt(const Segment& segment,
+                            std::string_view operand,
+                            size_t pos) {
+    auto data = operand.data() + pos;
+    if (std::memcmp(data + segment.anchor_pos,
+                    segment.bytes.data() + segment.anchor_pos,
+                    segment.anchor_len) != 0) {
+        return false;
+    }
+    if (segment.anchor_len == segment.bytes.size()) {
+        return true;
+    }
+    for (size_t i = 0; i < segment.bytes.size(); i++) {
+        if (!segment.wildcard[i] && data[i] != segment.bytes[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t
+LikePatternMatcher::Find(const Segment& segment,
+                         std::string_view operand,
+                         size_t from,
+                         size_t to) {
+    auto len = segment.bytes.size();
+    if (to < from || to - from < len) {
+        return std::string_view::npos;
+    }
+    if (segment.anchor_len == 0) {
+        // only '_', any position fits
+        return from;
+    }
+    auto last = to - len;
+    auto rare = segment.bytes[segment.rare_pos];
+    auto begin = operand.data() + segment.rare_pos;
+    for (size_t pos = from; pos <= last;) {
+        auto hit = static_cast<const char*>(
+            std::memchr(begin + pos, rare, last - pos + 1));
+        if (hit == nullptr) {
+            break;
+        }
+        pos = hit - begin;
+        if (MatchAt(segment, operand, pos)) {
+            return pos;
+        }
+        pos++;
+    }
+    return std::string_view::npos;
+}
+
+bool
+LikePatternMatcher::Match(std::string_view operand) const {
+    const auto& first = segments_.front();
+    if (segments_.size() == 1) {
+        return operand.size() == first.bytes.size() &&
+               MatchAt(first, operand, 0);
+    }
+    const auto& last = segments_.back();
+    if (operand.size() < first.bytes.size() + last.bytes.size() ||
+        !MatchAt(first, operand, 0) ||
+        !MatchAt(last, operand, operand.size() - last.bytes.size())) {
+        return false;
+    }
+    size_t pos = first.bytes.size();
+    size_t end = operand.size() - last.bytes.size();
+    for (size_t i = 1; i + 1 < segments_.size(); i++) {
+        const auto& segment = segments_[i];
+        if (segment.bytes.empty()) {
+            continue;
+        }
+        auto found = Find(segment, operand, pos, end);
+        if (found == std::string_view::npos) {
+            return false;
+        }
+        pos = found + segment.bytes.size();
+    }
+    return true;
+}
 }  // namespace milvus
@@ -12,7 +12,9 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <regex>
+#include <vector>
 #include <boost/regex.hpp>
 #include <utility>
 
@@ -73,4 +75,76 @@ inline bool
 RegexMatcher::operator()(const std::string_view& operand) {
     return boost::regex_match(operand.begin(), operand.end(), r_);
 }
+
+// Matches LIKE patterns without going through a regex engine.
+//
+// A LIKE pattern is a list of fixed-length segments separated by '%', where
+// a segment holds literal bytes and '_' wildcards. The first segment is
+// anchored at the beginning of the operand and the last one at its end; the
+// others are searched left to right, and taking the leftmost occurrence of
+// each is always optimal since every segment has a fixed length. Segments
+// are located by memchr on their rarest literal byte before the remaining
+// bytes are compared, so most non-matching rows are rejected without
+// touching the whole operand.
+//
+// Same result as RegexMatcher on the translated pattern, '_' matches one
+// byte.
+class LikePatternMatcher {
+ public:
+    template <typename T>
+    explicit LikePatternMatcher(const T& pattern) {
+        ThrowInfo(OpTypeInvalid,
+                  "pattern matching is only supported on string type");
+    }
+
+    explicit LikePatternMatcher(const std::string& pattern);
+
+    template <typename T>
+    inline bool
+    operator()(const T& operand) const {
+        return false;
+    }
+
+ private:
+    struct Segment {
+        // literal bytes, '_' positions hold an arbitrary byte
+        std::string bytes;
+        // wildcard_[i] is true if bytes[i] comes from '_'
+        std::vector<bool> wildcard;
+        // longest run of literal bytes, searched first
+        size_t anchor_pos = 0;
+        size_t anchor_len = 0;
+        // byte in the anchor that memchr looks for
+        size_t rare_pos = 0;
+    };
+
+    bool
+    Match(std::string_view operand) const;
+
+    static bool
+    MatchAt(const Segment& segment, std::string_view operand, size_t pos);
+
+    // leftmost occurrence of segment within [from, to), or npos
+    static size_t
+    Find(const Segment& segment,
+         std::string_view operand,
+         size_t from,
+         size_t to);
+
+ private:
+    // split by '%', the first and the last ones may be empty
+    std::vector<Segment> segments_;
+};
+
+template <>
+inline bool
+LikePatternMatcher::operator()(const std::string& operand) const {
+    return Match(operand);
+}
+
+template <>
+inline bool
+LikePatternMatcher::operator()(const std::string_view& operand) const {
+    return Match(operand);
+}
 }  // namespace milvus
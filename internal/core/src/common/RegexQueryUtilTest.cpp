@@ -10,6 +10,7 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
 #include <gtest/gtest.h>
+#include <random>
 #include <unordered_set>
 
 #include "common/RegexQuery.h"
@@ -151,3 +152,83 @@ TEST(RegexMatcherTest, PatternMatchWithNewLine) {
 
     EXPECT_TRUE(matcher(std::string("Hello\n")));
 }
+
+TEST(LikePatternMatcherTest, DefaultBehaviorTest) {
+    using namespace milvus;
+    LikePatternMatcher matcher(std::string("Hello%"));
+
+    EXPECT_FALSE(matcher(123));
+    EXPECT_FALSE(matcher(3.14));
+    EXPECT_FALSE(matcher(true));
+    ASSERT_ANY_THROW(LikePatternMatcher(123));
+}
+
+TEST(LikePatternMatcherTest, PatternMatch) {
+    using namespace milvus;
+    struct Case {
+        std::string pattern;
+        std::string operand;
+        bool expected;
+    };
+    std::vector<Case> cases = {
+        {"", "", true},
+        {"", "a", false},
+        {"abc", "abc", true},
+        {"abc", "abcd", false},
+        {"%", "", true},
+        {"%%", "anything", true},
+        {"abc%", "abcdef", true},
+        {"abc%", "xabc", false},
+        {"%def", "abcdef", true},
+        {"%def", "defx", false},
+        {"%cd%", "abcdef", true},
+        {"%cd%", "abdcef", false},
+        {"abc%abc", "abc", false},
+        {"abc%abc", "abcabc", true},
+        {"%a%b%c%", "xaxbxcx", true},
+        {"%a%b%c%", "xcxbxax", false},
+        {"a_c", "abc", true},
+        {"a_c", "ac", false},
+        {"%a_c%", "xxaxcxx", true},
+        {"%a__d%", "aaaad", true},
+        {"___", "abc", true},
+        {"___", "ab", false},
+        {"%_%", "", false},
+        {"%b_d%b_d", "bxdbyd", true},
+        {"a\\%b\\_c", "a%b_c", true},
+        {"a\\%b\\_c", "axbyc", false},
+        {"Hello%", "Hello\n", true},
+        {"%\n%", "a\nb", true},
+    };
+    for (const auto& c : cases) {
+        LikePatternMatcher matcher(c.pattern);
+        EXPECT_EQ(c.expected, matcher(c.operand))
+            << c.pattern << " " << c.operand;
+        EXPECT_EQ(c.expected, matcher(std::string_view(c.operand)))
+            << c.pattern << " " << c.operand;
+    }
+}
+
+TEST(LikePatternMatcherTest, SameAsRegexMatcher) {
+    using namespace milvus;
+    std::default_random_engine er(42);
+    auto random_string = [&](const std::string& alphabet, size_t max_len) {
+        std::string s(er() % (max_len + 1), ' ');
+        for (auto& c : s) {
+            c = alphabet[er() % alphabet.size()];
+        }
+        return s;
+    };
+    PatternMatchTranslator translator;
+    for (int i = 0; i < 500; i++) {
+        auto pattern = random_string("ab%_\\.*", 8);
+        auto regex_pattern = translator(pattern);
+        RegexMatcher expected(regex_pattern);
+        LikePatternMatcher matcher(pattern);
+        for (int j = 0; j < 50; j++) {
+            auto operand = random_string("ab_%.*\n", 12);
+            ASSERT_EQ(expected(operand), matcher(operand))
+                << pattern << " " << operand;
+        }
+    }
+}
@@ -60,11 +60,41 @@ SetDefaultDeleteDumpBatchSize(int64_t val) {
     milvus::SetDefaultDeleteDumpBatchSize(val);
 }
 
+void
+SetDefaultBruteForceSearchParallelism(int64_t val) {
+    milvus::SetDefaultBruteForceSearchParallelism(val);
+}
+
+void
+SetDefaultBlockedBruteForceMinNq(int64_t val) {
+    milvus::SetDefaultBlockedBruteForceMinNq(val);
+}
+
+void
+SetDefaultReduceParallelism(int64_t val) {
+    milvus::SetDefaultReduceParallelism(val);
+}
+
+void
+SetDefaultStringDictionaryMaxCardinality(int64_t val) {
+    milvus::SetDefaultStringDictionaryMaxCardinality(val);
+}
+
+void
+SetDefaultJsonChunkKeyIndexEnable(bool val) {
+    milvus::SetDefaultJsonChunkKeyIndexEnable(val);
+}
+
 void
 SetDefaultOptimizeExprEnable(bool val) {
     milvus::SetDefaultOptimizeExprEnable(val);
 }
 
+void
+SetDefaultAdaptiveConjunctReorderEnable(bool val) {
+    milvus::SetDefaultAdaptiveConjunctReorderEnable(val);
+}
+
 void
 SetDefaultGrowingJSONKeyStatsEnable(bool val) {
     milvus::SetDefaultGrowingJSONKeyStatsEnable(val);
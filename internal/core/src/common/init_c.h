@@ -45,9 +45,27 @@ SetDefaultExprEvalBatchSize(int64_t val);
 void
 SetDefaultDeleteDumpBatchSize(int64_t val);
 
+void
+SetDefaultBruteForceSearchParallelism(int64_t val);
+
+void
+SetDefaultBlockedBruteForceMinNq(int64_t val);
+
+void
+SetDefaultReduceParallelism(int64_t val);
+
+void
+SetDefaultStringDictionaryMaxCardinality(int64_t val);
+
+void
+SetDefaultJsonChunkKeyIndexEnable(bool val);
+
 void
 SetDefaultOptimizeExprEnable(bool val);
 
+void
+SetDefaultAdaptiveConjunctReorderEnable(bool val);
+
 void
 SetDefaultGrowingJSONKeyStatsEnable(bool val);
 
@@ -23,10 +23,12 @@
 
 #include "common/EasyAssert.h"
 #include "exec/operator/CallbackSink.h"
+#include "exec/operator/AggregationNode.h"
 #include "exec/operator/CountNode.h"
 #include "exec/operator/FilterBitsNode.h"
 #include "exec/operator/IterativeFilterNode.h"
 #include "exec/operator/MvccNode.h"
+#include "exec/operator/OrderByNode.h"
 #include "exec/operator/Operator.h"
 #include "exec/operator/RescoresNode.h"
 #include "exec/operator/VectorSearchNode.h"
@@ -80,6 +82,18 @@ DriverFactory::CreateDriver(std::unique_ptr<DriverContext> ctx,
             tracer::AddEvent("create_operator: CountNode");
             operators.push_back(
                 std::make_unique<PhyCountNode>(id, ctx.get(), countnode));
+        } else if (auto aggregationnode =
+                       std::dynamic_pointer_cast<const plan::AggregationNode>(
+                           plannode)) {
+            tracer::AddEvent("create_operator: AggregationNode");
+            operators.push_back(std::make_unique<PhyAggregationNode>(
+                id, ctx.get(), aggregationnode));
+        } else if (auto orderbynode =
+                       std::dynamic_pointer_cast<const plan::OrderByNode>(
+                           plannode)) {
+            tracer::AddEvent("create_operator: OrderByNode");
+            operators.push_back(
+                std::make_unique<PhyOrderByNode>(id, ctx.get(), orderbynode));
         } else if (auto vectorsearchnode =
                        std::dynamic_pointer_cast<const plan::VectorSearchNode>(
                            plannode)) {
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -301,6 +302,29 @@ class QueryContext : public Context {
         return plan_options_;
     }
 
+    // fraction of the rows evaluated by the filter that passed it
+    void
+    set_filter_selectivity(double selectivity) {
+        filter_selectivity_ = selectivity;
+    }
+
+    std::optional<double>
+    get_filter_selectivity() const {
+        return filter_selectivity_;
+    }
+
+    // deletes are checked on the candidates of the iterative filter instead
+    // of being masked on every row by the mvcc node
+    void
+    set_lazy_delete(bool lazy_delete) {
+        lazy_delete_ = lazy_delete;
+    }
+
+    bool
+    is_lazy_delete() const {
+        return lazy_delete_;
+    }
+
  private:
     folly::Executor* executor_;
     //folly::Executor::KeepAlive<> executor_keepalive_;
@@ -329,6 +353,10 @@ class QueryContext : public Context {
     int32_t consistency_level_ = 0;
 
     query::PlanOptions plan_options_;
+
+    std::optional<double> filter_selectivity_;
+
+    bool lazy_delete_ = false;
 };
 
 // Represent the state of one thread of query execution.
@@ -311,74 +311,85 @@ PhyBinaryRangeFilterExpr::ExecRangeVisitorImplForData(EvalCtx& context) {
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
     size_t processed_cursor = 0;
-    auto execute_sub_batch =
-        [ lower_inclusive, upper_inclusive, &processed_cursor, &
-          bitmap_input ]<FilterType filter_type = FilterType::sequential>(
-            const T* data,
-            const bool* valid_data,
-            const int32_t* offsets,
-            const int size,
-            TargetBitmapView res,
-            TargetBitmapView valid_res,
-            HighPrecisionType val1,
-            HighPrecisionType val2) {
-        if (lower_inclusive && upper_inclusive) {
-            BinaryRangeElementFunc<T, true, true, filter_type> func;
-            func(val1,
-                 val2,
-                 data,
-                 size,
-                 res,
-                 bitmap_input,
-                 processed_cursor,
-                 offsets);
-        } else if (lower_inclusive && !upper_inclusive) {
-            BinaryRangeElementFunc<T, true, false, filter_type> func;
-            func(val1,
-                 val2,
-                 data,
-                 size,
-                 res,
-                 bitmap_input,
-                 processed_cursor,
-                 offsets);
-        } else if (!lower_inclusive && upper_inclusive) {
-            BinaryRangeElementFunc<T, false, true, filter_type> func;
-            func(val1,
-                 val2,
-                 data,
-                 size,
-                 res,
-                 bitmap_input,
-                 processed_cursor,
-                 offsets);
-        } else {
-            BinaryRangeElementFunc<T, false, false, filter_type> func;
-            func(val1,
-                 val2,
-                 data,
-                 size,
-                 res,
-                 bitmap_input,
-                 processed_cursor,
-                 offsets);
-        }
-        // there is a batch operation in BinaryRangeElementFunc,
-        // so not divide data again for the reason that it may reduce performance if the null distribution is scattered
-        // but to mask res with valid_data after the batch operation.
-        if (valid_data != nullptr) {
-            for (int i = 0; i < size; i++) {
-                auto offset = i;
-                if constexpr (filter_type == FilterType::random) {
-                    offset = (offsets) ? offsets[i] : i;
-                }
-                if (!valid_data[offset]) {
-                    res[i] = valid_res[i] = false;
+    // the dictionary of a dictionary encoded chunk is evaluated with a sub
+    // batch of its own, which does not skip entries on bitmap_input
+    auto make_sub_batch = [lower_inclusive, upper_inclusive](
+                              const TargetBitmap& bitmap_input,
+                              size_t& processed_cursor) {
+        return [ lower_inclusive, upper_inclusive, &processed_cursor, &
+                 bitmap_input ]<FilterType filter_type =
+                                    FilterType::sequential>(
+                   const T* data,
+                   const bool* valid_data,
+                   const int32_t* offsets,
+                   const int size,
+                   TargetBitmapView res,
+                   TargetBitmapView valid_res,
+                   HighPrecisionType val1,
+                   HighPrecisionType val2) {
+            if (lower_inclusive && upper_inclusive) {
+                BinaryRangeElementFunc<T, true, true, filter_type> func;
+                func(val1,
+                     val2,
+                     data,
+                     size,
+                     res,
+                     bitmap_input,
+                     processed_cursor,
+                     offsets);
+            } else if (lower_inclusive && !upper_inclusive) {
+                BinaryRangeElementFunc<T, true, false, filter_type> func;
+                func(val1,
+                     val2,
+                     data,
+                     size,
+                     res,
+                     bitmap_input,
+                     processed_cursor,
+                     offsets);
+            } else if (!lower_inclusive && upper_inclusive) {
+                BinaryRangeElementFunc<T, false, true, filter_type> func;
+                func(val1,
+                     val2,
+                     data,
+                     size,
+                     res,
+                     bitmap_input,
+                     processed_cursor,
+                     offsets);
+            } else {
+                BinaryRangeElementFunc<T, false, false, filter_type> func;
+                func(val1,
+                     val2,
+                     data,
+                     size,
+                     res,
+                     bitmap_input,
+                     processed_cursor,
+                     offsets);
+            }
+            // there is a batch operation in BinaryRangeElementFunc,
+            // so not divide data again for the reason that it may reduce performance if the null distribution is scattered
+            // but to mask res with valid_data after the batch operation.
+            if (valid_data != nullptr) {
+                for (int i = 0; i < size; i++) {
+                    auto offset = i;
+                    if constexpr (filter_type == FilterType::random) {
+                        offset = (offsets) ? offsets[i] : i;
+                    }
+                    if (!valid_data[offset]) {
+                        res[i] = valid_res[i] = false;
+                    }
                 }
             }
-        }
-        processed_cursor += size;
+            processed_cursor += size;
+        };
     };
+    auto execute_sub_batch = make_sub_batch(bitmap_input, processed_cursor);
+    TargetBitmap no_bitmap_input;
+    size_t dictionary_cursor = 0;
+    auto execute_dictionary =
+        make_sub_batch(no_bitmap_input, dictionary_cursor);
 
     auto skip_index_func =
         [val1, val2, lower_inclusive, upper_inclusive](
@@ -397,6 +408,11 @@ PhyBinaryRangeFilterExpr::ExecRangeVisitorImplForData(EvalCtx& context) {
                     field_id, chunk_id, val1, val2, false, false);
             }
         };
+    // rows of chunks evaluated by their dictionary or skipped entirely
+    auto skip_sub_batch = [&processed_cursor](int64_t size) {
+        processed_cursor += size;
+    };
+
     int64_t processed_size;
     if (has_offset_input_) {
         processed_size = ProcessDataByOffsets<T>(execute_sub_batch,
@@ -407,8 +423,14 @@ PhyBinaryRangeFilterExpr::ExecRangeVisitorImplForData(EvalCtx& context) {
                                                  val1,
                                                  val2);
     } else {
-        processed_size = ProcessDataChunks<T>(
-            execute_sub_batch, skip_index_func, res, valid_res, val1, val2);
+        processed_size = ProcessDictionaryDataChunks<T>(execute_sub_batch,
+                                                        execute_dictionary,
+                                                        skip_sub_batch,
+                                                        skip_index_func,
+                                                        res,
+                                                        valid_res,
+                                                        val1,
+                                                        val2);
     }
     AssertInfo(processed_size == real_batch_size,
                "internal error: expr processed rows {} not equal "
@@ -16,6 +16,10 @@
 
 #include "ConjunctExpr.h"
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
 namespace milvus {
 namespace exec {
 
@@ -88,6 +92,68 @@ PhyConjunctFilterExpr::SkipFollowingExprs(int start) {
     }
 }
 
+int64_t
+PhyConjunctFilterExpr::CountUndecidedRows(ColumnVectorPtr& vec) {
+    TargetBitmapView data(vec->GetRawData(), vec->size());
+    auto set_rows = static_cast<int64_t>(data.count());
+    return is_and_ ? set_rows : vec->size() - set_rows;
+}
+
+std::vector<size_t>
+PhyConjunctFilterExpr::AdaptiveOrder(
+    const std::vector<size_t>& order,
+    const std::vector<expr::ConjunctInputStats>& stats) {
+    auto rank = [&](size_t input) {
+        if (input >= stats.size() || stats[input].input_rows == 0) {
+            return std::numeric_limits<double>::infinity();
+        }
+        const auto& s = stats[input];
+        double cost_per_row = double(s.cost_ns) / s.input_rows;
+        double decided_ratio = double(s.decided_rows) / s.input_rows;
+        return cost_per_row / std::max(decided_ratio, 1e-6);
+    };
+    std::vector<std::pair<double, size_t>> ranked;
+    ranked.reserve(order.size());
+    for (auto input : order) {
+        ranked.emplace_back(rank(input), input);
+    }
+    std::stable_sort(
+        ranked.begin(), ranked.end(), [](const auto& a, const auto& b) {
+            return a.first < b.first;
+        });
+    std::vector<size_t> new_order;
+    new_order.reserve(order.size());
+    for (auto& [_, input] : ranked) {
+        new_order.push_back(input);
+    }
+    return new_order;
+}
+
+void
+PhyConjunctFilterExpr::AdaptiveReorder() {
+    std::vector<expr::ConjunctInputStats> stats;
+    if (feedback_) {
+        std::vector<expr::ConjunctInputStats> delta(local_stats_.size());
+        for (size_t i = 0; i < local_stats_.size(); ++i) {
+            delta[i].input_rows =
+                local_stats_[i].input_rows - published_stats_[i].input_rows;
+            delta[i].decided_rows = local_stats_[i].decided_rows -
+                                    published_stats_[i].decided_rows;
+            delta[i].cost_ns =
+                local_stats_[i].cost_ns - published_stats_[i].cost_ns;
+        }
+        feedback_->Merge(delta);
+        published_stats_ = local_stats_;
+        stats = feedback_->Snapshot();
+    }
+    if (stats.size() != inputs_.size()) {
+        // no plan-wide feedback or it belongs to a different flattened
+        // layout, only trust what this segment has seen so far
+        stats = local_stats_;
+    }
+    input_order_ = AdaptiveOrder(input_order_, stats);
+}
+
 void
 PhyConjunctFilterExpr::Eval(EvalCtx& context, VectorPtr& result) {
     tracer::AutoSpan span(
@@ -100,16 +166,38 @@ PhyConjunctFilterExpr::Eval(EvalCtx& context, VectorPtr& result) {
             input_order_[i] = i;
         }
     }
+    if (adaptive_ && !feedback_applied_) {
+        // start from the order learned by segments evaluated before
+        local_stats_.resize(inputs_.size());
+        published_stats_.resize(inputs_.size());
+        AdaptiveReorder();
+        feedback_applied_ = true;
+    }
+
+    int64_t undecided_rows = 0;
     for (int i = 0; i < input_order_.size(); ++i) {
         VectorPtr input_result;
+        auto start = adaptive_ ? std::chrono::steady_clock::now()
+                               : std::chrono::steady_clock::time_point{};
         inputs_[input_order_[i]]->Eval(context, input_result);
+        if (adaptive_) {
+            local_stats_[input_order_[i]].cost_ns +=
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start)
+                    .count();
+        }
         if (i == 0) {
             result = input_result;
             auto all_flat_result = GetColumnVector(result);
+            if (adaptive_) {
+                undecided_rows = CountUndecidedRows(all_flat_result);
+                auto& stats = local_stats_[input_order_[i]];
+                stats.input_rows += all_flat_result->size();
+                stats.decided_rows += all_flat_result->size() - undecided_rows;
+            }
             if (CanSkipFollowingExprs(all_flat_result)) {
                 SkipFollowingExprs(i + 1);
-                ClearBitmapInput(context);
-                return;
+                break;
             }
             SetNextExprBitmapInput(all_flat_result, context);
             continue;
@@ -118,14 +206,24 @@ PhyConjunctFilterExpr::Eval(EvalCtx& context, VectorPtr& result) {
         auto all_flat_result = GetColumnVector(result);
         auto active_rows =
             UpdateResult(input_flat_result, context, all_flat_result);
+        if (adaptive_) {
+            auto& stats = local_stats_[input_order_[i]];
+            stats.input_rows += undecided_rows;
+            stats.decided_rows += undecided_rows - active_rows;
+            undecided_rows = active_rows;
+        }
         if (active_rows == 0) {
             SkipFollowingExprs(i + 1);
-            ClearBitmapInput(context);
-            return;
+            break;
         }
         SetNextExprBitmapInput(all_flat_result, context);
     }
     ClearBitmapInput(context);
+
+    if (adaptive_ &&
+        ++sampled_batches_ % DEFAULT_ADAPTIVE_REORDER_SAMPLE_BATCHES == 0) {
+        AdaptiveReorder();
+    }
 }
 
 }  //namespace exec
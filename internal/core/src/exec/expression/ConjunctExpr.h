@@ -18,11 +18,13 @@
 
 #include <fmt/core.h>
 
+#include "common/Common.h"
 #include "common/EasyAssert.h"
 #include "common/OpContext.h"
 #include "common/Types.h"
 #include "common/Vector.h"
 #include "exec/expression/Expr.h"
+#include "expr/ITypeExpr.h"
 #include "segcore/SegmentInterface.h"
 
 namespace milvus {
@@ -66,14 +68,18 @@ struct ConjunctElementFunc {
 
 class PhyConjunctFilterExpr : public Expr {
  public:
-    PhyConjunctFilterExpr(std::vector<ExprPtr>&& inputs,
-                          bool is_and,
-                          milvus::OpContext* op_ctx)
+    PhyConjunctFilterExpr(
+        std::vector<ExprPtr>&& inputs,
+        bool is_and,
+        milvus::OpContext* op_ctx,
+        std::shared_ptr<expr::ConjunctFeedback> feedback = nullptr)
         : Expr(DataType::BOOL,
                std::move(inputs),
                "PhyConjunctFilterExpr",
                op_ctx),
-          is_and_(is_and) {
+          is_and_(is_and),
+          feedback_(std::move(feedback)),
+          adaptive_(ADAPTIVE_CONJUNCT_REORDER_ENABLED.load()) {
         std::vector<DataType> input_types;
         input_types.reserve(inputs_.size());
 
@@ -154,6 +160,13 @@ class PhyConjunctFilterExpr : public Expr {
         return input_order_;
     }
 
+    // Sort inputs by cost_per_row / decided_ratio in ascending order, which
+    // minimizes the expected cost of a short-circuit evaluation. Inputs
+    // without samples keep their relative order behind the measured ones.
+    static std::vector<size_t>
+    AdaptiveOrder(const std::vector<size_t>& order,
+                  const std::vector<expr::ConjunctInputStats>& stats);
+
     void
     SetNextExprBitmapInput(const ColumnVectorPtr& vec, EvalCtx& context) {
         TargetBitmapView last_res_bitmap(vec->GetRawData(), vec->size());
@@ -195,9 +208,25 @@ class PhyConjunctFilterExpr : public Expr {
 
     void
     SkipFollowingExprs(int start);
+
+    int64_t
+    CountUndecidedRows(ColumnVectorPtr& vec);
+
+    void
+    AdaptiveReorder();
+
     // true if conjunction (and), false if disjunction (or).
     bool is_and_;
     std::vector<size_t> input_order_;
+
+    // adaptive reorder: local samples are flushed into the plan-wide
+    // feedback every DEFAULT_ADAPTIVE_REORDER_SAMPLE_BATCHES batches.
+    std::shared_ptr<expr::ConjunctFeedback> feedback_;
+    bool adaptive_;
+    bool feedback_applied_{false};
+    int64_t sampled_batches_{0};
+    std::vector<expr::ConjunctInputStats> local_stats_;
+    std::vector<expr::ConjunctInputStats> published_stats_;
 };
 }  //namespace exec
 }  // namespace milvus
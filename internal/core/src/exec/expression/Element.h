@@ -17,6 +17,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
 #include <string>
 
@@ -341,10 +342,260 @@ class SetElement<bool> : public MultiElement {
         return {contains_true, contains_false};
     }
 
+    bool
+    Contains(bool value) const {
+        return value ? contains_true : contains_false;
+    }
+
  private:
     bool contains_true = false;
     bool contains_false = false;
 };
 
+// Membership set for term filters on numeric and varchar columns.
+// Unlike SetElement, Contains() is non-virtual and takes the raw column
+// value, so the per-row loop neither boxes values into a variant nor makes
+// an indirect call. The probe strategy is picked once from the values:
+//   - a few values: branch-free compare against all of them
+//   - integers in a small domain: a bitmap over [min, max]
+//   - otherwise: open addressing over cache-line sized buckets whose slots
+//     are compared without branches, which compilers vectorize
+// Strings are hashed on a fingerprint of length and boundary bytes only,
+// the full compare runs just for slots whose fingerprint matches.
+template <typename T>
+class TermSetElement : public MultiElement {
+    static constexpr bool is_string_ = std::is_same_v<T, std::string> ||
+                                       std::is_same_v<T, std::string_view>;
+    static_assert(is_string_ || std::is_arithmetic_v<T>,
+                  "Type not supported in TermSetElement");
+    static_assert(!std::is_same_v<T, bool>, "use SetElement<bool> instead");
+
+    // stored key, strings are owned by the set
+    using KeyType = std::conditional_t<is_string_, std::string, T>;
+    // what is compared inside a bucket
+    using SlotType = std::conditional_t<is_string_, uint64_t, T>;
+
+ public:
+    static constexpr size_t kLinearLimit = 8;
+    static constexpr uint64_t kBitmapDomainLimit = uint64_t(1) << 18;
+    static constexpr size_t kBucketSlots =
+        std::max<size_t>(64 / sizeof(SlotType), 4);
+
+    explicit TermSetElement(const std::vector<T>& values) {
+        for (const auto& value : values) {
+            keys_.emplace_back(Normalize(value));
+        }
+        std::sort(keys_.begin(), keys_.end());
+        keys_.erase(std::unique(keys_.begin(), keys_.end()), keys_.end());
+        if constexpr (std::is_same_v<T, std::string_view>) {
+            for (const auto& key : keys_) {
+                elements_.emplace_back(key);
+            }
+        } else {
+            elements_ = keys_;
+        }
+        Build();
+    }
+
+    bool
+    Empty() const override {
+        return keys_.empty();
+    }
+
+    size_t
+    Size() const override {
+        return keys_.size();
+    }
+
+    bool
+    In(const ValueType& value) const override {
+        if constexpr (is_string_) {
+            if (std::holds_alternative<std::string>(value)) {
+                return Contains(std::get<std::string>(value));
+            }
+            if (std::holds_alternative<std::string_view>(value)) {
+                return Contains(std::get<std::string_view>(value));
+            }
+        } else if (std::holds_alternative<T>(value)) {
+            return Contains(std::get<T>(value));
+        }
+        return false;
+    }
+
+    template <typename U>
+    inline bool
+    Contains(const U& raw) const {
+        if constexpr (is_string_) {
+            std::string_view value(raw);
+            if (keys_.size() <= kLinearLimit) {
+                for (const auto& key : keys_) {
+                    if (key == value) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+            auto fp = Fingerprint(value);
+            for (auto bucket = Hash(fp);; bucket = (bucket + 1) & mask_) {
+                auto slots = &slots_[bucket * kBucketSlots];
+                auto slot_keys = &slot_keys_[bucket * kBucketSlots];
+                for (size_t i = 0; i < kBucketSlots; ++i) {
+                    if (slots[i] == fp && keys_[slot_keys[i]] == value) {
+                        return true;
+                    }
+                }
+                if (fills_[bucket] < kBucketSlots) {
+                    return false;
+                }
+            }
+        } else {
+            T value = Normalize(raw);
+            if constexpr (std::is_integral_v<T>) {
+                if (!bitmap_.empty()) {
+                    auto pos = static_cast<uint64_t>(value) -
+                               static_cast<uint64_t>(keys_.front());
+                    return pos < bitmap_domain_ &&
+                           ((bitmap_[pos >> 6] >> (pos & 63)) & 1);
+                }
+            }
+            if (keys_.size() <= kLinearLimit) {
+                bool found = false;
+                for (const auto& key : keys_) {
+                    found |= (key == value);
+                }
+                return found;
+            }
+            for (auto bucket = Hash(value);; bucket = (bucket + 1) & mask_) {
+                auto slots = &slots_[bucket * kBucketSlots];
+                bool found = false;
+                for (size_t i = 0; i < kBucketSlots; ++i) {
+                    found |= (slots[i] == value);
+                }
+                if (found) {
+                    return true;
+                }
+                if (fills_[bucket] < kBucketSlots) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    const std::vector<T>&
+    GetElements() const {
+        return elements_;
+    }
+
+ private:
+    template <typename U>
+    static KeyType
+    Normalize(const U& value) {
+        if constexpr (std::is_floating_point_v<T>) {
+            // -0.0 equals 0.0 but has other bits
+            return value == 0 ? T(0) : T(value);
+        } else {
+            return KeyType(value);
+        }
+    }
+
+    static uint64_t
+    Fingerprint(std::string_view value) {
+        uint64_t head = 0;
+        uint64_t tail = 0;
+        auto n = std::min<size_t>(value.size(), sizeof(uint64_t));
+        std::memcpy(&head, value.data(), n);
+        std::memcpy(&tail, value.data() + value.size() - n, n);
+        return (head * 0x9E3779B97F4A7C15ULL) ^
+               (tail + value.size()) * 0xC2B2AE3D27D4EB4FULL;
+    }
+
+    size_t
+    Hash(SlotType value) const {
+        uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(SlotType));
+        return static_cast<size_t>((bits * 0x9E3779B97F4A7C15ULL) >>
+                                   (64 - hash_bits_));
+    }
+
+    void
+    Build() {
+        if (keys_.empty()) {
+            return;
+        }
+        if constexpr (std::is_integral_v<T>) {
+            auto domain = static_cast<uint64_t>(keys_.back()) -
+                          static_cast<uint64_t>(keys_.front()) + 1;
+            if (keys_.size() > kLinearLimit && domain != 0 &&
+                domain <= kBitmapDomainLimit) {
+                bitmap_domain_ = domain;
+                bitmap_.assign((domain + 63) / 64, 0);
+                for (const auto& key : keys_) {
+                    auto pos = static_cast<uint64_t>(key) -
+                               static_cast<uint64_t>(keys_.front());
+                    bitmap_[pos >> 6] |= uint64_t(1) << (pos & 63);
+                }
+                return;
+            }
+        }
+        if (keys_.size() <= kLinearLimit) {
+            return;
+        }
+        // keep buckets at most half full so that overflow is rare
+        size_t buckets = 1;
+        hash_bits_ = 0;
+        while (buckets * kBucketSlots < keys_.size() * 2) {
+            buckets <<= 1;
+            hash_bits_++;
+        }
+        // at least one bit so that Hash() never shifts by 64
+        if (hash_bits_ == 0) {
+            buckets = 2;
+            hash_bits_ = 1;
+        }
+        mask_ = buckets - 1;
+        fills_.assign(buckets, 0);
+        // unused slots repeat a member, a hit on them is still correct
+        if constexpr (is_string_) {
+            slots_.assign(buckets * kBucketSlots, Fingerprint(keys_.front()));
+            slot_keys_.assign(buckets * kBucketSlots, 0);
+        } else {
+            slots_.assign(buckets * kBucketSlots, keys_.front());
+        }
+        for (size_t k = 0; k < keys_.size(); ++k) {
+            SlotType slot;
+            if constexpr (is_string_) {
+                slot = Fingerprint(keys_[k]);
+            } else {
+                slot = keys_[k];
+            }
+            auto bucket = Hash(slot);
+            while (fills_[bucket] == kBucketSlots) {
+                bucket = (bucket + 1) & mask_;
+            }
+            auto pos = bucket * kBucketSlots + fills_[bucket]++;
+            slots_[pos] = slot;
+            if constexpr (is_string_) {
+                slot_keys_[pos] = static_cast<uint32_t>(k);
+            }
+        }
+    }
+
+ private:
+    // sorted and deduplicated
+    std::vector<KeyType> keys_;
+    // keys_ as the column type, for skip index
+    std::vector<T> elements_;
+
+    std::vector<uint64_t> bitmap_;
+    uint64_t bitmap_domain_ = 0;
+
+    std::vector<SlotType> slots_;
+    // index into keys_ of every string slot
+    std::vector<uint32_t> slot_keys_;
+    std::vector<uint8_t> fills_;
+    size_t mask_ = 0;
+    int hash_bits_ = 0;
+};
+
 }  //namespace exec
 }  // namespace milvus
@@ -0,0 +1,129 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <set>
+
+#include "exec/expression/Element.h"
+
+using namespace milvus;
+using namespace milvus::exec;
+
+namespace {
+
+// checks every value in [lo, hi) and all set members against std::set
+template <typename T>
+void
+CheckTermSet(const std::vector<T>& values, int64_t lo, int64_t hi) {
+    TermSetElement<T> set(values);
+    std::set<T> expected(values.begin(), values.end());
+    ASSERT_EQ(expected.size(), set.Size());
+    ASSERT_EQ(expected.empty(), set.Empty());
+    for (auto v : values) {
+        ASSERT_TRUE(set.Contains(v));
+        ASSERT_TRUE(set.In(MultiElement::ValueType(v)));
+    }
+    for (int64_t i = lo; i < hi; ++i) {
+        auto v = static_cast<T>(i);
+        ASSERT_EQ(expected.count(v) > 0, set.Contains(v)) << i;
+    }
+}
+
+}  // namespace
+
+TEST(TermSetElement, Integral) {
+    std::default_random_engine er(42);
+    // empty, linear, bitmap and hashed layouts
+    for (size_t n : {0, 1, 5, 8, 9, 100, 3000}) {
+        std::vector<int64_t> small;
+        std::vector<int64_t> wide;
+        std::vector<int32_t> narrow;
+        for (size_t i = 0; i < n; ++i) {
+            small.push_back(static_cast<int64_t>(er() % 1000) - 500);
+            wide.push_back(static_cast<int64_t>(er() % 100000) * 100003);
+            narrow.push_back(static_cast<int32_t>(er() % 20000) * 7 - 70000);
+        }
+        CheckTermSet(small, -1000, 1000);
+        CheckTermSet(wide, -1000, 1000);
+        CheckTermSet(narrow, -80000, 80000);
+    }
+
+    std::vector<int8_t> tiny{-128, -1, 0, 3, 5, 7, 9, 11, 13, 127};
+    CheckTermSet(tiny, -128, 128);
+
+    std::vector<int64_t> extremes{std::numeric_limits<int64_t>::min(),
+                                  std::numeric_limits<int64_t>::max(),
+                                  -1,
+                                  0,
+                                  1};
+    TermSetElement<int64_t> set(extremes);
+    for (auto v : extremes) {
+        ASSERT_TRUE(set.Contains(v));
+    }
+    ASSERT_FALSE(set.Contains(2));
+    ASSERT_FALSE(set.Contains(std::numeric_limits<int64_t>::min() + 1));
+    // only matching types are members
+    ASSERT_FALSE(set.In(MultiElement::ValueType(int32_t(1))));
+}
+
+TEST(TermSetElement, FloatingPoint) {
+    std::vector<double> values;
+    for (int i = 0; i < 50; ++i) {
+        values.push_back(i * 0.5);
+    }
+    values.push_back(-0.0);
+    TermSetElement<double> set(values);
+    for (auto v : values) {
+        ASSERT_TRUE(set.Contains(v));
+    }
+    ASSERT_TRUE(set.Contains(0.0));
+    ASSERT_TRUE(set.Contains(-0.0));
+    ASSERT_FALSE(set.Contains(0.25));
+    ASSERT_FALSE(set.Contains(std::numeric_limits<double>::quiet_NaN()));
+}
+
+TEST(TermSetElement, String) {
+    std::default_random_engine er(42);
+    for (size_t n : {0, 3, 8, 9, 200}) {
+        std::vector<std::string> values;
+        for (size_t i = 0; i < n; ++i) {
+            // shared prefixes and suffixes to collide on fingerprints
+            values.push_back("prefix_" + std::to_string(er() % 1000) +
+                             "_suffix");
+        }
+        values.emplace_back("");
+        values.emplace_back("a");
+        std::set<std::string> expected(values.begin(), values.end());
+
+        TermSetElement<std::string> set(values);
+        std::vector<std::string_view> views(values.begin(), values.end());
+        TermSetElement<std::string_view> view_set(views);
+        ASSERT_EQ(expected.size(), set.Size());
+        ASSERT_EQ(expected.size(), view_set.GetElements().size());
+        for (int i = 0; i < 1000; ++i) {
+            auto v = "prefix_" + std::to_string(i) + "_suffix";
+            ASSERT_EQ(expected.count(v) > 0, set.Contains(v));
+            ASSERT_EQ(expected.count(v) > 0,
+                      view_set.Contains(std::string_view(v)));
+        }
+        ASSERT_TRUE(set.Contains(std::string("")));
+        ASSERT_TRUE(view_set.In(MultiElement::ValueType(std::string("a"))));
+        ASSERT_FALSE(set.Contains(std::string("b")));
+        ASSERT_FALSE(set.Contains(std::string("prefix_")));
+    }
+}
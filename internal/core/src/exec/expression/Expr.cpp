@@ -219,7 +219,8 @@ CompileExpression(const expr::TypedExprPtr& expr,
                 std::move(compiled_inputs),
                 casted_expr->op_type_ ==
                     milvus::expr::LogicalBinaryExpr::OpType::And,
-                op_ctx);
+                op_ctx,
+                casted_expr->feedback_);
         } else {
             result = std::make_shared<PhyLogicalBinaryExpr>(
                 compiled_inputs, casted_expr, "PhyLogicalBinaryExpr", op_ctx);
@@ -149,6 +149,11 @@ class Expr {
 
 using ExprPtr = std::shared_ptr<milvus::exec::Expr>;
 
+// sets the entries of a sorted dictionary of strings, given by pointer and
+// size, that match an expr in the bitmap
+using DictionaryMatchFunc = std::function<void(
+    const std::string_view*, int64_t, TargetBitmapView)>;
+
 /*
  * The expr has only one column.
  */
@@ -771,6 +776,10 @@ class SegmentExpr : public Expr {
     }
 
     // If process_all_chunks is true, all chunks will be processed and no inner state will be changed.
+    // If match_dictionary is set, it fills the matched entries of the dictionary of
+    // dictionary encoded string chunks, and their rows are matched by their codes.
+    // If skip_rows is set, it is called with the number of rows of a chunk
+    // func is not called for, so func can keep its cursor on the bitmap input.
     template <typename T,
               bool NeedSegmentOffsets = false,
               typename FUNC,
@@ -782,6 +791,8 @@ class SegmentExpr : public Expr {
         TargetBitmapView res,
         TargetBitmapView valid_res,
         bool process_all_chunks,
+        const DictionaryMatchFunc& match_dictionary,
+        const std::function<void(int64_t)>& skip_rows,
         ValTypes... values) {
         int64_t processed_size = 0;
 
@@ -814,10 +825,25 @@ class SegmentExpr : public Expr {
                 (!namespace_skip_func_.has_value() ||
                  !namespace_skip_func_.value()(i))) {
                 bool is_seal = false;
+                if constexpr (std::is_same_v<T, std::string_view>) {
+                    if (match_dictionary &&
+                        segment_->type() == SegmentType::Sealed) {
+                        is_seal = ProcessDictionaryChunk(match_dictionary,
+                                                         i,
+                                                         data_pos,
+                                                         size,
+                                                         res + processed_size,
+                                                         valid_res +
+                                                             processed_size);
+                        if (is_seal && skip_rows) {
+                            skip_rows(size);
+                        }
+                    }
+                }
                 if constexpr (std::is_same_v<T, std::string_view> ||
                               std::is_same_v<T, Json> ||
                               std::is_same_v<T, ArrayView>) {
-                    if (segment_->type() == SegmentType::Sealed) {
+                    if (!is_seal && segment_->type() == SegmentType::Sealed) {
                         // first is the raw data, second is valid_data
                         // use valid_data to see if raw data is null
                         auto pw = segment_->get_batch_views<T>(
@@ -876,6 +902,9 @@ class SegmentExpr : public Expr {
                     }
                 }
             } else {
+                if (skip_rows) {
+                    skip_rows(size);
+                }
                 const bool* valid_data;
                 if constexpr (std::is_same_v<T, std::string_view> ||
                               std::is_same_v<T, Json> ||
@@ -924,8 +953,14 @@ class SegmentExpr : public Expr {
         TargetBitmapView res,
         TargetBitmapView valid_res,
         ValTypes... values) {
-        return ProcessMultipleChunksCommon<T, NeedSegmentOffsets>(
-            func, skip_func, res, valid_res, false, values...);
+        return ProcessMultipleChunksCommon<T, NeedSegmentOffsets>(func,
+                                                                  skip_func,
+                                                                  res,
+                                                                  valid_res,
+                                                                  false,
+                                                                  nullptr,
+                                                                  nullptr,
+                                                                  values...);
     }
 
     template <typename T, typename FUNC, typename... ValTypes>
@@ -937,7 +972,7 @@ class SegmentExpr : public Expr {
         TargetBitmapView valid_res,
         ValTypes... values) {
         return ProcessMultipleChunksCommon<T>(
-            func, skip_func, res, valid_res, true, values...);
+            func, skip_func, res, valid_res, true, nullptr, nullptr, values...);
     }
 
     template <typename T,
@@ -960,6 +995,98 @@ class SegmentExpr : public Expr {
         }
     }
 
+    // Same as ProcessDataChunks, but a dictionary encoded string chunk of a
+    // sealed segment is evaluated on its dictionary with dictionary_func,
+    // taking the arguments of func, once for all its rows. dictionary_func
+    // must not skip rows on the bitmap input. skip_rows advances the cursor
+    // of func on the bitmap input past the rows of a chunk func is not
+    // called for, as chunks are encoded or skipped one by one.
+    template <typename T,
+              typename FUNC,
+              typename DICTIONARY_FUNC,
+              typename... ValTypes>
+    int64_t
+    ProcessDictionaryDataChunks(
+        FUNC func,
+        DICTIONARY_FUNC dictionary_func,
+        const std::function<void(int64_t)>& skip_rows,
+        std::function<bool(const milvus::SkipIndex&, FieldId, int)> skip_func,
+        TargetBitmapView res,
+        TargetBitmapView valid_res,
+        ValTypes... values) {
+        if constexpr (std::is_same_v<T, std::string_view>) {
+            if (segment_->is_chunked() &&
+                segment_->type() == SegmentType::Sealed) {
+                DictionaryMatchFunc match_dictionary =
+                    [&](const std::string_view* dictionary,
+                        int64_t dictionary_size,
+                        TargetBitmapView matched) {
+                        TargetBitmap valid(dictionary_size, true);
+                        dictionary_func(dictionary,
+                                        nullptr,
+                                        nullptr,
+                                        dictionary_size,
+                                        matched,
+                                        TargetBitmapView(valid),
+                                        values...);
+                    };
+                return ProcessMultipleChunksCommon<T>(func,
+                                                      skip_func,
+                                                      res,
+                                                      valid_res,
+                                                      false,
+                                                      match_dictionary,
+                                                      skip_rows,
+                                                      values...);
+            }
+        }
+        return ProcessDataChunks<T>(func, skip_func, res, valid_res, values...);
+    }
+
+    // Evaluates size rows from data_pos of chunk_id by their codes, when the
+    // chunk is dictionary encoded, returns false otherwise.
+    bool
+    ProcessDictionaryChunk(const DictionaryMatchFunc& match_dictionary,
+                           int64_t chunk_id,
+                           int64_t data_pos,
+                           int64_t size,
+                           TargetBitmapView res,
+                           TargetBitmapView valid_res) {
+        // whether a chunk is encoded is only asked once, most are not
+        if (dictionary_chunk_encoded_.empty()) {
+            dictionary_chunk_encoded_.resize(num_data_chunk_, true);
+        }
+        if (!dictionary_chunk_encoded_[chunk_id]) {
+            return false;
+        }
+        auto pw =
+            segment_->chunk_string_dictionary(op_ctx_, field_id_, chunk_id);
+        auto chunk = pw.get();
+        if (chunk == nullptr) {
+            dictionary_chunk_encoded_[chunk_id] = false;
+            return false;
+        }
+        if (cached_dictionary_chunk_id_ != chunk_id) {
+            auto dictionary_size = chunk->DictionarySize();
+            std::vector<std::string_view> dictionary;
+            dictionary.reserve(dictionary_size);
+            for (int64_t code = 0; code < dictionary_size; ++code) {
+                dictionary.push_back(chunk->DictionaryValue(code));
+            }
+            cached_dictionary_match_res_ = TargetBitmap(dictionary_size, false);
+            match_dictionary(dictionary.data(),
+                             dictionary_size,
+                             TargetBitmapView(cached_dictionary_match_res_));
+            cached_dictionary_chunk_id_ = chunk_id;
+        }
+        chunk->MatchCodes(cached_dictionary_match_res_, data_pos, size, res);
+        auto valid_data = chunk->ValidData();
+        if (valid_data != nullptr) {
+            ApplyValidData(valid_data + data_pos, res, valid_res, size);
+        }
+        return true;
+    }
+
     template <typename T, typename FUNC, typename... ValTypes>
     int64_t
     ProcessAllDataChunk(
@@ -1434,10 +1561,8 @@ class SegmentExpr : public Expr {
                segment_->GetJsonStats(op_ctx_, field_id).get() != nullptr;
     }
 
-    bool
-    CanUseJsonStats(EvalCtx& context,
-                    FieldId field_id,
-                    const std::vector<std::string>& nested_path) const {
+    static bool
+    IsJsonStatsPath(const std::vector<std::string>& nested_path) {
         // if path contains integer, we can't use json stats such as "a.1.b", "a.1",
         // because we can't know the integer is a key or a array indice
         auto path_contains_integer = [](const std::vector<std::string>& path) {
@@ -1451,8 +1576,25 @@ class SegmentExpr : public Expr {
 
         // if path is empty, json stats can not know key name,
         // so we can't use json shredding data
+        return !nested_path.empty() && !path_contains_integer(nested_path);
+    }
+
+    bool
+    CanUseJsonStats(EvalCtx& context,
+                    FieldId field_id,
+                    const std::vector<std::string>& nested_path) const {
         return PlanUseJsonStats(context) && HasJsonStats(field_id) &&
-               !nested_path.empty() && !path_contains_integer(nested_path);
+               IsJsonStatsPath(nested_path);
+    }
+
+    bool
+    CanUseGrowingJsonStats(EvalCtx& context,
+                           FieldId field_id,
+                           const std::vector<std::string>& nested_path) const {
+        return PlanUseJsonStats(context) &&
+               segment_->type() == SegmentType::Growing &&
+               segment_->GetGrowingJsonStats(field_id) != nullptr &&
+               IsJsonStatsPath(nested_path);
     }
 
     virtual bool
@@ -1502,6 +1644,12 @@ class SegmentExpr : public Expr {
 
     // Cache for ngram match.
     std::shared_ptr<TargetBitmap> cached_ngram_match_res_{nullptr};
+
+    // Cache for the dictionary entries matched in a dictionary encoded chunk.
+    int64_t cached_dictionary_chunk_id_{-1};
+    TargetBitmap cached_dictionary_match_res_;
+    // false for the chunks known not to be dictionary encoded
+    std::vector<bool> dictionary_chunk_encoded_;
 };
 
 bool
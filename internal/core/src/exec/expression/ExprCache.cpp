@@ -183,6 +183,68 @@ ExprResCacheManager::EraseSegment(int64_t segment_id) {
     return erased;
 }
 
+ExprResCacheManager::SharedEvaluation::SharedEvaluation(Key key)
+    : key_(std::move(key)) {
+    if (!IsEnabled()) {
+        return;
+    }
+    auto& manager = Instance();
+    Value cached;
+    if (manager.Get(key_, cached)) {
+        value_ = std::move(cached);
+        return;
+    }
+
+    std::shared_future<std::optional<Value>> inflight;
+    {
+        std::lock_guard<std::mutex> lock(manager.inflight_mutex_);
+        auto it = manager.inflight_.find(key_);
+        if (it == manager.inflight_.end()) {
+            // the evaluation may have finished since the lookup above
+            if (manager.Get(key_, cached)) {
+                value_ = std::move(cached);
+                return;
+            }
+            promise_.emplace();
+            manager.inflight_.emplace(key_, promise_->get_future().share());
+            return;
+        }
+        inflight = it->second;
+    }
+
+    LOG_DEBUG("wait for in-flight expr evaluation, segment_id: {}, key: {}",
+              key_.segment_id,
+              key_.signature);
+    value_ = inflight.get();
+}
+
+ExprResCacheManager::SharedEvaluation::~SharedEvaluation() {
+    Finish(std::nullopt);
+}
+
+void
+ExprResCacheManager::SharedEvaluation::Publish(const Value& value) {
+    // cached before leaving the in-flight map, so that a query arriving in
+    // between finds one or the other
+    Instance().Put(key_, value);
+    Finish(value);
+}
+
+void
+ExprResCacheManager::SharedEvaluation::Finish(
+    const std::optional<Value>& value) {
+    if (!promise_.has_value()) {
+        return;
+    }
+    auto& manager = Instance();
+    {
+        std::lock_guard<std::mutex> lock(manager.inflight_mutex_);
+        manager.inflight_.erase(key_);
+    }
+    promise_->set_value(value);
+    promise_.reset();
+}
+
 void
 ExprResCacheManager::Init(size_t capacity_bytes, bool enabled) {
     SetEnabled(enabled);
@@ -19,9 +19,11 @@
 #include <cstddef>
 #include <cstdint>
 #include <atomic>
+#include <future>
 #include <list>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <shared_mutex>
 #include <string>
 #include <unordered_map>
@@ -63,6 +65,42 @@ class ExprResCacheManager {
         size_t bytes{0};  // approximate size in bytes
     };
 
+    // Evaluation of a key shared by the queries evaluating it at the same
+    // time. Construction returns the cached value of the key, or waits for
+    // the query already evaluating the key and returns its value, or else
+    // claims the evaluation, leaving value() empty: the caller evaluates and
+    // hands the value to Publish, which caches it and wakes the waiting
+    // queries. A claimed evaluation destroyed without Publish, e.g. on
+    // exception, leaves the waiting queries to evaluate on their own.
+    class SharedEvaluation {
+     public:
+        explicit SharedEvaluation(Key key);
+
+        SharedEvaluation(const SharedEvaluation&) = delete;
+        SharedEvaluation&
+        operator=(const SharedEvaluation&) = delete;
+
+        ~SharedEvaluation();
+
+        const std::optional<Value>&
+        value() const {
+            return value_;
+        }
+
+        // The provided value.result must be non-null.
+        void
+        Publish(const Value& value);
+
+     private:
+        void
+        Finish(const std::optional<Value>& value);
+
+        Key key_;
+        std::optional<Value> value_;
+        // set while this evaluation is the one the others wait for
+        std::optional<std::promise<std::optional<Value>>> promise_;
+    };
+
  public:
     static ExprResCacheManager&
     Instance();
@@ -124,6 +162,13 @@ class ExprResCacheManager {
     };
 
     tbb::concurrent_unordered_map<Key, Entry, KeyHasher> concurrent_map_;
+
+    // evaluations in flight, the futures of their values
+    std::mutex inflight_mutex_;
+    std::unordered_map<Key,
+                       std::shared_future<std::optional<Value>>,
+                       KeyHasher>
+        inflight_;
 };
 
 // Helper API: erase all cache for a given segment id, returns erased entry count
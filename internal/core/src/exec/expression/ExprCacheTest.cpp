@@ -15,7 +15,11 @@
 // limitations under the License.
 
 #include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <optional>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "exec/expression/ExprCache.h"
@@ -144,3 +148,69 @@ TEST(ExprResCacheManagerTest, EnableDisable) {
     mgr.Clear();
     ExprResCacheManager::SetEnabled(false);
 }
+
+TEST(ExprResCacheManagerTest, SharedEvaluation) {
+    auto& mgr = ExprResCacheManager::Instance();
+    ExprResCacheManager::SetEnabled(true);
+    mgr.Clear();
+    mgr.SetCapacityBytes(1ULL << 20);
+
+    ExprResCacheManager::Key k{9, "expr:shared"};
+    std::atomic<int> evaluated{0};
+    std::atomic<int> shared{0};
+    auto evaluate = [&]() {
+        ExprResCacheManager::SharedEvaluation evaluation(k);
+        if (evaluation.value().has_value()) {
+            ASSERT_EQ(evaluation.value()->result->size(), 64);
+            ++shared;
+            return;
+        }
+        ++evaluated;
+        ExprResCacheManager::Value v;
+        v.result = std::make_shared<milvus::TargetBitmap>(MakeBits(64));
+        v.valid_result = std::make_shared<milvus::TargetBitmap>(MakeBits(64));
+        evaluation.Publish(v);
+    };
+
+    {
+        // claimed first, the other queries wait for it instead of evaluating
+        ExprResCacheManager::SharedEvaluation first(k);
+        ASSERT_FALSE(first.value().has_value());
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 8; ++i) {
+            threads.emplace_back(evaluate);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        ExprResCacheManager::Value v;
+        v.result = std::make_shared<milvus::TargetBitmap>(MakeBits(64));
+        v.valid_result = std::make_shared<milvus::TargetBitmap>(MakeBits(64));
+        first.Publish(v);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+    ASSERT_EQ(evaluated.load(), 0);
+    ASSERT_EQ(shared.load(), 8);
+    ExprResCacheManager::Value out;
+    ASSERT_TRUE(mgr.Get(k, out));
+
+    // an abandoned evaluation leaves the waiting queries to evaluate
+    mgr.Clear();
+    shared = 0;
+    {
+        std::optional<ExprResCacheManager::SharedEvaluation> first;
+        first.emplace(k);
+        ASSERT_FALSE(first->value().has_value());
+        std::thread waiter(evaluate);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        first.reset();
+        waiter.join();
+    }
+    ASSERT_EQ(evaluated.load(), 1);
+    ASSERT_EQ(shared.load(), 0);
+    ASSERT_TRUE(mgr.Get(k, out));
+
+    // restore global state
+    mgr.Clear();
+    ExprResCacheManager::SetEnabled(false);
+}
@@ -53,6 +53,7 @@
 #include "test_utils/storage_test_utils.h"
 #include "index/IndexFactory.h"
 #include "exec/Task.h"
+#include "exec/expression/ConjunctExpr.h"
 #include "exec/expression/function/FunctionFactory.h"
 #include "expr/ITypeExpr.h"
 #include "mmap/Types.h"
@@ -3808,6 +3809,65 @@ TEST_P(ExprTest, TestReorder) {
     final = ExecuteQueryExpr(plan, seg.get(), N, MAX_TIMESTAMP);
 }
 
+TEST_P(ExprTest, TestAdaptiveReorder) {
+    auto schema = std::make_shared<Schema>();
+    auto pk = schema->AddDebugField("id", DataType::INT64);
+    auto int64_fid = schema->AddDebugField("int64", DataType::INT64);
+    auto str1_fid = schema->AddDebugField("string1", DataType::VARCHAR);
+    schema->set_primary_field_id(pk);
+
+    auto seg = CreateSealedSegment(schema);
+    size_t N = 1000;
+    auto raw_data = DataGen(schema, N);
+    LoadGeneratedDataIntoSegment(raw_data, seg.get(), true);
+
+    // numeric range passes every row, string term filters every row
+    proto::plan::GenericValue val1;
+    val1.set_int64_val(std::numeric_limits<int64_t>::min());
+    auto expr1 = std::make_shared<expr::UnaryRangeFilterExpr>(
+        expr::ColumnInfo(int64_fid, DataType::INT64),
+        proto::plan::OpType::GreaterEqual,
+        val1,
+        std::vector<proto::plan::GenericValue>{});
+    proto::plan::GenericValue val2;
+    val2.set_string_val("not exist");
+    auto expr2 = std::make_shared<expr::UnaryRangeFilterExpr>(
+        expr::ColumnInfo(str1_fid, DataType::VARCHAR),
+        proto::plan::OpType::Equal,
+        val2,
+        std::vector<proto::plan::GenericValue>{});
+    auto expr = std::make_shared<expr::LogicalBinaryExpr>(
+        expr::LogicalBinaryExpr::OpType::And, expr1, expr2);
+    auto plan =
+        std::make_shared<plan::FilterBitsNode>(DEFAULT_PLANNODE_ID, expr);
+
+    auto prev_batch_size = EXEC_EVAL_EXPR_BATCH_SIZE.load();
+    auto prev_adaptive = ADAPTIVE_CONJUNCT_REORDER_ENABLED.load();
+    EXEC_EVAL_EXPR_BATCH_SIZE.store(100);
+    auto expected = ExecuteQueryExpr(plan, seg.get(), N, MAX_TIMESTAMP);
+    ADAPTIVE_CONJUNCT_REORDER_ENABLED.store(true);
+    auto final = ExecuteQueryExpr(plan, seg.get(), N, MAX_TIMESTAMP);
+    EXEC_EVAL_EXPR_BATCH_SIZE.store(prev_batch_size);
+    ADAPTIVE_CONJUNCT_REORDER_ENABLED.store(prev_adaptive);
+
+    EXPECT_EQ(expected.size(), final.size());
+    EXPECT_EQ(final.count(), 0);
+    for (auto i = 0; i < final.size(); i++) {
+        EXPECT_EQ(expected[i], final[i]);
+    }
+
+    auto stats = expr->feedback_->Snapshot();
+    ASSERT_EQ(stats.size(), 2);
+    EXPECT_GT(stats[0].input_rows, 0);
+    EXPECT_EQ(stats[0].decided_rows, 0);
+    EXPECT_GT(stats[1].input_rows, 0);
+    EXPECT_EQ(stats[1].decided_rows, stats[1].input_rows);
+
+    // the string term settles every row, so it must be evaluated first
+    auto order = exec::PhyConjunctFilterExpr::AdaptiveOrder({0, 1}, stats);
+    EXPECT_EQ(order, (std::vector<size_t>{1, 0}));
+}
+
 TEST_P(ExprTest, TestCompareExprNullable) {
     auto schema = std::make_shared<Schema>();
     auto vec_fid = schema->AddDebugField("fakevec", data_type, 16, metric_type);
@@ -17654,3 +17714,226 @@ TEST(ExprTest, ParseGISFunctionFilterExprsMultipleOps) {
         EXPECT_EQ(sr->total_nq_, 5) << "Failed for operation: " << op;
     }
 }
+
+class ScopedStringDictionaryMaxCardinality {
+ public:
+    explicit ScopedStringDictionaryMaxCardinality(int64_t max_cardinality)
+        : saved_(STRING_DICTIONARY_MAX_CARDINALITY.load()) {
+        STRING_DICTIONARY_MAX_CARDINALITY.store(max_cardinality);
+    }
+
+    ~ScopedStringDictionaryMaxCardinality() {
+        STRING_DICTIONARY_MAX_CARDINALITY.store(saved_);
+    }
+
+ private:
+    int64_t saved_;
+};
+
+TEST(ExprTest, SealedDictionaryEncodedString) {
+    // dictionary encoding is off by default
+    ScopedStringDictionaryMaxCardinality max_cardinality(1024);
+    auto schema = std::make_shared<Schema>();
+    auto pk_fid = schema->AddDebugField("pk", DataType::INT64);
+    auto str_fid = schema->AddDebugField("str", DataType::VARCHAR);
+    schema->set_primary_field_id(pk_fid);
+
+    const int64_t N = 1000;
+    std::vector<std::string> values = {
+        "apple", "apricot", "banana", "cherry", "fig", "grape", "pear"};
+    auto dataset = DataGen(schema, N);
+    auto str_col = dataset.raw_->mutable_fields_data()
+                       ->at(1)
+                       .mutable_scalars()
+                       ->mutable_string_data()
+                       ->mutable_data();
+    std::vector<std::string> data(N);
+    for (int i = 0; i < N; ++i) {
+        data[i] = values[(i * 5) % values.size()];
+        str_col->at(i) = data[i];
+    }
+    auto seg = CreateSealedWithFieldDataLoaded(schema, dataset);
+    ASSERT_NE(seg->chunk_string_dictionary(nullptr, str_fid, 0).get(),
+              nullptr);
+
+    auto string_value = [](const std::string& str) {
+        proto::plan::GenericValue value;
+        value.set_string_val(str);
+        return value;
+    };
+    auto check = [&](const expr::TypedExprPtr& filter,
+                     std::function<bool(int)> expected) {
+        auto plan =
+            std::make_shared<plan::FilterBitsNode>(DEFAULT_PLANNODE_ID, filter);
+        auto final = ExecuteQueryExpr(plan, seg.get(), N, MAX_TIMESTAMP);
+        ASSERT_EQ(final.size(), N);
+        for (int i = 0; i < N; ++i) {
+            ASSERT_EQ(final[i], expected(i)) << filter->ToString() << " " << i;
+        }
+    };
+    auto column = expr::ColumnInfo(str_fid, DataType::VARCHAR);
+
+    std::vector<std::pair<proto::plan::OpType, std::string>> unary_cases = {
+        {proto::plan::OpType::Equal, "cherry"},
+        {proto::plan::OpType::NotEqual, "cherry"},
+        {proto::plan::OpType::GreaterThan, "banana"},
+        {proto::plan::OpType::LessEqual, "fig"},
+        {proto::plan::OpType::PrefixMatch, "ap"},
+        {proto::plan::OpType::PostfixMatch, "e"},
+        {proto::plan::OpType::Equal, "kiwi"},
+    };
+    for (const auto& [op, str] : unary_cases) {
+        check(std::make_shared<expr::UnaryRangeFilterExpr>(
+                  column, op, string_value(str)),
+              [&, op = op, str = str](int i) {
+                  switch (op) {
+                      case proto::plan::OpType::Equal:
+                          return data[i] == str;
+                      case proto::plan::OpType::NotEqual:
+                          return data[i] != str;
+                      case proto::plan::OpType::GreaterThan:
+                          return data[i] > str;
+                      case proto::plan::OpType::LessEqual:
+                          return data[i] <= str;
+                      case proto::plan::OpType::PrefixMatch:
+                          return data[i].rfind(str, 0) == 0;
+                      default:
+                          return data[i].size() >= str.size() &&
+                                 data[i].compare(data[i].size() - str.size(),
+                                                 str.size(),
+                                                 str) == 0;
+                  }
+              });
+    }
+
+    check(std::make_shared<expr::TermFilterExpr>(
+              column,
+              std::vector<proto::plan::GenericValue>{string_value("apple"),
+                                                     string_value("fig"),
+                                                     string_value("kiwi")}),
+          [&](int i) { return data[i] == "apple" || data[i] == "fig"; });
+
+    check(std::make_shared<expr::BinaryRangeFilterExpr>(
+              column, string_value("b"), string_value("fig"), true, false),
+          [&](int i) { return data[i] >= "b" && data[i] < "fig"; });
+
+    // rows the pk filter already rules out are skipped by the string filter
+    proto::plan::GenericValue bound;
+    bound.set_int64_val(N / 2);
+    auto pks = dataset.get_col<int64_t>(pk_fid);
+    check(std::make_shared<expr::LogicalBinaryExpr>(
+              expr::LogicalBinaryExpr::OpType::And,
+              std::make_shared<expr::UnaryRangeFilterExpr>(
+                  expr::ColumnInfo(pk_fid, DataType::INT64),
+                  proto::plan::OpType::LessThan,
+                  bound),
+              std::make_shared<expr::UnaryRangeFilterExpr>(
+                  column, proto::plan::OpType::Equal, string_value("pear"))),
+          [&](int i) { return pks[i] < N / 2 && data[i] == "pear"; });
+}
+
+TEST(ExprTest, SealedMixedDictionaryEncodedChunks) {
+    ScopedStringDictionaryMaxCardinality max_cardinality(1024);
+    auto schema = std::make_shared<Schema>();
+    auto pk_fid = schema->AddDebugField("pk", DataType::INT64);
+    auto int_fid = schema->AddDebugField("int", DataType::INT64);
+    auto str_fid = schema->AddDebugField("str", DataType::VARCHAR);
+    schema->set_primary_field_id(pk_fid);
+
+    // chunks of different sizes, the second one too diverse to be encoded
+    std::vector<int64_t> chunk_rows = {300, 1500, 200, 500};
+    int64_t N = 0;
+    for (auto rows : chunk_rows) {
+        N += rows;
+    }
+    std::vector<std::string> values = {"apple", "fig", "pear"};
+    auto dataset = DataGen(schema, N);
+    auto int_col = dataset.raw_->mutable_fields_data()
+                       ->at(1)
+                       .mutable_scalars()
+                       ->mutable_long_data()
+                       ->mutable_data();
+    std::vector<int64_t> ints(N);
+    for (int i = 0; i < N; ++i) {
+        ints[i] = i % 3;
+        int_col->Set(i, ints[i]);
+    }
+    std::vector<std::string> data;
+    std::vector<FieldDataPtr> field_datas;
+    for (size_t chunk_id = 0; chunk_id < chunk_rows.size(); ++chunk_id) {
+        std::vector<std::string> chunk_data;
+        for (int64_t i = 0; i < chunk_rows[chunk_id]; ++i) {
+            auto row = static_cast<int64_t>(data.size());
+            chunk_data.push_back(chunk_id == 1 && row % 4 != 0
+                                     ? "pear_" + std::to_string(row)
+                                     : values[(row * 7) % values.size()]);
+            data.push_back(chunk_data.back());
+        }
+        auto field_data = std::make_shared<FieldData<std::string>>(
+            DataType::VARCHAR, false);
+        field_data->FillFieldData(chunk_data.data(), chunk_data.size());
+        field_datas.push_back(field_data);
+    }
+
+    auto seg = CreateSealedWithFieldDataLoaded(
+        schema, dataset, false, {str_fid.get()});
+    auto cm = milvus::storage::RemoteChunkManagerSingleton::GetInstance()
+                  .GetRemoteChunkManager();
+    auto load_info = PrepareSingleFieldInsertBinlog(kCollectionID,
+                                                    kPartitionID,
+                                                    kSegmentID,
+                                                    str_fid.get(),
+                                                    field_datas,
+                                                    cm);
+    seg->LoadFieldData(load_info);
+    ASSERT_EQ(seg->num_chunk_data(str_fid), chunk_rows.size());
+    for (size_t chunk_id = 0; chunk_id < chunk_rows.size(); ++chunk_id) {
+        ASSERT_EQ(
+            seg->chunk_string_dictionary(nullptr, str_fid, chunk_id).get() ==
+                nullptr,
+            chunk_id == 1);
+    }
+
+    auto string_value = [](const std::string& str) {
+        proto::plan::GenericValue value;
+        value.set_string_val(str);
+        return value;
+    };
+    proto::plan::GenericValue zero;
+    zero.set_int64_val(0);
+    // the int filter leaves a bitmap input the string filter skips rows on
+    auto check = [&](const expr::TypedExprPtr& filter,
+                     std::function<bool(int)> expected) {
+        auto and_expr = std::make_shared<expr::LogicalBinaryExpr>(
+            expr::LogicalBinaryExpr::OpType::And,
+            std::make_shared<expr::UnaryRangeFilterExpr>(
+                expr::ColumnInfo(int_fid, DataType::INT64),
+                proto::plan::OpType::NotEqual,
+                zero),
+            filter);
+        auto plan = std::make_shared<plan::FilterBitsNode>(DEFAULT_PLANNODE_ID,
+                                                           and_expr);
+        auto final = ExecuteQueryExpr(plan, seg.get(), N, MAX_TIMESTAMP);
+        ASSERT_EQ(final.size(), N);
+        for (int i = 0; i < N; ++i) {
+            ASSERT_EQ(final[i], ints[i] != 0 && expected(i))
+                << filter->ToString() << " " << i;
+        }
+    };
+    auto column = expr::ColumnInfo(str_fid, DataType::VARCHAR);
+
+    check(std::make_shared<expr::UnaryRangeFilterExpr>(
+              column, proto::plan::OpType::Equal, string_value("pear")),
+          [&](int i) { return data[i] == "pear"; });
+    check(std::make_shared<expr::UnaryRangeFilterExpr>(
+              column, proto::plan::OpType::PrefixMatch, string_value("pe")),
+          [&](int i) { return data[i].rfind("pe", 0) == 0; });
+    check(std::make_shared<expr::TermFilterExpr>(
+              column,
+              std::vector<proto::plan::GenericValue>{string_value("apple"),
+                                                     string_value("fig")}),
+          [&](int i) { return data[i] == "apple" || data[i] == "fig"; });
+    check(std::make_shared<expr::BinaryRangeFilterExpr>(
+              column, string_value("b"), string_value("pear"), true, false),
+          [&](int i) { return data[i] >= "b" && data[i] < "pear"; });
+}
@@ -908,6 +908,11 @@ PhyTermFilterExpr::ExecVisitorImplForData(EvalCtx& context) {
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
+    // probe the typed set directly instead of boxing every row into
+    // MultiElement::ValueType
+    using SetType = std::conditional_t<std::is_same_v<T, bool>,
+                                       SetElement<T>,
+                                       TermSetElement<T>>;
     if (!arg_inited_) {
         std::vector<T> vals;
         for (auto& val : expr_->vals_) {
@@ -919,14 +924,16 @@ PhyTermFilterExpr::ExecVisitorImplForData(EvalCtx& context) {
                 vals.emplace_back(converted_val);
             }
         }
-        arg_set_ = std::make_shared<SetElement<T>>(vals);
+        arg_set_ = std::make_shared<SetType>(vals);
         arg_inited_ = true;
     }
+    auto set = std::static_pointer_cast<SetType>(arg_set_);
+    const SetType* set_ptr = set.get();
 
     int processed_cursor = 0;
     auto execute_sub_batch =
-        [&processed_cursor, &
-         bitmap_input ]<FilterType filter_type = FilterType::sequential>(
+        [ set_ptr, &processed_cursor, &
+          bitmap_input ]<FilterType filter_type = FilterType::sequential>(
             const T* data,
             const bool* valid_data,
             const int32_t* offsets,
@@ -947,18 +954,35 @@ PhyTermFilterExpr::ExecVisitorImplForData(EvalCtx& context) {
             if (has_bitmap_input && !bitmap_input[i + processed_cursor]) {
                 continue;
             }
-            res[i] = vals->In(data[offset]);
+            res[i] = set_ptr->Contains(data[offset]);
         }
         processed_cursor += size;
     };
+    // every entry of the dictionary of a dictionary encoded chunk
+    auto execute_dictionary =
+        [set_ptr](const T* data,
+                  const bool* valid_data,
+                  const int32_t* offsets,
+                  const int size,
+                  TargetBitmapView res,
+                  TargetBitmapView valid_res,
+                  const std::shared_ptr<MultiElement>& vals) {
+            for (int i = 0; i < size; ++i) {
+                res[i] = set_ptr->Contains(data[i]);
+            }
+        };
 
-    auto set = std::static_pointer_cast<SetElement<T>>(arg_set_);
     auto skip_index_func =
         [set](const SkipIndex& skip_index, FieldId field_id, int64_t chunk_id) {
             return skip_index.CanSkipInQuery<T>(
                 field_id, chunk_id, set->GetElements());
         };
 
+    // rows of chunks evaluated by their dictionary or skipped entirely
+    auto skip_sub_batch = [&processed_cursor](int64_t size) {
+        processed_cursor += size;
+    };
+
     int64_t processed_size;
     if (has_offset_input_) {
         processed_size = ProcessDataByOffsets<T>(execute_sub_batch,
@@ -968,8 +992,13 @@ PhyTermFilterExpr::ExecVisitorImplForData(EvalCtx& context) {
                                                  valid_res,
                                                  arg_set_);
     } else {
-        processed_size = ProcessDataChunks<T>(
-            execute_sub_batch, skip_index_func, res, valid_res, arg_set_);
+        processed_size = ProcessDictionaryDataChunks<T>(execute_sub_batch,
+                                                        execute_dictionary,
+                                                        skip_sub_batch,
+                                                        skip_index_func,
+                                                        res,
+                                                        valid_res,
+                                                        arg_set_);
     }
     AssertInfo(processed_size == real_batch_size,
                "internal error: expr processed rows {} not equal "
@@ -673,6 +673,13 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJson(EvalCtx& context) {
         CanUseJsonStats(context, field_id, expr_->column_.nested_path_)) {
         return ExecRangeVisitorImplJsonByStats<ExprValueType>();
     }
+    if constexpr (!std::is_same_v<GetType, proto::plan::Array>) {
+        if (!has_offset_input_ &&
+            CanUseGrowingJsonStats(
+                context, field_id, expr_->column_.nested_path_)) {
+            return ExecRangeVisitorImplJsonByGrowingStats<ExprValueType>();
+        }
+    }
 
     auto real_batch_size =
         has_offset_input_ ? input->size() : GetNextBatchSize();
@@ -908,9 +915,7 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJson(EvalCtx& context) {
                 break;
             }
             case proto::plan::Match: {
-                PatternMatchTranslator translator;
-                auto regex_pattern = translator(val);
-                RegexMatcher matcher(regex_pattern);
+                LikePatternMatcher matcher(val);
                 for (size_t i = 0; i < size; ++i) {
                     auto offset = i;
                     if constexpr (filter_type == FilterType::random) {
@@ -983,6 +988,20 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJsonByStats() {
         return nullptr;
     }
 
+    // shared with the queries running the same filter at the same time
+    std::optional<exec::ExprResCacheManager::SharedEvaluation> evaluation;
+    if (cached_index_chunk_id_ != 0 &&
+        exec::ExprResCacheManager::IsEnabled() &&
+        segment_->type() == SegmentType::Sealed) {
+        evaluation.emplace(exec::ExprResCacheManager::Key{
+            segment_->get_segment_id(), this->ToString()});
+        if (auto& v = evaluation->value(); v.has_value()) {
+            cached_index_chunk_res_ = v->result;
+            cached_index_chunk_valid_res_ = v->valid_result;
+            cached_index_chunk_id_ = 0;
+        }
+    }
+
     if (cached_index_chunk_id_ != 0 &&
         segment_->type() == SegmentType::Sealed) {
         auto pointerpath = milvus::Json::pointer(expr_->column_.nested_path_);
@@ -1275,6 +1294,13 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJsonByStats() {
             cached_index_chunk_res_->flip();
         }
         cached_index_chunk_id_ = 0;
+        if (evaluation.has_value()) {
+            exec::ExprResCacheManager::Value v;
+            v.result = cached_index_chunk_res_;
+            v.valid_result = cached_index_chunk_valid_res_;
+            v.active_count = active_count_;
+            evaluation->Publish(v);
+        }
     }
 
     TargetBitmap result;
@@ -1285,6 +1311,141 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJsonByStats() {
                                           TargetBitmap(real_batch_size, true));
 }
 
+template <typename ExprValueType>
+VectorPtr
+PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJsonByGrowingStats() {
+    using GetType =
+        std::conditional_t<std::is_same_v<ExprValueType, std::string>,
+                           std::string_view,
+                           ExprValueType>;
+    auto real_batch_size = GetNextBatchSize();
+    if (real_batch_size == 0) {
+        return nullptr;
+    }
+
+    if (cached_index_chunk_id_ != 0) {
+        auto field_id = expr_->column_.field_id_;
+        auto pointer = milvus::Json::pointer(expr_->column_.nested_path_);
+        ExprValueType val = GetValueFromProto<ExprValueType>(expr_->val_);
+        // for NotEqual: compute Equal and flip the result, as for sealed
+        // json stats
+        auto op_type = (expr_->op_type_ == proto::plan::OpType::NotEqual)
+                           ? proto::plan::OpType::Equal
+                           : expr_->op_type_;
+        auto* stats = segment_->GetGrowingJsonStats(field_id);
+        Assert(stats != nullptr);
+        cached_index_chunk_res_ = std::make_shared<TargetBitmap>(active_count_);
+        cached_index_chunk_valid_res_ =
+            std::make_shared<TargetBitmap>(active_count_, true);
+        TargetBitmapView res_view(*cached_index_chunk_res_);
+
+        // process shredding data, each column holds the values of a single
+        // type, the rows without a value in it are false
+        auto try_execute = [&](milvus::index::JSONType json_type,
+                               auto GetType,
+                               auto executor) {
+            auto target_field = stats->GetShreddingField(pointer, json_type);
+            if (target_field.empty()) {
+                return;
+            }
+            using ColType = decltype(GetType);
+            TargetBitmap column_res(active_count_);
+            TargetBitmap column_valid_res(active_count_);
+            stats->template ExecutorForShreddingData<ColType>(
+                target_field,
+                executor,
+                TargetBitmapView(column_res),
+                TargetBitmapView(column_valid_res),
+                active_count_);
+            res_view.inplace_or_with_count(column_res, active_count_);
+        };
+        if constexpr (std::is_same_v<GetType, bool>) {
+            try_execute(milvus::index::JSONType::BOOL,
+                        bool{},
+                        ShreddingExecutor<bool, bool>(op_type, pointer, val));
+        } else if constexpr (std::is_same_v<GetType, int64_t>) {
+            try_execute(
+                milvus::index::JSONType::INT64,
+                int64_t{},
+                ShreddingExecutor<int64_t, int64_t>(op_type, pointer, val));
+            try_execute(
+                milvus::index::JSONType::DOUBLE,
+                double{},
+                ShreddingExecutor<double, int64_t>(op_type, pointer, val));
+        } else if constexpr (std::is_same_v<GetType, double>) {
+            try_execute(
+                milvus::index::JSONType::DOUBLE,
+                double{},
+                ShreddingExecutor<double, double>(op_type, pointer, val));
+            // compare the int64 values as doubles, a double value cast to
+            // int64 would change the result of range compares
+            auto int64_executor = [op_type, val](const int64_t* src,
+                                                 const bool* valid,
+                                                 size_t size,
+                                                 TargetBitmapView res,
+                                                 TargetBitmapView valid_res) {
+                for (size_t i = 0; i < size; ++i) {
+                    res[i] = valid[i] && UnaryCompare(static_cast<double>(src[i]),
+                                                      val,
+                                                      op_type);
+                }
+            };
+            try_execute(
+                milvus::index::JSONType::INT64, int64_t{}, int64_executor);
+        } else if constexpr (std::is_same_v<GetType, std::string_view>) {
+            try_execute(milvus::index::JSONType::STRING,
+                        std::string_view{},
+                        ShreddingExecutor<std::string_view, std::string_view>(
+                            op_type, pointer, val));
+        }
+
+        // process shared data, the values of keys that were not shredded are
+        // read from the raw json of their rows
+        auto shared_rows = stats->GetSharedRows(pointer, active_count_);
+        segment_->BulkGetJsonData(
+            op_ctx_,
+            field_id,
+            [&](const milvus::Json& json, size_t i, bool valid) {
+                if (!valid) {
+                    return;
+                }
+                auto row = shared_rows[i];
+                auto x = json.template at<GetType>(pointer);
+                if (x.error()) {
+                    if constexpr (std::is_same_v<GetType, int64_t>) {
+                        auto x = json.template at<double>(pointer);
+                        res_view[row] =
+                            !x.error() && UnaryCompare(x.value(), val, op_type);
+                    }
+                    return;
+                }
+                res_view[row] = UnaryCompare(x.value(), val, op_type);
+            },
+            shared_rows.data(),
+            shared_rows.size());
+
+        // for NotEqual: flip the result
+        if (expr_->op_type_ == proto::plan::OpType::NotEqual) {
+            cached_index_chunk_res_->flip();
+        }
+        for (auto row : stats->GetNullRows(active_count_)) {
+            (*cached_index_chunk_valid_res_)[row] = false;
+        }
+        cached_index_chunk_id_ = 0;
+    }
+
+    TargetBitmap result;
+    result.append(
+        *cached_index_chunk_res_, current_data_global_pos_, real_batch_size);
+    TargetBitmap valid_result;
+    valid_result.append(*cached_index_chunk_valid_res_,
+                        current_data_global_pos_,
+                        real_batch_size);
+    MoveCursor();
+    return std::make_shared<ColumnVector>(std::move(result),
+                                          std::move(valid_result));
+}
+
 template <typename T>
 VectorPtr
 PhyUnaryRangeFilterExpr::ExecRangeVisitorImpl(EvalCtx& context) {
@@ -1550,155 +1711,173 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplForData(EvalCtx& context) {
     auto expr_type = expr_->op_type_;
 
     size_t processed_cursor = 0;
-    auto execute_sub_batch =
-        [ expr_type, &processed_cursor, &
-          bitmap_input ]<FilterType filter_type = FilterType::sequential>(
-            const T* data,
-            const bool* valid_data,
-            const int32_t* offsets,
-            const int size,
-            TargetBitmapView res,
-            TargetBitmapView valid_res,
-            IndexInnerType val) {
-        switch (expr_type) {
-            case proto::plan::GreaterThan: {
-                UnaryElementFunc<T, proto::plan::GreaterThan, filter_type> func;
-                func(data,
-                     size,
-                     val,
-                     res,
-                     bitmap_input,
-                     processed_cursor,
-                     offsets);
-                break;
-            }
-            case proto::plan::GreaterEqual: {
-                UnaryElementFunc<T, proto::plan::GreaterEqual, filter_type>
-                    func;
-                func(data,
-                     size,
-                     val,
-                     res,
-                     bitmap_input,
-                     processed_cursor,
-                     offsets);
-                break;
-            }
-            case proto::plan::LessThan: {
-                UnaryElementFunc<T, proto::plan::LessThan, filter_type> func;
-                func(data,
-                     size,
-                     val,
-                     res,
-                     bitmap_input,
-                     processed_cursor,
-                     offsets);
-                break;
-            }
-            case proto::plan::LessEqual: {
-                UnaryElementFunc<T, proto::plan::LessEqual, filter_type> func;
-                func(data,
-                     size,
-                     val,
-                     res,
-                     bitmap_input,
-                     processed_cursor,
-                     offsets);
-                break;
-            }
-            case proto::plan::Equal: {
-                UnaryElementFunc<T, proto::plan::Equal, filter_type> func;
-                func(data,
-                     size,
-                     val,
-                     res,
-                     bitmap_input,
-                     processed_cursor,
-                     offsets);
-                break;
-            }
-            case proto::plan::NotEqual: {
-                UnaryElementFunc<T, proto::plan::NotEqual, filter_type> func;
-                func(data,
-                     size,
-                     val,
-                     res,
-                     bitmap_input,
-                     processed_cursor,
-                     offsets);
-                break;
-            }
-            case proto::plan::PrefixMatch: {
-                UnaryElementFunc<T, proto::plan::PrefixMatch, filter_type> func;
-                func(data,
-                     size,
-                     val,
-                     res,
-                     bitmap_input,
-                     processed_cursor,
-                     offsets);
-                break;
-            }
-            case proto::plan::PostfixMatch: {
-                UnaryElementFunc<T, proto::plan::PostfixMatch, filter_type>
-                    func;
-                func(data,
-                     size,
-                     val,
-                     res,
-                     bitmap_input,
-                     processed_cursor,
-                     offsets);
-                break;
-            }
-            case proto::plan::InnerMatch: {
-                UnaryElementFunc<T, proto::plan::InnerMatch, filter_type> func;
-                func(data,
-                     size,
-                     val,
-                     res,
-                     bitmap_input,
-                     processed_cursor,
-                     offsets);
-                break;
-            }
-            case proto::plan::Match: {
-                UnaryElementFunc<T, proto::plan::Match, filter_type> func;
-                func(data,
-                     size,
-                     val,
-                     res,
-                     bitmap_input,
-                     processed_cursor,
-                     offsets);
-                break;
-            }
-            default:
-                ThrowInfo(
-                    OpTypeInvalid,
-                    fmt::format("unsupported operator type for unary expr: {}",
-                                expr_type));
-        }
-        // there is a batch operation in BinaryRangeElementFunc,
-        // so not divide data again for the reason that it may reduce performance if the null distribution is scattered
-        // but to mask res with valid_data after the batch operation.
-        if (valid_data != nullptr) {
-            bool has_bitmap_input = !bitmap_input.empty();
-            for (int i = 0; i < size; i++) {
-                if (has_bitmap_input && !bitmap_input[i + processed_cursor]) {
-                    continue;
+    // the dictionary of a dictionary encoded chunk is evaluated with a sub
+    // batch of its own, which does not skip entries on bitmap_input
+    auto make_sub_batch = [expr_type](const TargetBitmap& bitmap_input,
+                                      size_t& processed_cursor) {
+        return [ expr_type, &processed_cursor, &
+                 bitmap_input ]<FilterType filter_type =
+                                    FilterType::sequential>(
+                   const T* data,
+                   const bool* valid_data,
+                   const int32_t* offsets,
+                   const int size,
+                   TargetBitmapView res,
+                   TargetBitmapView valid_res,
+                   IndexInnerType val) {
+            switch (expr_type) {
+                case proto::plan::GreaterThan: {
+                    UnaryElementFunc<T, proto::plan::GreaterThan, filter_type>
+                        func;
+                    func(data,
+                         size,
+                         val,
+                         res,
+                         bitmap_input,
+                         processed_cursor,
+                         offsets);
+                    break;
+                }
+                case proto::plan::GreaterEqual: {
+                    UnaryElementFunc<T, proto::plan::GreaterEqual, filter_type>
+                        func;
+                    func(data,
+                         size,
+                         val,
+                         res,
+                         bitmap_input,
+                         processed_cursor,
+                         offsets);
+                    break;
+                }
+                case proto::plan::LessThan: {
+                    UnaryElementFunc<T, proto::plan::LessThan, filter_type>
+                        func;
+                    func(data,
+                         size,
+                         val,
+                         res,
+                         bitmap_input,
+                         processed_cursor,
+                         offsets);
+                    break;
+                }
+                case proto::plan::LessEqual: {
+                    UnaryElementFunc<T, proto::plan::LessEqual, filter_type>
+                        func;
+                    func(data,
+                         size,
+                         val,
+                         res,
+                         bitmap_input,
+                         processed_cursor,
+                         offsets);
+                    break;
+                }
+                case proto::plan::Equal: {
+                    UnaryElementFunc<T, proto::plan::Equal, filter_type> func;
+                    func(data,
+                         size,
+                         val,
+                         res,
+                         bitmap_input,
+                         processed_cursor,
+                         offsets);
+                    break;
+                }
+                case proto::plan::NotEqual: {
+                    UnaryElementFunc<T, proto::plan::NotEqual, filter_type>
+                        func;
+                    func(data,
+                         size,
+                         val,
+                         res,
+                         bitmap_input,
+                         processed_cursor,
+                         offsets);
+                    break;
+                }
+                case proto::plan::PrefixMatch: {
+                    UnaryElementFunc<T, proto::plan::PrefixMatch, filter_type>
+                        func;
+                    func(data,
+                         size,
+                         val,
+                         res,
+                         bitmap_input,
+                         processed_cursor,
+                         offsets);
+                    break;
+                }
+                case proto::plan::PostfixMatch: {
+                    UnaryElementFunc<T, proto::plan::PostfixMatch, filter_type>
+                        func;
+                    func(data,
+                         size,
+                         val,
+                         res,
+                         bitmap_input,
+                         processed_cursor,
+                         offsets);
+                    break;
+                }
+                case proto::plan::InnerMatch: {
+                    UnaryElementFunc<T, proto::plan::InnerMatch, filter_type>
+                        func;
+                    func(data,
+                         size,
+                         val,
+                         res,
+                         bitmap_input,
+                         processed_cursor,
+                         offsets);
+                    break;
                 }
-                auto offset = i;
-                if constexpr (filter_type == FilterType::random) {
-                    offset = (offsets) ? offsets[i] : i;
+                case proto::plan::Match: {
+                    UnaryElementFunc<T, proto::plan::Match, filter_type> func;
+                    func(data,
+                         size,
+                         val,
+                         res,
+                         bitmap_input,
+                         processed_cursor,
+                         offsets);
+                    break;
                 }
-                if (!valid_data[offset]) {
-                    res[i] = valid_res[i] = false;
+                default:
+                    ThrowInfo(
+                        OpTypeInvalid,
+                        fmt::format(
+                            "unsupported operator type for unary expr: {}",
+                            expr_type));
+            }
+            // there is a batch operation in BinaryRangeElementFunc,
+            // so not divide data again for the reason that it may reduce performance if the null distribution is scattered
+            // but to mask res with valid_data after the batch operation.
+            if (valid_data != nullptr) {
+                bool has_bitmap_input = !bitmap_input.empty();
+                for (int i = 0; i < size; i++) {
+                    if (has_bitmap_input &&
+                        !bitmap_input[i + processed_cursor]) {
+                        continue;
+                    }
+                    auto offset = i;
+                    if constexpr (filter_type == FilterType::random) {
+                        offset = (offsets) ? offsets[i] : i;
+                    }
+                    if (!valid_data[offset]) {
+                        res[i] = valid_res[i] = false;
+                    }
                 }
             }
-        }
-        processed_cursor += size;
+            processed_cursor += size;
+        };
     };
+    auto execute_sub_batch = make_sub_batch(bitmap_input, processed_cursor);
+    TargetBitmap no_bitmap_input;
+    size_t dictionary_cursor = 0;
+    auto execute_dictionary =
+        make_sub_batch(no_bitmap_input, dictionary_cursor);
 
     auto skip_index_func = [expr_type, val](const SkipIndex& skip_index,
                                             FieldId field_id,
@@ -1707,13 +1886,23 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplForData(EvalCtx& context) {
             field_id, chunk_id, expr_type, val);
     };
 
+    // rows of chunks evaluated by their dictionary or skipped entirely
+    auto skip_sub_batch = [&processed_cursor](int64_t size) {
+        processed_cursor += size;
+    };
+
     int64_t processed_size;
     if (has_offset_input_) {
         processed_size = ProcessDataByOffsets<T>(
             execute_sub_batch, skip_index_func, input, res, valid_res, val);
     } else {
-        processed_size = ProcessDataChunks<T>(
-            execute_sub_batch, skip_index_func, res, valid_res, val);
+        processed_size = ProcessDictionaryDataChunks<T>(execute_sub_batch,
+                                                        execute_dictionary,
+                                                        skip_sub_batch,
+                                                        skip_index_func,
+                                                        res,
+                                                        valid_res,
+                                                        val);
     }
     AssertInfo(processed_size == real_batch_size,
                "internal error: expr processed rows {} not equal "
@@ -1779,16 +1968,17 @@ PhyUnaryRangeFilterExpr::ExecTextMatch() {
     }
     auto op_type = expr_->op_type_;
 
-    // Process-level LRU cache lookup by (segment_id, expr signature)
+    // Process-level LRU cache lookup by (segment_id, expr signature), shared
+    // with the queries evaluating the same match at the same time
+    std::optional<exec::ExprResCacheManager::SharedEvaluation> evaluation;
     if (cached_match_res_ == nullptr &&
         exec::ExprResCacheManager::IsEnabled() &&
         segment_->type() == SegmentType::Sealed) {
-        exec::ExprResCacheManager::Key key{segment_->get_segment_id(),
-                                           this->ToString()};
-        exec::ExprResCacheManager::Value v;
-        if (exec::ExprResCacheManager::Instance().Get(key, v)) {
-            cached_match_res_ = v.result;
-            cached_index_chunk_valid_res_ = v.valid_result;
+        evaluation.emplace(exec::ExprResCacheManager::Key{
+            segment_->get_segment_id(), this->ToString()});
+        if (auto& v = evaluation->value(); v.has_value()) {
+            cached_match_res_ = v->result;
+            cached_index_chunk_valid_res_ = v->valid_result;
             AssertInfo(cached_match_res_->size() == active_count_,
                        "internal error: expr res cache size {} not equal "
                        "expect active count {}",
@@ -1840,15 +2030,12 @@ PhyUnaryRangeFilterExpr::ExecTextMatch() {
         }
 
         // Insert into process-level cache
-        if (exec::ExprResCacheManager::IsEnabled() &&
-            segment_->type() == SegmentType::Sealed) {
-            exec::ExprResCacheManager::Key key{segment_->get_segment_id(),
-                                               this->ToString()};
+        if (evaluation.has_value()) {
             exec::ExprResCacheManager::Value v;
             v.result = cached_match_res_;
             v.valid_result = cached_index_chunk_valid_res_;
             v.active_count = active_count_;
-            exec::ExprResCacheManager::Instance().Put(key, v);
+            evaluation->Publish(v);
         }
     }
 
@@ -1882,6 +2069,19 @@ PhyUnaryRangeFilterExpr::ExecNgramMatch() {
         return std::nullopt;
     }
 
+    // shared with the queries running the same match at the same time
+    std::optional<exec::ExprResCacheManager::SharedEvaluation> evaluation;
+    if (cached_ngram_match_res_ == nullptr &&
+        exec::ExprResCacheManager::IsEnabled() &&
+        segment_->type() == SegmentType::Sealed) {
+        evaluation.emplace(exec::ExprResCacheManager::Key{
+            segment_->get_segment_id(), this->ToString()});
+        if (auto& v = evaluation->value(); v.has_value()) {
+            cached_ngram_match_res_ = v->result;
+            cached_index_chunk_valid_res_ = v->valid_result;
+        }
+    }
+
     if (cached_ngram_match_res_ == nullptr) {
         auto index = pinned_ngram_index_.get();
         AssertInfo(index != nullptr,
@@ -1895,6 +2095,13 @@ PhyUnaryRangeFilterExpr::ExecNgramMatch() {
             std::make_shared<TargetBitmap>(std::move(res_opt.value()));
         cached_index_chunk_valid_res_ =
             std::make_shared<TargetBitmap>(std::move(index->IsNotNull()));
+        if (evaluation.has_value()) {
+            exec::ExprResCacheManager::Value v;
+            v.result = cached_ngram_match_res_;
+            v.valid_result = cached_index_chunk_valid_res_;
+            v.active_count = active_count_;
+            evaluation->Publish(v);
+        }
     }
 
     TargetBitmap result;
@@ -65,9 +65,7 @@ UnaryCompare(const T& get_value, const U& val, proto::plan::OpType op_type) {
         case proto::plan::Match:
             if constexpr (std::is_same_v<U, std::string> ||
                           std::is_same_v<U, std::string_view>) {
-                PatternMatchTranslator translator;
-                auto regex_pattern = translator(val);
-                RegexMatcher matcher(regex_pattern);
+                LikePatternMatcher matcher(val);
                 return matcher(get_value);
             } else {
                 return false;
@@ -92,9 +90,7 @@ struct UnaryElementFuncForMatch {
             "this override operator() of UnaryElementFuncForMatch does "
             "not support FilterType::random");
 
-        PatternMatchTranslator translator;
-        auto regex_pattern = translator(val);
-        RegexMatcher matcher(regex_pattern);
+        LikePatternMatcher matcher(val);
 
         for (int i = 0; i < size; ++i) {
             res[i] = matcher(src[i]);
@@ -109,9 +105,7 @@ struct UnaryElementFuncForMatch {
                const TargetBitmap& bitmap_input,
                int start_cursor,
                const int32_t* offsets = nullptr) {
-        PatternMatchTranslator translator;
-        auto regex_pattern = translator(val);
-        RegexMatcher matcher(regex_pattern);
+        LikePatternMatcher matcher(val);
         bool has_bitmap_input = !bitmap_input.empty();
         for (int i = 0; i < size; ++i) {
             if (has_bitmap_input && !bitmap_input[i + start_cursor]) {
@@ -406,9 +400,7 @@ struct UnaryElementFuncForArray {
                         res[i] = false;
                         continue;
                     }
-                    PatternMatchTranslator translator;
-                    auto regex_pattern = translator(val);
-                    RegexMatcher matcher(regex_pattern);
+                    LikePatternMatcher matcher(val);
                     auto array_data =
                         src[offset].template get_data<GetType>(index);
                     res[i] = matcher(array_data);
@@ -464,9 +456,7 @@ struct UnaryIndexFuncForMatch {
                 }
                 return res;
             } else {
-                PatternMatchTranslator translator;
-                auto regex_pattern = translator(val);
-                RegexMatcher matcher(regex_pattern);
+                LikePatternMatcher matcher(val);
                 for (int64_t i = 0; i < cnt; i++) {
                     auto raw = index->Reverse_Lookup(i);
                     if (!raw.has_value()) {
@@ -608,9 +598,7 @@ BatchUnaryCompare(const T* src,
         case proto::plan::Match: {
             if constexpr (std::is_same_v<U, std::string> ||
                           std::is_same_v<U, std::string_view>) {
-                PatternMatchTranslator translator;
-                auto regex_pattern = translator(val);
-                RegexMatcher matcher(regex_pattern);
+                LikePatternMatcher matcher(val);
                 for (int i = 0; i < size; ++i) {
                     res[i] = matcher(src[i]);
                 }
@@ -844,6 +832,10 @@ class PhyUnaryRangeFilterExpr : public SegmentExpr {
     VectorPtr
     ExecRangeVisitorImplJsonByStats();
 
+    template <typename ExprValueType>
+    VectorPtr
+    ExecRangeVisitorImplJsonByGrowingStats();
+
     template <typename T>
     VectorPtr
     ExecRangeVisitorImplForPk(EvalCtx& context);
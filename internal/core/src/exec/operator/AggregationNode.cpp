@@ -0,0 +1,325 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "AggregationNode.h"
+
+#include <unordered_map>
+
+#include "common/Json.h"
+#include "common/Tracer.h"
+#include "fmt/format.h"
+
+namespace milvus {
+namespace exec {
+
+namespace {
+
+// values of one column for the rows of a batch, integer and floating point
+// columns are kept unboxed so that SUM and AVG add them up directly
+struct BatchColumn {
+    enum class Kind { kInt, kFloat, kValue };
+
+    Kind kind = Kind::kValue;
+    std::vector<int64_t> ints;
+    std::vector<double> floats;
+    std::vector<AggregateValue> values;
+    // empty if the column has no nulls
+    std::vector<bool> valid;
+
+    bool
+    IsNull(int64_t i) const {
+        return !valid.empty() && !valid[i];
+    }
+
+    AggregateValue
+    Value(int64_t i) const {
+        if (IsNull(i)) {
+            return {};
+        }
+        switch (kind) {
+            case Kind::kInt:
+                return ints[i];
+            case Kind::kFloat:
+                return floats[i];
+            default:
+                return values[i];
+        }
+    }
+};
+
+AggregateValue
+JsonValue(const std::string& data, const std::string& pointer) {
+    Json json(simdjson::padded_string(data));
+    auto doc = json.dom_doc();
+    if (doc.error() != simdjson::SUCCESS) {
+        return {};
+    }
+    auto element = pointer.empty() ? doc : doc.at_pointer(pointer);
+    if (element.error() != simdjson::SUCCESS) {
+        return {};
+    }
+    auto value = element.value();
+    switch (value.type()) {
+        case simdjson::dom::element_type::INT64:
+            return value.get_int64().value();
+        case simdjson::dom::element_type::UINT64:
+            return static_cast<double>(value.get_uint64().value());
+        case simdjson::dom::element_type::DOUBLE:
+            return value.get_double().value();
+        case simdjson::dom::element_type::STRING:
+            return std::string(value.get_string().value());
+        case simdjson::dom::element_type::BOOL:
+            return value.get_bool().value();
+        default:
+            // objects, arrays and nulls neither group nor aggregate
+            return {};
+    }
+}
+
+BatchColumn
+ExtractColumn(const DataArray& data,
+              const expr::ColumnInfo& column,
+              int64_t count) {
+    BatchColumn result;
+    auto& scalars = data.scalars();
+    switch (column.data_type_) {
+        case DataType::BOOL:
+            result.kind = BatchColumn::Kind::kInt;
+            result.ints.assign(scalars.bool_data().data().begin(),
+                               scalars.bool_data().data().end());
+            break;
+        case DataType::INT8:
+        case DataType::INT16:
+        case DataType::INT32:
+            result.kind = BatchColumn::Kind::kInt;
+            result.ints.assign(scalars.int_data().data().begin(),
+                               scalars.int_data().data().end());
+            break;
+        case DataType::INT64:
+        case DataType::TIMESTAMPTZ:
+            result.kind = BatchColumn::Kind::kInt;
+            result.ints.assign(scalars.long_data().data().begin(),
+                               scalars.long_data().data().end());
+            break;
+        case DataType::FLOAT:
+            result.kind = BatchColumn::Kind::kFloat;
+            result.floats.assign(scalars.float_data().data().begin(),
+                                 scalars.float_data().data().end());
+            break;
+        case DataType::DOUBLE:
+            result.kind = BatchColumn::Kind::kFloat;
+            result.floats.assign(scalars.double_data().data().begin(),
+                                 scalars.double_data().data().end());
+            break;
+        case DataType::VARCHAR:
+        case DataType::STRING:
+        case DataType::TEXT:
+            result.values.assign(scalars.string_data().data().begin(),
+                                 scalars.string_data().data().end());
+            break;
+        case DataType::JSON: {
+            auto pointer = Json::pointer(column.nested_path_);
+            result.values.reserve(count);
+            for (auto& json : scalars.json_data().data()) {
+                result.values.emplace_back(JsonValue(json, pointer));
+            }
+            break;
+        }
+        default:
+            ThrowInfo(DataTypeInvalid,
+                      "unsupported data type {} for aggregation",
+                      column.data_type_);
+    }
+    if (data.valid_data_size() > 0) {
+        result.valid.assign(data.valid_data().begin(),
+                            data.valid_data().end());
+    }
+    return result;
+}
+
+}  // namespace
+
+PhyAggregationNode::PhyAggregationNode(
+    int32_t operator_id,
+    DriverContext* driverctx,
+    const std::shared_ptr<const plan::AggregationNode>& node)
+    : Operator(driverctx,
+               node->output_type(),
+               operator_id,
+               node->id(),
+               "PhyAggregationNode"),
+      group_by_(node->group_by()),
+      aggregates_(node->aggregates()) {
+    ExecContext* exec_context = operator_context_->get_exec_context();
+    query_context_ = exec_context->get_query_context();
+    segment_ = query_context_->get_segment();
+}
+
+void
+PhyAggregationNode::AddInput(RowVectorPtr& input) {
+    input_ = std::move(input);
+}
+
+void
+PhyAggregationNode::AggregateBatch(const int64_t* offsets,
+                                   int64_t count,
+                                   AggregationResult& result) const {
+    // each field is read once per batch, however many keys and aggregates
+    // refer to it
+    std::unordered_map<int64_t, std::unique_ptr<DataArray>> fields;
+    auto extract = [&](const expr::ColumnInfo& column) {
+        auto& data = fields[column.field_id_.get()];
+        if (data == nullptr) {
+            data = segment_->bulk_subscript(query_context_->get_op_context(),
+                                            column.field_id_,
+                                            offsets,
+                                            count);
+        }
+        return ExtractColumn(*data, column, count);
+    };
+
+    std::vector<BatchColumn> keys;
+    keys.reserve(group_by_.size());
+    for (auto& column : group_by_) {
+        keys.emplace_back(extract(column));
+    }
+    std::vector<BatchColumn> columns(aggregates_.size());
+    for (size_t j = 0; j < aggregates_.size(); ++j) {
+        if (aggregates_[j].column.has_value()) {
+            columns[j] = extract(aggregates_[j].column.value());
+        }
+    }
+
+    std::vector<int64_t> groups(count, 0);
+    if (!keys.empty()) {
+        GroupKey key(keys.size());
+        for (int64_t i = 0; i < count; ++i) {
+            for (size_t k = 0; k < keys.size(); ++k) {
+                key[k] = keys[k].Value(i);
+            }
+            groups[i] = result.FindOrAddGroup(key);
+        }
+    }
+
+    // one pass per aggregate, so the column kind dispatch is out of the
+    // row loop
+    for (size_t j = 0; j < aggregates_.size(); ++j) {
+        auto function = aggregates_[j].function;
+        if (!aggregates_[j].column.has_value()) {
+            for (int64_t i = 0; i < count; ++i) {
+                ++result.state(groups[i], j).count;
+            }
+            continue;
+        }
+        auto& column = columns[j];
+        switch (column.kind) {
+            case BatchColumn::Kind::kInt:
+                for (int64_t i = 0; i < count; ++i) {
+                    if (!column.IsNull(i)) {
+                        result.state(groups[i], j)
+                            .AddInt(function, column.ints[i]);
+                    }
+                }
+                break;
+            case BatchColumn::Kind::kFloat:
+                for (int64_t i = 0; i < count; ++i) {
+                    if (!column.IsNull(i)) {
+                        result.state(groups[i], j)
+                            .AddFloat(function, column.floats[i]);
+                    }
+                }
+                break;
+            default: {
+                bool numeric_only = function == AggregateFunction::kSum ||
+                                    function == AggregateFunction::kAvg;
+                for (int64_t i = 0; i < count; ++i) {
+                    if (column.IsNull(i)) {
+                        continue;
+                    }
+                    auto& value = column.values[i];
+                    if (std::holds_alternative<std::monostate>(value)) {
+                        continue;
+                    }
+                    if (numeric_only &&
+                        !std::holds_alternative<int64_t>(value) &&
+                        !std::holds_alternative<double>(value)) {
+                        continue;
+                    }
+                    auto& state = result.state(groups[i], j);
+                    ++state.count;
+                    state.Add(function, value);
+                }
+            }
+        }
+    }
+}
+
+RowVectorPtr
+PhyAggregationNode::GetOutput() {
+    if (is_finished_ || !no_more_input_) {
+        return nullptr;
+    }
+    tracer::AutoSpan span(
+        "PhyAggregationNode::Execute", tracer::GetRootSpan(), true);
+    auto col_input = GetColumnVector(input_);
+    TargetBitmapView view(col_input->GetRawData(), col_input->size());
+
+    std::vector<AggregateFunction> functions;
+    for (auto& aggregate : aggregates_) {
+        functions.push_back(aggregate.function);
+    }
+    auto result = std::make_shared<AggregationResult>(std::move(functions));
+    if (group_by_.empty()) {
+        // a single group, which aggregates to COUNT 0 without any row
+        result->FindOrAddGroup({});
+    }
+
+    auto batch_size = query_context_->query_config()->get_expr_batch_size();
+    std::vector<int64_t> offsets;
+    offsets.reserve(batch_size);
+    // note: false means the row is hit
+    auto row = view.find_first(false);
+    while (row.has_value()) {
+        offsets.push_back(row.value());
+        if (static_cast<int64_t>(offsets.size()) == batch_size) {
+            AggregateBatch(offsets.data(), offsets.size(), *result);
+            offsets.clear();
+        }
+        row = view.find_next(row.value(), false);
+    }
+    if (!offsets.empty()) {
+        AggregateBatch(offsets.data(), offsets.size(), *result);
+    }
+
+    RetrieveResult retrieve_result;
+    retrieve_result.total_data_cnt_ = view.size();
+    retrieve_result.has_more_result = false;
+    retrieve_result.aggregation_result_ = result;
+    query_context_->set_retrieve_result(std::move(retrieve_result));
+    is_finished_ = true;
+
+    tracer::AddEvent(
+        fmt::format("aggregation_groups: {}", result->num_groups()));
+    return input_;
+}
+
+bool
+PhyAggregationNode::IsFinished() {
+    return is_finished_;
+}
+
+}  // namespace exec
+}  // namespace milvus
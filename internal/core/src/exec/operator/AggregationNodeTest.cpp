@@ -0,0 +1,248 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <map>
+#include <set>
+
+#include "common/Aggregation.h"
+#include "common/Types.h"
+#include "plan/PlanNode.h"
+#include "query/ExecPlanNodeVisitor.h"
+#include "test_utils/DataGen.h"
+#include "test_utils/storage_test_utils.h"
+
+using namespace milvus;
+using namespace milvus::segcore;
+
+namespace {
+
+RetrieveResult
+Aggregate(const SegmentInternalInterface& segment,
+          std::vector<expr::ColumnInfo> group_by,
+          std::vector<plan::Aggregate> aggregates) {
+    std::vector<plan::PlanNodePtr> sources{
+        std::make_shared<plan::MvccNode>("0")};
+    query::RetrievePlanNode node;
+    node.plannodes_ = std::make_shared<plan::AggregationNode>(
+        "1", std::move(group_by), std::move(aggregates), sources);
+    query::ExecPlanNodeVisitor visitor(segment, MAX_TIMESTAMP);
+    return visitor.get_retrieve_result(node);
+}
+
+}  // namespace
+
+TEST(AggregationNode, GroupBy) {
+    auto schema = std::make_shared<Schema>();
+    auto pk_fid = schema->AddDebugField("pk", DataType::INT64);
+    schema->set_primary_field_id(pk_fid);
+    auto tenant_fid = schema->AddDebugField("tenant", DataType::INT64);
+    auto price_fid = schema->AddDebugField("price", DataType::DOUBLE);
+    auto name_fid = schema->AddDebugField("name", DataType::VARCHAR);
+
+    const int64_t N = 3000;
+    auto dataset = DataGen(schema, N);
+    auto tenant_col = dataset.raw_->mutable_fields_data()
+                          ->at(1)
+                          .mutable_scalars()
+                          ->mutable_long_data()
+                          ->mutable_data();
+    for (int i = 0; i < N; ++i) {
+        tenant_col->at(i) = i % 3;
+    }
+    auto segment = CreateSealedWithFieldDataLoaded(schema, dataset);
+
+    auto tenants = dataset.get_col<int64_t>(tenant_fid);
+    auto prices = dataset.get_col<double>(price_fid);
+    auto names = dataset.get_col<std::string>(name_fid);
+    std::map<int64_t, std::vector<double>> expected_prices;
+    std::map<int64_t, std::set<std::string>> expected_names;
+    for (int i = 0; i < N; ++i) {
+        expected_prices[tenants[i]].push_back(prices[i]);
+        expected_names[tenants[i]].insert(names[i]);
+    }
+
+    expr::ColumnInfo tenant(tenant_fid, DataType::INT64);
+    expr::ColumnInfo price(price_fid, DataType::DOUBLE);
+    expr::ColumnInfo name(name_fid, DataType::VARCHAR);
+    auto result =
+        Aggregate(*segment,
+                  {tenant},
+                  {{AggregateFunction::kCount, std::nullopt},
+                   {AggregateFunction::kSum, price},
+                   {AggregateFunction::kMin, price},
+                   {AggregateFunction::kMax, price},
+                   {AggregateFunction::kAvg, price},
+                   {AggregateFunction::kCountDistinct, name}});
+    ASSERT_EQ(result.total_data_cnt_, N);
+    auto& aggregation = result.aggregation_result_;
+    ASSERT_NE(aggregation, nullptr);
+    ASSERT_EQ(aggregation->num_groups(), 3);
+    for (int64_t group = 0; group < aggregation->num_groups(); ++group) {
+        auto key = std::get<int64_t>(aggregation->key(group)[0]);
+        auto& values = expected_prices[key];
+        double sum = 0;
+        for (auto v : values) {
+            sum += v;
+        }
+        auto final = [&](size_t aggregate) {
+            return aggregation->state(group, aggregate)
+                .Final(aggregation->functions()[aggregate]);
+        };
+        ASSERT_EQ(std::get<int64_t>(final(0)), values.size());
+        ASSERT_NEAR(std::get<double>(final(1)), sum, 1e-6 * std::abs(sum));
+        ASSERT_EQ(std::get<double>(final(2)),
+                  *std::min_element(values.begin(), values.end()));
+        ASSERT_EQ(std::get<double>(final(3)),
+                  *std::max_element(values.begin(), values.end()));
+        ASSERT_NEAR(std::get<double>(final(4)),
+                    sum / values.size(),
+                    1e-6 * std::abs(sum));
+        ASSERT_EQ(std::get<int64_t>(final(5)), expected_names[key].size());
+    }
+}
+
+TEST(AggregationNode, WithoutGroupBy) {
+    auto schema = std::make_shared<Schema>();
+    auto pk_fid = schema->AddDebugField("pk", DataType::INT64);
+    schema->set_primary_field_id(pk_fid);
+    auto value_fid = schema->AddDebugField("value", DataType::INT32);
+
+    const int64_t N = 1000;
+    auto dataset = DataGen(schema, N);
+    auto segment = CreateSealedWithFieldDataLoaded(schema, dataset);
+    auto values = dataset.get_col<int32_t>(value_fid);
+    int64_t sum = 0;
+    for (auto v : values) {
+        sum += v;
+    }
+
+    expr::ColumnInfo value(value_fid, DataType::INT32);
+    auto result = Aggregate(*segment,
+                            {},
+                            {{AggregateFunction::kCount, value},
+                             {AggregateFunction::kSum, value}});
+    auto& aggregation = result.aggregation_result_;
+    ASSERT_NE(aggregation, nullptr);
+    ASSERT_EQ(aggregation->num_groups(), 1);
+    ASSERT_EQ(std::get<int64_t>(aggregation->state(0, 0).Final(
+                  AggregateFunction::kCount)),
+              N);
+    ASSERT_EQ(std::get<int64_t>(
+                  aggregation->state(0, 1).Final(AggregateFunction::kSum)),
+              sum);
+}
+
+TEST(AggregationNode, MergeResults) {
+    std::vector<AggregateFunction> functions{AggregateFunction::kCount,
+                                             AggregateFunction::kSum,
+                                             AggregateFunction::kMin,
+                                             AggregateFunction::kAvg,
+                                             AggregateFunction::kCountDistinct};
+    AggregationResult a(functions);
+    AggregationResult b(functions);
+    auto add = [&](AggregationResult& result,
+                   const std::string& key,
+                   int64_t value) {
+        auto group = result.FindOrAddGroup({key});
+        for (size_t j = 0; j < functions.size(); ++j) {
+            result.state(group, j).AddInt(functions[j], value);
+        }
+    };
+    add(a, "x", 1);
+    add(a, "x", 2);
+    add(a, "y", 10);
+    add(b, "x", 2);
+    add(b, "z", 5);
+    a.Merge(b);
+
+    ASSERT_EQ(a.num_groups(), 3);
+    auto x = a.FindOrAddGroup({std::string("x")});
+    ASSERT_EQ(std::get<int64_t>(a.state(x, 0).Final(functions[0])), 3);
+    ASSERT_EQ(std::get<int64_t>(a.state(x, 1).Final(functions[1])), 5);
+    ASSERT_EQ(std::get<int64_t>(a.state(x, 2).Final(functions[2])), 1);
+    ASSERT_DOUBLE_EQ(std::get<double>(a.state(x, 3).Final(functions[3])),
+                     5.0 / 3);
+    ASSERT_EQ(std::get<int64_t>(a.state(x, 4).Final(functions[4])), 2);
+    ASSERT_EQ(a.num_groups(), 3);
+
+    // SUM and AVG of no value are null, COUNT is 0
+    AggregationResult empty(functions);
+    auto group = empty.FindOrAddGroup({});
+    ASSERT_EQ(std::get<int64_t>(empty.state(group, 0).Final(functions[0])),
+              0);
+    ASSERT_TRUE(std::holds_alternative<std::monostate>(
+        empty.state(group, 1).Final(functions[1])));
+    ASSERT_TRUE(std::holds_alternative<std::monostate>(
+        empty.state(group, 3).Final(functions[3])));
+}
+
+TEST(AggregationNode, UnboxedMinMax) {
+    std::vector<AggregateFunction> functions{AggregateFunction::kMin,
+                                             AggregateFunction::kMax,
+                                             AggregateFunction::kCount};
+    AggregationResult a(functions);
+    AggregationResult b(functions);
+    auto ints = a.FindOrAddGroup({std::string("ints")});
+    auto floats = a.FindOrAddGroup({std::string("floats")});
+    for (int64_t v : {7, -3, 12}) {
+        for (size_t j = 0; j < functions.size(); ++j) {
+            a.state(ints, j).AddInt(functions[j], v);
+        }
+    }
+    for (double v : {0.5, -1.25}) {
+        for (size_t j = 0; j < functions.size(); ++j) {
+            a.state(floats, j).AddFloat(functions[j], v);
+        }
+    }
+    auto other_ints = b.FindOrAddGroup({std::string("ints")});
+    for (size_t j = 0; j < functions.size(); ++j) {
+        b.state(other_ints, j).AddInt(functions[j], 40);
+    }
+    a.Merge(b);
+
+    ASSERT_EQ(std::get<int64_t>(a.state(ints, 0).Final(functions[0])), -3);
+    ASSERT_EQ(std::get<int64_t>(a.state(ints, 1).Final(functions[1])), 40);
+    ASSERT_EQ(std::get<int64_t>(a.state(ints, 2).Final(functions[2])), 4);
+    ASSERT_EQ(std::get<double>(a.state(floats, 0).Final(functions[0])),
+              -1.25);
+    ASSERT_EQ(std::get<double>(a.state(floats, 1).Final(functions[1])), 0.5);
+    // only COUNT DISTINCT keeps a set of values
+    for (int64_t group = 0; group < a.num_groups(); ++group) {
+        for (size_t j = 0; j < functions.size(); ++j) {
+            ASSERT_TRUE(a.state(group, j).distinct == nullptr);
+        }
+    }
+}
+
+TEST(AggregationNode, CountDistinctAcrossNumberTypes) {
+    std::vector<AggregateFunction> functions{
+        AggregateFunction::kCountDistinct};
+    AggregationResult a(functions);
+    AggregationResult b(functions);
+    // e.g. the numbers of a json path, mixing integers and doubles
+    auto group = a.FindOrAddGroup({});
+    for (auto value : {AggregateValue(int64_t(5)),
+                       AggregateValue(5.0),
+                       AggregateValue(5.5),
+                       AggregateValue(int64_t(-2)),
+                       AggregateValue(-0.0),
+                       AggregateValue(int64_t(0))}) {
+        a.state(group, 0).Add(functions[0], value);
+    }
+    auto other = b.FindOrAddGroup({});
+    b.state(other, 0).Add(functions[0], AggregateValue(-2.0));
+    b.state(other, 0).Add(functions[0], AggregateValue(1e300));
+    a.Merge(b);
+
+    // 5, 5.5, -2, 0 and 1e300
+    ASSERT_EQ(std::get<int64_t>(a.state(group, 0).Final(functions[0])), 5);
+}
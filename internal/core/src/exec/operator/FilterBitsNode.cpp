@@ -113,6 +113,9 @@ PhyFilterBitsNode::GetOutput() {
     auto filter_ratio =
         bitset.size() != 0 ? 1 - float(filtered_count) / bitset.size() : 0;
     milvus::monitor::internal_core_expr_filter_ratio.Observe(filter_ratio);
+    operator_context_->get_exec_context()
+        ->get_query_context()
+        ->set_filter_selectivity(filter_ratio);
     // num_processed_rows_ = need_process_rows_;
     std::vector<VectorPtr> col_res;
     col_res.push_back(std::make_shared<ColumnVector>(std::move(bitset),
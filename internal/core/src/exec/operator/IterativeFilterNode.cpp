@@ -111,6 +111,25 @@ insert_helper(milvus::SearchResult& search_result,
     ++topk;
 }
 
+void
+PhyIterativeFilterNode::RemoveDeleted(FixedVector<int32_t>& offsets,
+                                      FixedVector<float>& distances) {
+    TargetBitmap deleted(offsets.size(), false);
+    TargetBitmapView deleted_view(deleted);
+    query_context_->get_segment()->mask_offsets_with_delete(
+        deleted_view, offsets.data(), offsets.size(), delete_probe_);
+    size_t kept = 0;
+    for (size_t i = 0; i < offsets.size(); ++i) {
+        if (!deleted[i]) {
+            offsets[kept] = offsets[i];
+            distances[kept] = distances[i];
+            ++kept;
+        }
+    }
+    offsets.resize(kept);
+    distances.resize(kept);
+}
+
 RowVectorPtr
 PhyIterativeFilterNode::GetOutput() {
     if (is_finished_ || !no_more_input_) {
@@ -177,7 +196,15 @@ PhyIterativeFilterNode::GetOutput() {
                    "Vector Iterators' count must be equal to total_nq_, Check "
                    "your code");
         int nq_index = 0;
+        if (query_context_->is_lazy_delete()) {
+            // shared by every batch of every nq, the timestamp is fixed
+            delete_probe_ = query_context_->get_segment()->gather_deletes(
+                query_context_->get_query_timestamp());
+        }
 
+        // rows checked against the filter and rows passing it
+        int64_t evaluated = 0;
+        int64_t passed = 0;
         search_result.seg_offsets_.resize(nq * unity_topk, INVALID_SEG_OFFSET);
         search_result.distances_.resize(nq * unity_topk);
         for (auto& iterator : search_result.vector_iterators_.value()) {
@@ -206,6 +233,9 @@ PhyIterativeFilterNode::GetOutput() {
                         break;
                     }
                 }
+                if (query_context_->is_lazy_delete()) {
+                    RemoveDeleted(offsets, distances);
+                }
                 if (is_native_supported_) {
                     eval_ctx.set_offset_input(&offsets);
                     std::vector<VectorPtr> results;
@@ -223,6 +253,8 @@ PhyIterativeFilterNode::GetOutput() {
                                                 col_vec_size);
                     Assert(bitsetview.size() <= batch_size);
                     Assert(bitsetview.size() == offsets.size());
+                    evaluated += offsets.size();
+                    passed += bitsetview.count();
                     for (auto i = 0; i < offsets.size(); ++i) {
                         if (bitsetview[i] > 0) {
                             insert_helper(search_result,
@@ -261,6 +293,14 @@ PhyIterativeFilterNode::GetOutput() {
             }
             nq_index++;
         }
+        if (!is_native_supported_) {
+            query_context_->set_filter_selectivity(
+                need_process_rows_ != 0
+                    ? double(bitset.count()) / need_process_rows_
+                    : 0);
+        } else if (evaluated != 0) {
+            query_context_->set_filter_selectivity(double(passed) / evaluated);
+        }
     }
     query_context_->set_search_result(std::move(search_result));
     std::chrono::high_resolution_clock::time_point scalar_end =
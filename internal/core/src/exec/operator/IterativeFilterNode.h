@@ -72,8 +72,14 @@ class PhyIterativeFilterNode : public Operator {
     }
 
  private:
+    // drops the candidates deleted at the query timestamp, for lazy delete,
+    // probing delete_probe_ gathered once before the iterators are walked
+    void
+    RemoveDeleted(FixedVector<int32_t>& offsets, FixedVector<float>& distances);
+
     std::unique_ptr<ExprSet> exprs_;
     QueryContext* query_context_;
+    segcore::DeleteProbe delete_probe_;
     int64_t num_processed_rows_;
     int64_t need_process_rows_;
     bool is_finished_{false};
@@ -29,12 +29,12 @@ PhyMvccNode::PhyMvccNode(int32_t operator_id,
                mvcc_node->id(),
                "PhyIterativeFilterNode") {
     ExecContext* exec_context = operator_context_->get_exec_context();
-    QueryContext* query_context = exec_context->get_query_context();
-    segment_ = query_context->get_segment();
-    query_timestamp_ = query_context->get_query_timestamp();
-    active_count_ = query_context->get_active_count();
+    query_context_ = exec_context->get_query_context();
+    segment_ = query_context_->get_segment();
+    query_timestamp_ = query_context_->get_query_timestamp();
+    active_count_ = query_context_->get_active_count();
     is_source_node_ = mvcc_node->sources().size() == 0;
-    collection_ttl_timestamp_ = query_context->get_collection_ttl();
+    collection_ttl_timestamp_ = query_context_->get_collection_ttl();
 }
 
 void
@@ -71,7 +71,10 @@ PhyMvccNode::GetOutput() {
     // need to expose null?
     segment_->mask_with_timestamps(
         data, query_timestamp_, collection_ttl_timestamp_);
-    segment_->mask_with_delete(data, active_count_, query_timestamp_);
+    // with lazy delete, the iterative filter checks its candidates itself
+    if (!query_context_->is_lazy_delete()) {
+        segment_->mask_with_delete(data, active_count_, query_timestamp_);
+    }
     is_finished_ = true;
 
     auto output_rows = active_count_ - data.count();
@@ -67,6 +67,7 @@ class PhyMvccNode : public Operator {
     }
 
  private:
+    QueryContext* query_context_;
     const segcore::SegmentInternalInterface* segment_;
     milvus::Timestamp query_timestamp_;
     int64_t active_count_;
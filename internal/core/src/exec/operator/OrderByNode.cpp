@@ -0,0 +1,332 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "OrderByNode.h"
+
+#include <algorithm>
+#include <type_traits>
+
+#include "common/Tracer.h"
+#include "fmt/format.h"
+#include "index/ScalarIndexSort.h"
+#include "index/StringIndexSort.h"
+
+namespace milvus {
+namespace exec {
+
+namespace {
+
+template <typename T>
+void
+ReadValues(const DataArray& data, std::vector<T>& values) {
+    auto& scalars = data.scalars();
+    if constexpr (std::is_same_v<T, bool>) {
+        values.assign(scalars.bool_data().data().begin(),
+                      scalars.bool_data().data().end());
+    } else if constexpr (std::is_same_v<T, int64_t>) {
+        values.assign(scalars.long_data().data().begin(),
+                      scalars.long_data().data().end());
+    } else if constexpr (std::is_integral_v<T>) {
+        values.assign(scalars.int_data().data().begin(),
+                      scalars.int_data().data().end());
+    } else if constexpr (std::is_same_v<T, float>) {
+        values.assign(scalars.float_data().data().begin(),
+                      scalars.float_data().data().end());
+    } else if constexpr (std::is_same_v<T, double>) {
+        values.assign(scalars.double_data().data().begin(),
+                      scalars.double_data().data().end());
+    } else {
+        values.assign(scalars.string_data().data().begin(),
+                      scalars.string_data().data().end());
+    }
+}
+
+}  // namespace
+
+PhyOrderByNode::PhyOrderByNode(
+    int32_t operator_id,
+    DriverContext* driverctx,
+    const std::shared_ptr<const plan::OrderByNode>& node)
+    : Operator(driverctx,
+               node->output_type(),
+               operator_id,
+               node->id(),
+               "PhyOrderByNode"),
+      column_(node->column()),
+      descending_(node->descending()),
+      limit_(node->limit()) {
+    ExecContext* exec_context = operator_context_->get_exec_context();
+    query_context_ = exec_context->get_query_context();
+    segment_ = query_context_->get_segment();
+}
+
+void
+PhyOrderByNode::AddInput(RowVectorPtr& input) {
+    input_ = std::move(input);
+}
+
+template <typename T>
+bool
+PhyOrderByNode::TopNFromIndex(const TargetBitmapView& view,
+                              std::vector<int64_t>& offsets) const {
+    // indexes of growing segments cover single chunks
+    if (segment_->type() != SegmentType::Sealed) {
+        return false;
+    }
+    auto pinned =
+        segment_->PinIndex(query_context_->get_op_context(), column_.field_id_);
+    if (pinned.size() != 1) {
+        return false;
+    }
+
+    auto size = static_cast<int64_t>(view.size());
+    auto take = [&](int64_t offset) {
+        // note: false means the row is hit
+        if (offset < size && !view[offset]) {
+            offsets.push_back(offset);
+        }
+        return static_cast<int64_t>(offsets.size()) < limit_;
+    };
+    if constexpr (std::is_same_v<T, std::string>) {
+        auto index =
+            dynamic_cast<const index::StringIndexSort*>(pinned[0].get());
+        if (index == nullptr) {
+            return false;
+        }
+        index->ForEachInOrder(descending_, take);
+    } else if constexpr (std::is_same_v<T, bool>) {
+        return false;
+    } else {
+        auto index =
+            dynamic_cast<const index::ScalarIndexSort<T>*>(pinned[0].get());
+        if (index == nullptr) {
+            return false;
+        }
+        // the index sorts by value only, so the hit rows of a run of equal
+        // values are taken in ascending offset, as the raw scan breaks ties,
+        // whichever way the runs are walked
+        std::vector<int64_t> run;
+        auto take_run = [&](const auto* first, const auto* last) {
+            run.clear();
+            for (auto it = first; it != last; ++it) {
+                auto offset = static_cast<int64_t>(it->idx_);
+                if (offset < size && !view[offset]) {
+                    run.push_back(offset);
+                }
+            }
+            auto need = limit_ - static_cast<int64_t>(offsets.size());
+            if (static_cast<int64_t>(run.size()) > need) {
+                std::partial_sort(run.begin(), run.begin() + need, run.end());
+                run.resize(need);
+            } else {
+                std::sort(run.begin(), run.end());
+            }
+            offsets.insert(offsets.end(), run.begin(), run.end());
+            return static_cast<int64_t>(offsets.size()) < limit_;
+        };
+        auto begin = index->begin();
+        auto end = index->end();
+        if (descending_) {
+            while (end != begin) {
+                auto first = end - 1;
+                while (first != begin && (first - 1)->a_ == first->a_) {
+                    --first;
+                }
+                if (!take_run(first, end)) {
+                    break;
+                }
+                end = first;
+            }
+        } else {
+            while (begin != end) {
+                auto last = begin + 1;
+                while (last != end && last->a_ == begin->a_) {
+                    ++last;
+                }
+                if (!take_run(begin, last)) {
+                    break;
+                }
+                begin = last;
+            }
+        }
+    }
+
+    // the index holds every non-null row, the rest of the hit rows are nulls
+    if (static_cast<int64_t>(offsets.size()) < limit_) {
+        TargetBitmap taken(size);
+        for (auto offset : offsets) {
+            taken[offset] = true;
+        }
+        auto row = view.find_first(false);
+        while (row.has_value() &&
+               static_cast<int64_t>(offsets.size()) < limit_) {
+            if (!taken[row.value()]) {
+                offsets.push_back(row.value());
+            }
+            row = view.find_next(row.value(), false);
+        }
+    }
+    return true;
+}
+
+template <typename T>
+void
+PhyOrderByNode::TopNFromRaw(const TargetBitmapView& view,
+                            std::vector<int64_t>& offsets) const {
+    auto precedes = [this](const T& a, const T& b) {
+        return descending_ ? b < a : a < b;
+    };
+    using Row = std::pair<T, int64_t>;
+    // rows are scanned in ascending order of offset, so ties go to the row
+    // already kept
+    auto before = [&](const Row& a, const Row& b) {
+        if (precedes(a.first, b.first)) {
+            return true;
+        }
+        return !precedes(b.first, a.first) && a.second < b.second;
+    };
+    // the worst of the kept rows at the front
+    std::vector<Row> heap;
+    std::vector<int64_t> nulls;
+
+    auto batch_size = query_context_->query_config()->get_expr_batch_size();
+    std::vector<int64_t> batch;
+    batch.reserve(batch_size);
+    std::vector<T> values;
+    auto flush = [&]() {
+        auto data = segment_->bulk_subscript(query_context_->get_op_context(),
+                                             column_.field_id_,
+                                             batch.data(),
+                                             batch.size());
+        ReadValues(*data, values);
+        auto has_nulls = data->valid_data_size() > 0;
+        for (size_t i = 0; i < batch.size(); ++i) {
+            if (has_nulls && !data->valid_data(i)) {
+                if (static_cast<int64_t>(nulls.size()) < limit_) {
+                    nulls.push_back(batch[i]);
+                }
+                continue;
+            }
+            if (static_cast<int64_t>(heap.size()) < limit_) {
+                heap.emplace_back(std::move(values[i]), batch[i]);
+                std::push_heap(heap.begin(), heap.end(), before);
+            } else if (precedes(values[i], heap.front().first)) {
+                std::pop_heap(heap.begin(), heap.end(), before);
+                heap.back() = Row(std::move(values[i]), batch[i]);
+                std::push_heap(heap.begin(), heap.end(), before);
+            }
+        }
+        batch.clear();
+    };
+
+    auto row = view.find_first(false);
+    while (row.has_value()) {
+        batch.push_back(row.value());
+        if (static_cast<int64_t>(batch.size()) == batch_size) {
+            flush();
+        }
+        row = view.find_next(row.value(), false);
+    }
+    if (!batch.empty()) {
+        flush();
+    }
+
+    std::sort_heap(heap.begin(), heap.end(), before);
+    offsets.reserve(std::min<int64_t>(limit_, heap.size() + nulls.size()));
+    for (auto& [value, offset] : heap) {
+        offsets.push_back(offset);
+    }
+    for (auto offset : nulls) {
+        if (static_cast<int64_t>(offsets.size()) == limit_) {
+            break;
+        }
+        offsets.push_back(offset);
+    }
+}
+
+template <typename T>
+std::vector<int64_t>
+PhyOrderByNode::TopN(const TargetBitmapView& view) const {
+    std::vector<int64_t> offsets;
+    if (!TopNFromIndex<T>(view, offsets)) {
+        TopNFromRaw<T>(view, offsets);
+    }
+    return offsets;
+}
+
+RowVectorPtr
+PhyOrderByNode::GetOutput() {
+    if (is_finished_ || !no_more_input_) {
+        return nullptr;
+    }
+    tracer::AutoSpan span(
+        "PhyOrderByNode::Execute", tracer::GetRootSpan(), true);
+    auto col_input = GetColumnVector(input_);
+    TargetBitmapView view(col_input->GetRawData(), col_input->size());
+
+    std::vector<int64_t> offsets;
+    switch (column_.data_type_) {
+        case DataType::BOOL:
+            offsets = TopN<bool>(view);
+            break;
+        case DataType::INT8:
+            offsets = TopN<int8_t>(view);
+            break;
+        case DataType::INT16:
+            offsets = TopN<int16_t>(view);
+            break;
+        case DataType::INT32:
+            offsets = TopN<int32_t>(view);
+            break;
+        case DataType::INT64:
+        case DataType::TIMESTAMPTZ:
+            offsets = TopN<int64_t>(view);
+            break;
+        case DataType::FLOAT:
+            offsets = TopN<float>(view);
+            break;
+        case DataType::DOUBLE:
+            offsets = TopN<double>(view);
+            break;
+        case DataType::VARCHAR:
+        case DataType::STRING:
+        case DataType::TEXT:
+            offsets = TopN<std::string>(view);
+            break;
+        default:
+            ThrowInfo(DataTypeInvalid,
+                      "unsupported data type {} for order by",
+                      column_.data_type_);
+    }
+
+    RetrieveResult retrieve_result;
+    retrieve_result.total_data_cnt_ = view.size();
+    retrieve_result.has_more_result = false;
+    retrieve_result.result_offsets_ = std::move(offsets);
+    query_context_->set_retrieve_result(std::move(retrieve_result));
+    is_finished_ = true;
+
+    tracer::AddEvent(fmt::format("order_by_limit: {}", limit_));
+    return input_;
+}
+
+bool
+PhyOrderByNode::IsFinished() {
+    return is_finished_;
+}
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,100 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "exec/Driver.h"
+#include "exec/operator/Operator.h"
+#include "exec/QueryContext.h"
+
+namespace milvus {
+namespace exec {
+
+// Top-N of the rows left by the filter of a retrieve plan, ordered by the
+// value of one scalar field. The offsets of the segment come out sorted as
+// the result_offsets_ of the retrieve result, so the results of segments
+// merge like sorted runs.
+class PhyOrderByNode : public Operator {
+ public:
+    PhyOrderByNode(int32_t operator_id,
+                   DriverContext* ctx,
+                   const std::shared_ptr<const plan::OrderByNode>& node);
+
+    bool
+    IsFilter() override {
+        return false;
+    }
+
+    bool
+    NeedInput() const override {
+        return !is_finished_;
+    }
+
+    void
+    AddInput(RowVectorPtr& input);
+
+    RowVectorPtr
+    GetOutput() override;
+
+    bool
+    IsFinished() override;
+
+    void
+    Close() override {
+    }
+
+    BlockingReason
+    IsBlocked(ContinueFuture* /* unused */) override {
+        return BlockingReason::kNotBlocked;
+    }
+
+    virtual std::string
+    ToString() const override {
+        return "PhyOrderByNode";
+    }
+
+ private:
+    template <typename T>
+    std::vector<int64_t>
+    TopN(const TargetBitmapView& view) const;
+
+    // walks a sorted index of a sealed segment in order, false if the field
+    // has no such index
+    template <typename T>
+    bool
+    TopNFromIndex(const TargetBitmapView& view,
+                  std::vector<int64_t>& offsets) const;
+
+    // keeps a heap of the best rows while scanning the raw data in batches
+    template <typename T>
+    void
+    TopNFromRaw(const TargetBitmapView& view,
+                std::vector<int64_t>& offsets) const;
+
+    const segcore::SegmentInternalInterface* segment_;
+    QueryContext* query_context_;
+    expr::ColumnInfo column_;
+    bool descending_;
+    int64_t limit_;
+    bool is_finished_{false};
+};
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,164 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+
+#include "common/Types.h"
+#include "index/ScalarIndexSort.h"
+#include "index/StringIndexSort.h"
+#include "plan/PlanNode.h"
+#include "query/ExecPlanNodeVisitor.h"
+#include "test_utils/cachinglayer_test_utils.h"
+#include "test_utils/DataGen.h"
+#include "test_utils/storage_test_utils.h"
+
+using namespace milvus;
+using namespace milvus::segcore;
+
+namespace {
+
+std::vector<int64_t>
+OrderBy(const SegmentInternalInterface& segment,
+        const expr::ColumnInfo& column,
+        bool descending,
+        int64_t limit) {
+    std::vector<plan::PlanNodePtr> sources{
+        std::make_shared<plan::MvccNode>("0")};
+    query::RetrievePlanNode node;
+    node.plannodes_ = std::make_shared<plan::OrderByNode>(
+        "1", column, descending, limit, sources);
+    query::ExecPlanNodeVisitor visitor(segment, MAX_TIMESTAMP);
+    return visitor.get_retrieve_result(node).result_offsets_;
+}
+
+// the values at offsets are the first limit values of the sorted column
+template <typename T>
+void
+CheckOrder(const std::vector<int64_t>& offsets,
+           FixedVector<T> values,
+           bool descending,
+           int64_t limit) {
+    std::vector<T> expected(values.begin(), values.end());
+    if (descending) {
+        std::sort(expected.begin(), expected.end(), std::greater<T>());
+    } else {
+        std::sort(expected.begin(), expected.end());
+    }
+    expected.resize(std::min<int64_t>(limit, expected.size()));
+    ASSERT_EQ(offsets.size(), expected.size());
+    for (size_t i = 0; i < offsets.size(); ++i) {
+        ASSERT_EQ(values[offsets[i]], expected[i]);
+    }
+}
+
+}  // namespace
+
+class OrderByNodeTest : public ::testing::Test {
+ protected:
+    void
+    SetUp() override {
+        schema_ = std::make_shared<Schema>();
+        auto pk_fid = schema_->AddDebugField("pk", DataType::INT64);
+        schema_->set_primary_field_id(pk_fid);
+        updated_at_fid_ = schema_->AddDebugField("updated_at", DataType::INT64);
+        name_fid_ = schema_->AddDebugField("name", DataType::VARCHAR);
+        dataset_ = std::make_unique<GeneratedData>(DataGen(schema_, N));
+        // duplicated values, so that ties are ordered too
+        auto updated_at_col = dataset_->raw_->mutable_fields_data()
+                                  ->at(1)
+                                  .mutable_scalars()
+                                  ->mutable_long_data()
+                                  ->mutable_data();
+        for (int i = 0; i < N; ++i) {
+            updated_at_col->at(i) = (i * 7919) % 1000;
+        }
+        segment_ = CreateSealedWithFieldDataLoaded(schema_, *dataset_);
+    }
+
+    void
+    LoadIndexes() {
+        auto updated_at = dataset_->get_col<int64_t>(updated_at_fid_);
+        auto int_index = index::CreateScalarIndexSort<int64_t>();
+        int_index->Build(N, updated_at.data());
+        LoadIndexInfo int_info{
+            .field_id = updated_at_fid_.get(),
+            .index_params = GenIndexParams(int_index.get()),
+            .cache_index = CreateTestCacheIndex("test", std::move(int_index)),
+        };
+        segment_->LoadIndex(int_info);
+
+        auto names = dataset_->get_col<std::string>(name_fid_);
+        auto string_index = index::CreateStringIndexSort();
+        string_index->Build(N, names.data());
+        LoadIndexInfo string_info{
+            .field_id = name_fid_.get(),
+            .index_params = GenIndexParams(string_index.get()),
+            .cache_index =
+                CreateTestCacheIndex("test", std::move(string_index)),
+        };
+        segment_->LoadIndex(string_info);
+    }
+
+    void
+    CheckAll() {
+        expr::ColumnInfo updated_at(updated_at_fid_, DataType::INT64);
+        expr::ColumnInfo name(name_fid_, DataType::VARCHAR);
+        for (auto descending : {false, true}) {
+            for (int64_t limit : {1, 100, N + 10}) {
+                CheckOrder(OrderBy(*segment_, updated_at, descending, limit),
+                           dataset_->get_col<int64_t>(updated_at_fid_),
+                           descending,
+                           limit);
+                CheckOrder(OrderBy(*segment_, name, descending, limit),
+                           dataset_->get_col<std::string>(name_fid_),
+                           descending,
+                           limit);
+            }
+        }
+    }
+
+    static constexpr int64_t N = 3000;
+    SchemaPtr schema_;
+    FieldId updated_at_fid_;
+    FieldId name_fid_;
+    std::unique_ptr<GeneratedData> dataset_;
+    SegmentSealedUPtr segment_;
+};
+
+TEST_F(OrderByNodeTest, RawData) {
+    CheckAll();
+}
+
+TEST_F(OrderByNodeTest, SortedIndex) {
+    LoadIndexes();
+    CheckAll();
+}
+
+TEST_F(OrderByNodeTest, SortedIndexBreaksTiesAsRawData) {
+    expr::ColumnInfo updated_at(updated_at_fid_, DataType::INT64);
+    std::vector<std::vector<int64_t>> raw;
+    for (auto descending : {false, true}) {
+        for (int64_t limit : {5, 100, N + 10}) {
+            raw.push_back(OrderBy(*segment_, updated_at, descending, limit));
+        }
+    }
+    LoadIndexes();
+    size_t i = 0;
+    for (auto descending : {false, true}) {
+        for (int64_t limit : {5, 100, N + 10}) {
+            ASSERT_EQ(OrderBy(*segment_, updated_at, descending, limit),
+                      raw[i++])
+                << descending << " " << limit;
+        }
+    }
+}
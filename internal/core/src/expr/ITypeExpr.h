@@ -18,6 +18,7 @@
 
 #include <fmt/core.h>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -548,6 +549,48 @@ class TermFilterExpr : public ITypeFilterExpr {
     const bool is_in_field_;
 };
 
+// Runtime statistics of one flattened input of an AND/OR conjunction.
+// `decided_rows` counts rows whose result was settled by this input
+// (turned false for AND, turned true for OR).
+struct ConjunctInputStats {
+    int64_t input_rows = 0;
+    int64_t decided_rows = 0;
+    int64_t cost_ns = 0;
+};
+
+// Evaluation feedback of a conjunction, shared by all segments that
+// execute the same plan, so that later segments can start with the order
+// learned by earlier ones. Indexed by the position of the flattened input.
+class ConjunctFeedback {
+ public:
+    void
+    Merge(const std::vector<ConjunctInputStats>& delta) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stats_.empty()) {
+            stats_.resize(delta.size());
+        }
+        // flattened layout differs, statistics are not comparable
+        if (stats_.size() != delta.size()) {
+            return;
+        }
+        for (size_t i = 0; i < delta.size(); ++i) {
+            stats_[i].input_rows += delta[i].input_rows;
+            stats_[i].decided_rows += delta[i].decided_rows;
+            stats_[i].cost_ns += delta[i].cost_ns;
+        }
+    }
+
+    std::vector<ConjunctInputStats>
+    Snapshot() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
+
+ private:
+    mutable std::mutex mutex_;
+    std::vector<ConjunctInputStats> stats_;
+};
+
 class LogicalBinaryExpr : public ITypeFilterExpr {
  public:
     enum class OpType { Invalid = 0, And = 1, Or = 2 };
@@ -555,7 +598,9 @@ class LogicalBinaryExpr : public ITypeFilterExpr {
     explicit LogicalBinaryExpr(OpType op_type,
                                const TypedExprPtr& left,
                                const TypedExprPtr& right)
-        : ITypeFilterExpr(), op_type_(op_type) {
+        : ITypeFilterExpr(),
+          op_type_(op_type),
+          feedback_(std::make_shared<ConjunctFeedback>()) {
         inputs_.emplace_back(left);
         inputs_.emplace_back(right);
     }
@@ -599,6 +644,8 @@ class LogicalBinaryExpr : public ITypeFilterExpr {
 
  public:
     const OpType op_type_;
+    // shared across segments, the expression itself stays immutable
+    const std::shared_ptr<ConjunctFeedback> feedback_;
 };
 
 class BinaryRangeFilterExpr : public ITypeFilterExpr {
@@ -44,6 +44,68 @@ constexpr size_t ALIGNMENT = 32;  // 32-byte alignment
 
 const uint64_t MMAP_INDEX_PADDING = 1;
 
+// entries searched after the directory, 4 cache lines of int64 entries
+constexpr size_t DIRECTORY_BLOCK_SIZE = 16;
+
+// entries ahead whose bitmap words are prefetched while setting rows
+constexpr ptrdiff_t SET_ROWS_PREFETCH_DISTANCE = 16;
+
+namespace {
+
+// Fills directory_values and directory_blocks from the subtree of node k,
+// taking the blocks in order from next_block on, returns the block after
+// the last one taken.
+template <typename T>
+size_t
+FillDirectory(const IndexStructure<T>* data,
+              size_t num_blocks,
+              size_t k,
+              size_t next_block,
+              T* directory_values,
+              int32_t* directory_blocks) {
+    if (k > num_blocks) {
+        return next_block;
+    }
+    next_block = FillDirectory(data,
+                               num_blocks,
+                               2 * k,
+                               next_block,
+                               directory_values,
+                               directory_blocks);
+    directory_values[k] = data[next_block * DIRECTORY_BLOCK_SIZE].a_;
+    directory_blocks[k] = next_block;
+    return FillDirectory(data,
+                         num_blocks,
+                         2 * k + 1,
+                         next_block + 1,
+                         directory_values,
+                         directory_blocks);
+}
+
+// Sets the rows of the entries [first, last) to value. Rows in value order
+// are scattered over the bitmap, so the words of the rows a few entries ahead
+// are prefetched.
+template <typename T>
+void
+SetRows(TargetBitmap& bitset,
+        const IndexStructure<T>* first,
+        const IndexStructure<T>* last,
+        bool value) {
+    auto words = reinterpret_cast<const char*>(bitset.data());
+    auto it = first;
+    auto prefetch_end =
+        last - std::min(last - first, SET_ROWS_PREFETCH_DISTANCE);
+    for (; it < prefetch_end; ++it) {
+        __builtin_prefetch(words + it[SET_ROWS_PREFETCH_DISTANCE].idx_ / 8, 1);
+        bitset[it->idx_] = value;
+    }
+    for (; it < last; ++it) {
+        bitset[it->idx_] = value;
+    }
+}
+
+}  // namespace
+
 template <typename T>
 ScalarIndexSort<T>::ScalarIndexSort(
     const storage::FileManagerContext& file_manager_context)
@@ -100,6 +162,7 @@ ScalarIndexSort<T>::Build(size_t n, const T* values, const bool* valid_data) {
     is_built_ = true;
 
     setup_data_pointers();
+    build_directory();
 }
 
 template <typename T>
@@ -143,6 +206,7 @@ ScalarIndexSort<T>::BuildWithFieldData(
     is_built_ = true;
 
     setup_data_pointers();
+    build_directory();
 }
 
 template <typename T>
@@ -261,6 +325,7 @@ ScalarIndexSort<T>::LoadWithoutAssemble(const BinarySet& index_binary,
     }
 
     setup_data_pointers();
+    build_directory();
 
     auto index_num_rows = index_binary.GetByName("index_num_rows");
     if (index_num_rows) {
@@ -321,18 +386,10 @@ ScalarIndexSort<T>::In(const size_t n, const T* values) {
     AssertInfo(is_built_, "index has not been built");
     TargetBitmap bitset(Count());
     for (size_t i = 0; i < n; ++i) {
-        auto lb =
-            std::lower_bound(begin(), end(), IndexStructure<T>(*(values + i)));
-        auto ub =
-            std::upper_bound(begin(), end(), IndexStructure<T>(*(values + i)));
-        for (; lb < ub; ++lb) {
-            if (lb->a_ != *(values + i)) {
-                std::cout << "error happens in ScalarIndexSort<T>::In, "
-                             "experted value is: "
-                          << *(values + i) << ", but real value is: " << lb->a_;
-            }
-            bitset[lb->idx_] = true;
-        }
+        SetRows(bitset,
+                find_lower_bound(values[i]),
+                find_upper_bound(values[i]),
+                true);
     }
     return bitset;
 }
@@ -343,18 +400,10 @@ ScalarIndexSort<T>::NotIn(const size_t n, const T* values) {
     AssertInfo(is_built_, "index has not been built");
     TargetBitmap bitset(Count(), true);
     for (size_t i = 0; i < n; ++i) {
-        auto lb =
-            std::lower_bound(begin(), end(), IndexStructure<T>(*(values + i)));
-        auto ub =
-            std::upper_bound(begin(), end(), IndexStructure<T>(*(values + i)));
-        for (; lb < ub; ++lb) {
-            if (lb->a_ != *(values + i)) {
-                std::cout << "error happens in ScalarIndexSort<T>::NotIn, "
-                             "experted value is: "
-                          << *(values + i) << ", but real value is: " << lb->a_;
-            }
-            bitset[lb->idx_] = false;
-        }
+        SetRows(bitset,
+                find_lower_bound(values[i]),
+                find_upper_bound(values[i]),
+                false);
     }
     // NotIn(null) and In(null) is both false, need to mask with IsNotNull operate
     bitset &= valid_bitset_;
@@ -392,16 +441,16 @@ ScalarIndexSort<T>::Range(const T value, const OpType op) {
     }
     switch (op) {
         case OpType::LessThan:
-            ub = std::lower_bound(begin(), end(), IndexStructure<T>(value));
+            ub = find_lower_bound(value);
             break;
         case OpType::LessEqual:
-            ub = std::upper_bound(begin(), end(), IndexStructure<T>(value));
+            ub = find_upper_bound(value);
             break;
         case OpType::GreaterThan:
-            lb = std::upper_bound(begin(), end(), IndexStructure<T>(value));
+            lb = find_upper_bound(value);
             break;
         case OpType::GreaterEqual:
-            lb = std::lower_bound(begin(), end(), IndexStructure<T>(value));
+            lb = find_lower_bound(value);
             break;
         default:
             ThrowInfo(OpTypeInvalid,
@@ -415,20 +464,14 @@ ScalarIndexSort<T>::Range(const T value, const OpType op) {
         // Most elements are in range, initialize with `valid_bitset` and set non-matching to false
         TargetBitmap bitset = valid_bitset_.clone();
         // Set elements before lb to false
-        for (auto it = begin(); it < lb; ++it) {
-            bitset[it->idx_] = false;
-        }
+        SetRows(bitset, begin(), lb, false);
         // Set elements after ub to false
-        for (auto it = ub; it < end(); ++it) {
-            bitset[it->idx_] = false;
-        }
+        SetRows(bitset, ub, end(), false);
         return bitset;
     } else {
         // Fewer elements are in range, initialize with false and set matching to true
         TargetBitmap bitset(total_count);
-        for (; lb < ub; ++lb) {
-            bitset[lb->idx_] = true;
-        }
+        SetRows(bitset, lb, ub, true);
         return bitset;
     }
 }
@@ -453,18 +496,14 @@ ScalarIndexSort<T>::Range(T lower_bound_value,
     auto lb = begin();
     auto ub = end();
     if (lb_inclusive) {
-        lb = std::lower_bound(
-            begin(), end(), IndexStructure<T>(lower_bound_value));
+        lb = find_lower_bound(lower_bound_value);
     } else {
-        lb = std::upper_bound(
-            begin(), end(), IndexStructure<T>(lower_bound_value));
+        lb = find_upper_bound(lower_bound_value);
     }
     if (ub_inclusive) {
-        ub = std::upper_bound(
-            begin(), end(), IndexStructure<T>(upper_bound_value));
+        ub = find_upper_bound(upper_bound_value);
     } else {
-        ub = std::lower_bound(
-            begin(), end(), IndexStructure<T>(upper_bound_value));
+        ub = find_lower_bound(upper_bound_value);
     }
 
     size_t hit_count = ub - lb;
@@ -474,24 +513,84 @@ ScalarIndexSort<T>::Range(T lower_bound_value,
         // Most elements are in range, initialize with `valid_bitset_` and set non-matching to false
         TargetBitmap bitset = valid_bitset_.clone();
         // Set elements before lb to false
-        for (auto it = begin(); it < lb; ++it) {
-            bitset[it->idx_] = false;
-        }
+        SetRows(bitset, begin(), lb, false);
         // Set elements after ub to false
-        for (auto it = ub; it < end(); ++it) {
-            bitset[it->idx_] = false;
-        }
+        SetRows(bitset, ub, end(), false);
         return bitset;
     } else {
         // Fewer elements are in range, initialize with false and set matching to true
         TargetBitmap bitset(total_count);
-        for (; lb < ub; ++lb) {
-            bitset[lb->idx_] = true;
-        }
+        SetRows(bitset, lb, ub, true);
         return bitset;
     }
 }
 
+template <typename T>
+void
+ScalarIndexSort<T>::build_directory() {
+    num_directory_blocks_ =
+        (size_ + DIRECTORY_BLOCK_SIZE - 1) / DIRECTORY_BLOCK_SIZE;
+    directory_values_ = std::make_unique<T[]>(num_directory_blocks_ + 1);
+    directory_blocks_.assign(num_directory_blocks_ + 1, 0);
+    FillDirectory(data_ptr_,
+                  num_directory_blocks_,
+                  1,
+                  0,
+                  directory_values_.get(),
+                  directory_blocks_.data());
+}
+
+template <typename T>
+template <typename Predicate>
+size_t
+ScalarIndexSort<T>::search_directory(Predicate is_before) const {
+    // the descendants of k log2(values_per_cache_line) levels down share
+    // the cache line prefetched here
+    constexpr size_t values_per_cache_line = 64 / sizeof(T);
+    const T* values = directory_values_.get();
+    size_t k = 1;
+    while (k <= num_directory_blocks_) {
+        __builtin_prefetch(values + k * values_per_cache_line);
+        k = 2 * k + is_before(values[k]);
+    }
+    // undo the right turns taken after the last left one, that left turn
+    // was taken at the answer
+    k >>= __builtin_ffsll(~k);
+    return k == 0 ? num_directory_blocks_ : directory_blocks_[k];
+}
+
+template <typename T>
+const IndexStructure<T>*
+ScalarIndexSort<T>::find_lower_bound(T value) const {
+    auto block =
+        search_directory([value](const T& first) { return first < value; });
+    // the first value of the block is not less than value while the one of
+    // the previous block is, the bound is in the rest of the previous block
+    auto first = block == 0
+                     ? begin()
+                     : begin() + (block - 1) * DIRECTORY_BLOCK_SIZE + 1;
+    auto last = std::min(begin() + block * DIRECTORY_BLOCK_SIZE, end());
+    return std::partition_point(
+        first, last, [value](const IndexStructure<T>& entry) {
+            return entry.a_ < value;
+        });
+}
+
+template <typename T>
+const IndexStructure<T>*
+ScalarIndexSort<T>::find_upper_bound(T value) const {
+    auto block = search_directory(
+        [value](const T& first) { return !(value < first); });
+    auto first = block == 0
+                     ? begin()
+                     : begin() + (block - 1) * DIRECTORY_BLOCK_SIZE + 1;
+    auto last = std::min(begin() + block * DIRECTORY_BLOCK_SIZE, end());
+    return std::partition_point(
+        first, last, [value](const IndexStructure<T>& entry) {
+            return !(value < entry.a_);
+        });
+}
+
 template <typename T>
 std::optional<T>
 ScalarIndexSort<T>::Reverse_Lookup(size_t idx) const {
@@ -131,6 +131,14 @@ class ScalarIndexSort : public ScalarIndex<T> {
     bool
     ShouldSkip(const T lower_value, const T upper_value, const OpType op);
 
+    // first entry whose value is not less than value
+    const IndexStructure<T>*
+    find_lower_bound(T value) const;
+
+    // first entry whose value is greater than value
+    const IndexStructure<T>*
+    find_upper_bound(T value) const;
+
  public:
     const IndexStructure<T>*
     GetData() {
@@ -186,6 +194,16 @@ class ScalarIndexSort : public ScalarIndex<T> {
         }
     }
 
+    // builds the directory over the entries pointed to by data_ptr_
+    void
+    build_directory();
+
+    // first block of DIRECTORY_BLOCK_SIZE entries whose first value does not
+    // satisfy is_before, or the number of blocks if there is none
+    template <typename Predicate>
+    size_t
+    search_directory(Predicate is_before) const;
+
     int64_t field_id_ = 0;
 
     bool is_built_ = false;
@@ -213,6 +231,18 @@ class ScalarIndexSort : public ScalarIndex<T> {
     mutable const IndexStructure<T>* end_ptr_ = nullptr;
     mutable size_t size_ = 0;
 
+    // Directory over the first value of every block of DIRECTORY_BLOCK_SIZE
+    // sorted entries, kept apart from the row offsets and laid out in
+    // Eytzinger (breadth-first) order: the top levels of every search share
+    // a few cache lines and the levels below can be prefetched. A lookup
+    // walks the directory and then searches a single block of entries,
+    // instead of binary searching the whole index, ram or mmap.
+    // num_directory_blocks_ + 1, 1-indexed
+    std::unique_ptr<T[]> directory_values_;
+    // block of each directory value, 1-indexed
+    std::vector<int32_t> directory_blocks_;
+    size_t num_directory_blocks_ = 0;
+
     std::chrono::time_point<std::chrono::system_clock> index_build_begin_;
 };
 
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <cstdint>
 #include "index/ScalarIndexSort.h"
 #include "common/Types.h"
@@ -88,4 +89,73 @@ TEST(StlSortIndexTest, TestIn) {
 
     test_stlsort_for_range(
         data, DataType::INT64, true, exec_expr, expected_result);
-}
\ No newline at end of file
+}
+
+TEST(StlSortIndexTest, TestLookupAcrossBlocks) {
+    // many duplicates spread over several directory blocks, with bounds
+    // falling on block edges and outside the values
+    std::vector<int64_t> data(1000);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = (i * 7919) % 97;
+    }
+    std::vector<int64_t> values = {-1, 0, 15, 16, 17, 50, 96, 97};
+    for (auto value : values) {
+        for (auto op : {OpType::LessThan,
+                        OpType::LessEqual,
+                        OpType::GreaterThan,
+                        OpType::GreaterEqual}) {
+            std::vector<bool> expected_result(data.size());
+            for (size_t i = 0; i < data.size(); ++i) {
+                switch (op) {
+                    case OpType::LessThan:
+                        expected_result[i] = data[i] < value;
+                        break;
+                    case OpType::LessEqual:
+                        expected_result[i] = data[i] <= value;
+                        break;
+                    case OpType::GreaterThan:
+                        expected_result[i] = data[i] > value;
+                        break;
+                    default:
+                        expected_result[i] = data[i] >= value;
+                        break;
+                }
+            }
+            auto exec_expr =
+                [value,
+                 op](const std::shared_ptr<ScalarIndexSort<int64_t>>& index) {
+                    return index->Range(value, op);
+                };
+            test_stlsort_for_range(
+                data, DataType::INT64, false, exec_expr, expected_result);
+            test_stlsort_for_range(
+                data, DataType::INT64, true, exec_expr, expected_result);
+        }
+    }
+
+    std::vector<bool> expected_result(data.size());
+    for (size_t i = 0; i < data.size(); ++i) {
+        expected_result[i] = data[i] >= 15 && data[i] < 50;
+    }
+    std::function<TargetBitmap(
+        const std::shared_ptr<ScalarIndexSort<int64_t>>&)>
+        exec_expr =
+            [](const std::shared_ptr<ScalarIndexSort<int64_t>>& index) {
+                return index->Range(15, true, 50, false);
+            };
+    test_stlsort_for_range(
+        data, DataType::INT64, true, exec_expr, expected_result);
+
+    for (size_t i = 0; i < data.size(); ++i) {
+        expected_result[i] =
+            std::find(values.begin(), values.end(), data[i]) != values.end();
+    }
+    exec_expr =
+        [&values](const std::shared_ptr<ScalarIndexSort<int64_t>>& index) {
+            return index->In(values.size(), values.data());
+        };
+    test_stlsort_for_range(
+        data, DataType::INT64, false, exec_expr, expected_result);
+    test_stlsort_for_range(
+        data, DataType::INT64, true, exec_expr, expected_result);
+}
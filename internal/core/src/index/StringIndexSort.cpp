@@ -393,6 +393,13 @@ StringIndexSort::Reverse_Lookup(size_t offset) const {
         offset, total_num_rows_, valid_bitset_, idx_to_offsets_);
 }
 
+void
+StringIndexSort::ForEachInOrder(
+    bool reverse, const std::function<bool(uint32_t)>& fn) const {
+    assert(impl_ != nullptr);
+    impl_->ForEachInOrder(reverse, fn);
+}
+
 int64_t
 StringIndexSort::Size() {
     return total_size_;
@@ -838,6 +845,20 @@ StringIndexSortMemoryImpl::Reverse_Lookup(
     return std::nullopt;
 }
 
+void
+StringIndexSortMemoryImpl::ForEachInOrder(
+    bool reverse, const std::function<bool(uint32_t)>& fn) const {
+    auto n = posting_lists_.size();
+    for (size_t i = 0; i < n; ++i) {
+        const auto& posting_list = posting_lists_[reverse ? n - 1 - i : i];
+        for (uint32_t row_id : posting_list) {
+            if (!fn(row_id)) {
+                return;
+            }
+        }
+    }
+}
+
 int64_t
 StringIndexSortMemoryImpl::Size() {
     size_t size = 0;
@@ -1142,6 +1163,19 @@ StringIndexSortMmapImpl::Reverse_Lookup(
     return std::nullopt;
 }
 
+void
+StringIndexSortMmapImpl::ForEachInOrder(
+    bool reverse, const std::function<bool(uint32_t)>& fn) const {
+    for (size_t i = 0; i < unique_count_; ++i) {
+        MmapEntry entry = GetEntry(reverse ? unique_count_ - 1 - i : i);
+        for (size_t j = 0; j < entry.get_posting_list_len(); ++j) {
+            if (!fn(entry.get_row_id(j))) {
+                return;
+            }
+        }
+    }
+}
+
 int64_t
 StringIndexSortMmapImpl::Size() {
     return mmap_size_;
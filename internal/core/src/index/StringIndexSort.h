@@ -17,6 +17,7 @@
 #pragma once
 
 #include <algorithm>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -120,6 +121,13 @@ class StringIndexSort : public StringIndex {
     std::optional<std::string>
     Reverse_Lookup(size_t offset) const override;
 
+    // Calls fn with the offsets of the non-null rows in ascending order of
+    // their values, or descending if reverse, until fn returns false. Rows
+    // of equal values come in ascending order of offset.
+    void
+    ForEachInOrder(bool reverse,
+                   const std::function<bool(uint32_t)>& fn) const;
+
     int64_t
     Size() override;
 
@@ -197,6 +205,10 @@ class StringIndexSortImpl {
                    const TargetBitmap& valid_bitset,
                    const std::vector<int32_t>& idx_to_offsets) const = 0;
 
+    virtual void
+    ForEachInOrder(bool reverse,
+                   const std::function<bool(uint32_t)>& fn) const = 0;
+
     virtual int64_t
     Size() = 0;
 };
@@ -270,6 +282,10 @@ class StringIndexSortMemoryImpl : public StringIndexSortImpl {
                    const TargetBitmap& valid_bitset,
                    const std::vector<int32_t>& idx_to_offsets) const override;
 
+    void
+    ForEachInOrder(bool reverse,
+                   const std::function<bool(uint32_t)>& fn) const override;
+
     int64_t
     Size() override;
 
@@ -384,6 +400,10 @@ class StringIndexSortMmapImpl : public StringIndexSortImpl {
                    const TargetBitmap& valid_bitset,
                    const std::vector<int32_t>& idx_to_offsets) const override;
 
+    void
+    ForEachInOrder(bool reverse,
+                   const std::function<bool(uint32_t)>& fn) const override;
+
     int64_t
     Size() override;
 
@@ -187,7 +187,9 @@ VectorMemIndex<T>::Load(milvus::tracer::TraceContext ctx,
                                                         index_files->end());
 
     LOG_INFO("load index files: {}", index_files.value().size());
-    std::map<std::string, IndexDataCodec> index_data_codecs{};
+    // slices are streamed into the binary set as they arrive, so the peak
+    // memory is the index binaries plus the slices in flight
+    BinarySet binary_set;
     // try to read slice meta first
     std::string slice_meta_filepath;
     for (auto& file : pending_index_files) {
@@ -199,6 +201,20 @@ VectorMemIndex<T>::Load(milvus::tracer::TraceContext ctx,
         }
     }
 
+    // hands the payload of a whole binary over without copying it, the
+    // binary keeps the downloaded file alive
+    auto append_payload = [&binary_set](const std::string& key,
+                                        std::unique_ptr<storage::DataCodec>
+                                            data) {
+        auto size = data->PayloadSize();
+        auto payload = const_cast<uint8_t*>(data->PayloadData());
+        binary_set.Append(
+            key,
+            std::shared_ptr<uint8_t[]>(
+                std::shared_ptr<storage::DataCodec>(std::move(data)), payload),
+            size);
+    };
+
     // start read file span with active scope
     {
         auto read_file_span =
@@ -235,55 +251,57 @@ VectorMemIndex<T>::Load(milvus::tracer::TraceContext ctx,
                     batch.push_back(index_file_prefix + file_name);
                 }
 
-                auto batch_data =
-                    file_manager_->LoadIndexToMemory(batch, load_priority);
-                int64_t payload_size = 0;
-                index_data_codecs.insert({prefix, IndexDataCodec{}});
-                auto& index_data_codec = index_data_codecs.at(prefix);
-                for (const auto& file_path : batch) {
-                    const std::string file_name =
-                        file_path.substr(file_path.find_last_of('/') + 1);
-                    AssertInfo(batch_data.find(file_name) != batch_data.end(),
-                               "lost index slice data: {}",
-                               file_name);
-                    payload_size += batch_data[file_name]->PayloadSize();
-                    index_data_codec.codecs_.push_back(
-                        std::move(batch_data[file_name]));
+                size_t payload_size = 0;
+                std::shared_ptr<uint8_t[]> buf;
+                if (slice_num > 1) {
+                    buf = std::shared_ptr<uint8_t[]>(new uint8_t[total_len]);
                 }
+                int slice_id = 0;
+                file_manager_->StreamIndexToMemory(
+                    batch,
+                    load_priority,
+                    [&](const std::string& file_name,
+                        std::unique_ptr<storage::DataCodec> data) {
+                        auto expected = GenSlicedFileName(prefix, slice_id++);
+                        AssertInfo(file_name == expected,
+                                   "lost index slice data: {}",
+                                   expected);
+                        auto size = static_cast<size_t>(data->PayloadSize());
+                        AssertInfo(payload_size + size <= total_len,
+                                   "index len is inconsistent after "
+                                   "disassemble and assemble");
+                        if (buf == nullptr) {
+                            append_payload(prefix, std::move(data));
+                        } else {
+                            std::memcpy(buf.get() + payload_size,
+                                        data->PayloadData(),
+                                        size);
+                        }
+                        payload_size += size;
+                    });
                 for (auto& file : batch) {
                     pending_index_files.erase(file);
                 }
                 AssertInfo(
                     payload_size == total_len,
                     "index len is inconsistent after disassemble and assemble");
-                index_data_codec.size_ = payload_size;
+                if (buf != nullptr) {
+                    binary_set.Append(prefix, buf, total_len);
+                }
             }
         }
 
         if (!pending_index_files.empty()) {
-            auto result = file_manager_->LoadIndexToMemory(
+            file_manager_->StreamIndexToMemory(
                 std::vector<std::string>(pending_index_files.begin(),
                                          pending_index_files.end()),
-                load_priority);
-            for (auto&& index_data : result) {
-                auto prefix = index_data.first;
-                index_data_codecs.insert({prefix, IndexDataCodec{}});
-                auto& index_data_codec = index_data_codecs.at(prefix);
-                index_data_codec.size_ = index_data.second->PayloadSize();
-                index_data_codec.codecs_.push_back(
-                    std::move(index_data.second));
-            }
+                load_priority,
+                append_payload);
         }
 
         read_file_span->End();
     }
 
-    LOG_INFO("construct binary set...");
-    BinarySet binary_set;
-    AssembleIndexDatas(index_data_codecs, binary_set);
-    // clear index_data_codecs to free memory early
-    index_data_codecs.clear();
-
     // start engine load index span
     auto span_load_engine =
         milvus::tracer::StartSpan("SegCoreEngineLoadIndex", &ctx);
@@ -628,9 +646,6 @@ void VectorMemIndex<T>::LoadFromFile(const Config& config) {
 
     LOG_INFO("load index files: {}", index_files.value().size());
 
-    auto parallel_degree =
-        static_cast<uint64_t>(DEFAULT_FIELD_MAX_MEMORY_LIMIT / FILE_SLICE_SIZE);
-
     // try to read slice meta first
     std::string slice_meta_filepath;
     for (auto& idx_filepath : pending_index_files) {
@@ -653,9 +668,6 @@ void VectorMemIndex<T>::LoadFromFile(const Config& config) {
              .empty()) {  // load with the slice meta info, then we can load batch by batch
         std::string index_file_prefix = slice_meta_filepath.substr(
             0, slice_meta_filepath.find_last_of('/') + 1);
-        std::vector<std::string> batch{};
-        batch.reserve(parallel_degree);
-
         auto result = file_manager_->LoadIndexToMemory({slice_meta_filepath},
                                                        load_priority);
         auto raw_slice_meta = std::move(result[INDEX_FILE_SLICE_META]);
@@ -666,18 +678,27 @@ void VectorMemIndex<T>::LoadFromFile(const Config& config) {
         for (auto& item : meta_data[META]) {
             std::string prefix = item[NAME];
             int slice_num = item[SLICE_NUM];
-            auto total_len = static_cast<size_t>(item[TOTAL_LEN]);
-            auto HandleBatch = [&](int index) {
-                auto start_load2_mem = std::chrono::system_clock::now();
-                auto batch_data =
-                    file_manager_->LoadIndexToMemory(batch, load_priority);
-                load_duration_sum +=
-                    (std::chrono::system_clock::now() - start_load2_mem);
-                for (int j = index - batch.size() + 1; j <= index; j++) {
-                    std::string file_name = GenSlicedFileName(prefix, j);
-                    AssertInfo(batch_data.find(file_name) != batch_data.end(),
-                               "lost index slice data");
-                    auto&& data = batch_data[file_name];
+            std::vector<std::string> batch;
+            batch.reserve(slice_num);
+            for (auto i = 0; i < slice_num; ++i) {
+                std::string file_name = GenSlicedFileName(prefix, i);
+                batch.push_back(index_file_prefix + file_name);
+            }
+
+            // slices are written as they arrive while the next ones are
+            // downloaded
+            auto start_load2_mem = std::chrono::system_clock::now();
+            std::chrono::duration<double> write_duration{0};
+            int slice_id = 0;
+            file_manager_->StreamIndexToMemory(
+                batch,
+                load_priority,
+                [&](const std::string& file_name,
+                    std::unique_ptr<storage::DataCodec> data) {
+                    auto expected = GenSlicedFileName(prefix, slice_id++);
+                    AssertInfo(file_name == expected,
+                               "lost index slice data: {}",
+                               expected);
                     auto start_write_file = std::chrono::system_clock::now();
                     if (prefix == knowhere::meta::EMB_LIST_META &&
                         embedding_list_meta_writer_ptr) {
@@ -687,24 +708,14 @@ void VectorMemIndex<T>::LoadFromFile(const Config& config) {
                         file_writer.Write(data->PayloadData(),
                                           data->PayloadSize());
                     }
-                    write_disk_duration_sum +=
+                    write_duration +=
                         (std::chrono::system_clock::now() - start_write_file);
-                }
-                for (auto& file : batch) {
-                    pending_index_files.erase(file);
-                }
-                batch.clear();
-            };
-
-            for (auto i = 0; i < slice_num; ++i) {
-                std::string file_name = GenSlicedFileName(prefix, i);
-                batch.push_back(index_file_prefix + file_name);
-                if (batch.size() >= parallel_degree) {
-                    HandleBatch(i);
-                }
-            }
-            if (batch.size() > 0) {
-                HandleBatch(slice_num - 1);
+                });
+            load_duration_sum += (std::chrono::system_clock::now() -
+                                  start_load2_mem - write_duration);
+            write_disk_duration_sum += write_duration;
+            for (auto& file : batch) {
+                pending_index_files.erase(file);
             }
         }
     }
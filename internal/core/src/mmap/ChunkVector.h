@@ -15,6 +15,11 @@
 // limitations under the License.
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
 #include "common/Utils.h"
 #include "common/Span.h"
 #include "mmap/ChunkData.h"
@@ -23,6 +28,73 @@
 #include "common/TypeTraits.h"
 
 namespace milvus {
+
+// Append-only directory of chunks that readers index without locking.
+// Chunk slots live in segments of doubling size which are never moved or
+// reallocated, so a published chunk keeps its address until clear().
+// Writers must serialize emplace_back among themselves, a new chunk is
+// published to readers by the release store of the size.
+template <typename ChunkImpl>
+class ChunkDirectory {
+ public:
+    ChunkDirectory() = default;
+    ChunkDirectory(const ChunkDirectory&) = delete;
+    ChunkDirectory&
+    operator=(const ChunkDirectory&) = delete;
+
+    int64_t
+    size() const {
+        return size_.load(std::memory_order_acquire);
+    }
+
+    ChunkImpl&
+    operator[](int64_t index) const {
+        auto [segment, pos] = locate(index);
+        return *segments_[segment][pos];
+    }
+
+    template <typename... Args>
+    ChunkImpl&
+    emplace_back(Args&&... args) {
+        auto index = size_.load(std::memory_order_relaxed);
+        auto [segment, pos] = locate(index);
+        AssertInfo(segment < kMaxSegments,
+                   fmt::format("too many chunks: {}", index));
+        if (pos == 0) {
+            segments_[segment] =
+                std::make_unique<std::unique_ptr<ChunkImpl>[]>(
+                    int64_t(1) << segment);
+        }
+        segments_[segment][pos] =
+            std::make_unique<ChunkImpl>(std::forward<Args>(args)...);
+        size_.store(index + 1, std::memory_order_release);
+        return *segments_[segment][pos];
+    }
+
+    // not safe against concurrent readers
+    void
+    clear() {
+        size_.store(0, std::memory_order_release);
+        for (auto& segment : segments_) {
+            segment.reset();
+        }
+    }
+
+ private:
+    // segment s holds chunks [2^s - 1, 2^(s+1) - 1)
+    static std::pair<int, int64_t>
+    locate(int64_t index) {
+        auto n = static_cast<uint64_t>(index) + 1;
+        int segment = 63 - __builtin_clzll(n);
+        return {segment, static_cast<int64_t>(n - (uint64_t(1) << segment))};
+    }
+
+    static constexpr int kMaxSegments = 48;
+    std::array<std::unique_ptr<std::unique_ptr<ChunkImpl>[]>, kMaxSegments>
+        segments_;
+    std::atomic<int64_t> size_{0};
+};
+
 template <typename Type>
 class ChunkVectorBase {
  public:
@@ -75,10 +147,10 @@ class ThreadSafeChunkVector : public ChunkVectorBase<Type> {
 
     void
     emplace_to_at_least(int64_t chunk_num, int64_t chunk_size) override {
-        std::unique_lock<std::shared_mutex> lck(this->mutex_);
         if (chunk_num <= this->counter_) {
             return;
         }
+        std::lock_guard<std::mutex> lck(write_mutex_);
         while (vec_.size() < chunk_num) {
             if constexpr (IsMmap) {
                 vec_.emplace_back(chunk_size, mmap_descriptor_);
@@ -89,6 +161,9 @@ class ThreadSafeChunkVector : public ChunkVectorBase<Type> {
         }
     }
 
+    // writers fill disjoint ranges of a chunk, so only the variable length
+    // mmap chunk, which allocates from the shared mmap chunk manager, needs
+    // to serialize them
     void
     copy_to_chunk(
         int64_t chunk_id,
@@ -96,7 +171,6 @@ class ThreadSafeChunkVector : public ChunkVectorBase<Type> {
         const Type* data,
         int64_t length,
         const std::optional<CheckDataValid>& check_data_valid) override {
-        std::unique_lock<std::shared_mutex> lck(mutex_);
         AssertInfo(chunk_id < this->counter_,
                    fmt::format("index out of range, index={}, counter_={}",
                                chunk_id,
@@ -112,13 +186,13 @@ class ThreadSafeChunkVector : public ChunkVectorBase<Type> {
                     vec_[chunk_id].size()));
             std::copy_n(data, length, ptr + offset);
         } else {
+            std::lock_guard<std::mutex> lck(write_mutex_);
             vec_[chunk_id].set(data, offset, length, check_data_valid);
         }
     }
 
     ChunkViewType<Type>
     view_element(int64_t chunk_id, int64_t chunk_offset) override {
-        std::shared_lock<std::shared_mutex> lck(mutex_);
         auto& chunk = vec_[chunk_id];
         if constexpr (IsMmap) {
             return chunk.view(chunk_offset);
@@ -146,7 +220,6 @@ class ThreadSafeChunkVector : public ChunkVectorBase<Type> {
 
     void*
     get_chunk_data(int64_t index) override {
-        std::shared_lock<std::shared_mutex> lck(mutex_);
         AssertInfo(index < this->counter_,
                    fmt::format("index out of range, index={}, counter_={}",
                                index,
@@ -156,7 +229,6 @@ class ThreadSafeChunkVector : public ChunkVectorBase<Type> {
 
     int64_t
     get_chunk_size(int64_t index) override {
-        std::shared_lock<std::shared_mutex> lck(mutex_);
         AssertInfo(index < this->counter_,
                    fmt::format("index out of range, index={}, counter_={}",
                                index,
@@ -166,14 +238,13 @@ class ThreadSafeChunkVector : public ChunkVectorBase<Type> {
 
     void
     clear() override {
-        std::unique_lock<std::shared_mutex> lck(mutex_);
+        std::lock_guard<std::mutex> lck(write_mutex_);
         this->counter_ = 0;
         vec_.clear();
     }
 
     int64_t
     get_element_size() override {
-        std::shared_lock<std::shared_mutex> lck(mutex_);
         if constexpr (IsMmap && std::is_same_v<std::string, Type>) {
             return sizeof(ChunkViewType<Type>);
         }
@@ -182,7 +253,6 @@ class ThreadSafeChunkVector : public ChunkVectorBase<Type> {
 
     int64_t
     get_element_offset(int64_t index) override {
-        std::shared_lock<std::shared_mutex> lck(mutex_);
         int64_t offset = 0;
         for (int i = 0; i < index; i++) {
             offset += vec_[i].size();
@@ -192,7 +262,6 @@ class ThreadSafeChunkVector : public ChunkVectorBase<Type> {
 
     SpanBase
     get_span(int64_t chunk_id) override {
-        std::shared_lock<std::shared_mutex> lck(mutex_);
         if constexpr (IsMmap && std::is_same_v<std::string, Type>) {
             return SpanBase(get_chunk_data(chunk_id),
                             get_chunk_size(chunk_id),
@@ -210,9 +279,10 @@ class ThreadSafeChunkVector : public ChunkVectorBase<Type> {
     }
 
  private:
-    mutable std::shared_mutex mutex_;
+    // readers never lock, writers only serialize chunk growth
+    std::mutex write_mutex_;
     storage::MmapChunkDescriptorPtr mmap_descriptor_ = nullptr;
-    std::deque<ChunkImpl> vec_;
+    ChunkDirectory<ChunkImpl> vec_;
 };
 
 template <typename Type>
@@ -179,6 +179,10 @@ std::map<std::string, std::string> optimizeExprLatencyLabels{
     {"type", "optimize_expr_latency"}};
 std::map<std::string, std::string> filterRatioLabels{
     {"type", "expr_filter_ratio"}};
+std::map<std::string, std::string> estimatedFilterRatioLabels{
+    {"type", "estimated_filter_ratio"}};
+std::map<std::string, std::string> filterRatioEstimateErrorLabels{
+    {"type", "filter_ratio_estimate_error"}};
 
 DEFINE_PROMETHEUS_HISTOGRAM_FAMILY(internal_core_search_latency,
                                    "[cpp]latency(us) of search on segment")
@@ -221,6 +225,30 @@ DEFINE_PROMETHEUS_HISTOGRAM_WITH_BUCKETS(internal_core_expr_filter_ratio,
                                          internal_core_search_latency,
                                          filterRatioLabels,
                                          ratioBuckets)
+DEFINE_PROMETHEUS_HISTOGRAM_WITH_BUCKETS(internal_core_estimated_filter_ratio,
+                                         internal_core_search_latency,
+                                         estimatedFilterRatioLabels,
+                                         ratioBuckets)
+DEFINE_PROMETHEUS_HISTOGRAM_WITH_BUCKETS(
+    internal_core_filter_ratio_estimate_error,
+    internal_core_search_latency,
+    filterRatioEstimateErrorLabels,
+    ratioBuckets)
+
+// filter strategies chosen by adaptive filter execution
+std::map<std::string, std::string> preFilterStrategyLabels{
+    {"strategy", "pre_filter"}};
+std::map<std::string, std::string> iterativeFilterStrategyLabels{
+    {"strategy", "iterative_filter"}};
+DEFINE_PROMETHEUS_COUNTER_FAMILY(
+    internal_core_search_filter_strategy,
+    "[cpp]filter strategies chosen per segment by adaptive filter execution")
+DEFINE_PROMETHEUS_COUNTER(internal_core_search_filter_strategy_pre_filter,
+                          internal_core_search_filter_strategy,
+                          preFilterStrategyLabels)
+DEFINE_PROMETHEUS_COUNTER(internal_core_search_filter_strategy_iterative_filter,
+                          internal_core_search_filter_strategy,
+                          iterativeFilterStrategyLabels)
 // mmap metrics
 std::map<std::string, std::string> mmapAllocatedSpaceAnonLabel = {
     {"type", "anon"}};
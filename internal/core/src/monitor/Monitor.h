@@ -80,6 +80,12 @@ DECLARE_PROMETHEUS_HISTOGRAM(internal_core_search_get_target_entry_latency);
 DECLARE_PROMETHEUS_HISTOGRAM(internal_core_search_latency_random_sample);
 DECLARE_PROMETHEUS_HISTOGRAM(internal_core_optimize_expr_latency);
 DECLARE_PROMETHEUS_HISTOGRAM(internal_core_expr_filter_ratio);
+DECLARE_PROMETHEUS_HISTOGRAM(internal_core_estimated_filter_ratio);
+DECLARE_PROMETHEUS_HISTOGRAM(internal_core_filter_ratio_estimate_error);
+DECLARE_PROMETHEUS_COUNTER_FAMILY(internal_core_search_filter_strategy);
+DECLARE_PROMETHEUS_COUNTER(internal_core_search_filter_strategy_pre_filter);
+DECLARE_PROMETHEUS_COUNTER(
+    internal_core_search_filter_strategy_iterative_filter);
 
 // async cgo metrics
 DECLARE_PROMETHEUS_HISTOGRAM_FAMILY(internal_cgo_queue_duration_seconds);
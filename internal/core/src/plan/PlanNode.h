@@ -17,9 +17,11 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
+#include "common/Aggregation.h"
 #include "common/Types.h"
 #include "common/Vector.h"
 #include "expr/ITypeExpr.h"
@@ -350,6 +352,170 @@ class CountNode : public PlanNode {
     const std::vector<PlanNodePtr> sources_;
 };
 
+struct Aggregate {
+    AggregateFunction function;
+    // none only for COUNT(*)
+    std::optional<expr::ColumnInfo> column;
+};
+
+class AggregationNode : public PlanNode {
+ public:
+    AggregationNode(
+        const PlanNodeId& id,
+        std::vector<expr::ColumnInfo> group_by,
+        std::vector<Aggregate> aggregates,
+        const std::vector<PlanNodePtr>& sources = std::vector<PlanNodePtr>{})
+        : PlanNode(id),
+          group_by_(std::move(group_by)),
+          aggregates_(std::move(aggregates)),
+          sources_{sources} {
+        for (auto& column : group_by_) {
+            AssertInfo(IsNumericDataType(column.data_type_) ||
+                           IsStringDataType(column.data_type_) ||
+                           IsJsonDataType(column.data_type_),
+                       "can not group by column of type {}",
+                       column.data_type_);
+        }
+        for (auto& aggregate : aggregates_) {
+            AssertInfo(aggregate.column.has_value() ||
+                           aggregate.function == AggregateFunction::kCount,
+                       "{} requires a column",
+                       AggregateFunctionName(aggregate.function));
+            if (aggregate.function == AggregateFunction::kSum ||
+                aggregate.function == AggregateFunction::kAvg) {
+                auto data_type = aggregate.column->data_type_;
+                AssertInfo(IsNumericDataType(data_type) ||
+                               IsJsonDataType(data_type),
+                           "{} of non-numeric column of type {}",
+                           AggregateFunctionName(aggregate.function),
+                           data_type);
+            }
+        }
+    }
+
+    DataType
+    output_type() const override {
+        return DataType::INT64;
+    }
+
+    std::vector<PlanNodePtr>
+    sources() const override {
+        return sources_;
+    }
+
+    const std::vector<expr::ColumnInfo>&
+    group_by() const {
+        return group_by_;
+    }
+
+    const std::vector<Aggregate>&
+    aggregates() const {
+        return aggregates_;
+    }
+
+    std::string_view
+    name() const override {
+        return "AggregationNode";
+    }
+
+    std::string
+    ToString() const override {
+        std::vector<std::string> group_by;
+        for (auto& column : group_by_) {
+            group_by.emplace_back(column.ToString());
+        }
+        std::vector<std::string> aggregates;
+        for (auto& aggregate : aggregates_) {
+            aggregates.emplace_back(fmt::format(
+                "{}({})",
+                AggregateFunctionName(aggregate.function),
+                aggregate.column.has_value() ? aggregate.column->ToString()
+                                             : "*"));
+        }
+        return fmt::format(
+            "AggregationNode:\n\t[group_by:{}]\n\t[aggregates:{}]\n\t[source "
+            "node:{}]",
+            Join(group_by, ","),
+            Join(aggregates, ","),
+            SourceToString());
+    }
+
+ private:
+    const std::vector<expr::ColumnInfo> group_by_;
+    const std::vector<Aggregate> aggregates_;
+    const std::vector<PlanNodePtr> sources_;
+};
+
+// Keeps the limit rows of the smallest values of column, or the largest if
+// descending, ordered by value. Null values come last.
+class OrderByNode : public PlanNode {
+ public:
+    OrderByNode(
+        const PlanNodeId& id,
+        expr::ColumnInfo column,
+        bool descending,
+        int64_t limit,
+        const std::vector<PlanNodePtr>& sources = std::vector<PlanNodePtr>{})
+        : PlanNode(id),
+          column_(std::move(column)),
+          descending_(descending),
+          limit_(limit),
+          sources_{sources} {
+        AssertInfo(IsNumericDataType(column_.data_type_) ||
+                       IsStringDataType(column_.data_type_),
+                   "can not order by column of type {}",
+                   column_.data_type_);
+        AssertInfo(limit_ > 0, "order by limit must be positive: {}", limit_);
+    }
+
+    DataType
+    output_type() const override {
+        return DataType::INT64;
+    }
+
+    std::vector<PlanNodePtr>
+    sources() const override {
+        return sources_;
+    }
+
+    const expr::ColumnInfo&
+    column() const {
+        return column_;
+    }
+
+    bool
+    descending() const {
+        return descending_;
+    }
+
+    int64_t
+    limit() const {
+        return limit_;
+    }
+
+    std::string_view
+    name() const override {
+        return "OrderByNode";
+    }
+
+    std::string
+    ToString() const override {
+        return fmt::format(
+            "OrderByNode:\n\t[column:{}]\n\t[descending:{}]\n\t[limit:{}]"
+            "\n\t[source node:{}]",
+            column_.ToString(),
+            descending_,
+            limit_,
+            SourceToString());
+    }
+
+ private:
+    const expr::ColumnInfo column_;
+    const bool descending_;
+    const int64_t limit_;
+    const std::vector<PlanNodePtr> sources_;
+};
+
 class RescoresNode : public PlanNode {
  public:
     RescoresNode(
@@ -0,0 +1,345 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+#include "query/BlockedBruteForce.h"
+#include "common/Common.h"
+#include "common/Consts.h"
+#include "common/EasyAssert.h"
+#include "common/Utils.h"
+
+namespace milvus::query {
+
+namespace {
+
+// bytes of float base vectors scored against a whole query batch, sized to
+// stay in L2 next to the queries
+constexpr int64_t kBaseTileBytes = 128 * 1024;
+// queries sharing each load of a base vector
+constexpr int64_t kQueryRegs = 4;
+// independent accumulators per query, wide enough to vectorize
+constexpr int64_t kLanes = 8;
+
+enum class BlockedMetric { L2, IP, COSINE };
+
+struct Candidate {
+    float distance;
+    int64_t offset;
+};
+
+// ties go to the smaller offset, like merging chunks in order
+template <bool is_desc>
+struct Better {
+    bool
+    operator()(const Candidate& a, const Candidate& b) const {
+        if (a.distance != b.distance) {
+            return is_desc ? a.distance > b.distance : a.distance < b.distance;
+        }
+        return a.offset < b.offset;
+    }
+};
+
+// heap with the worst of the current top-k at the front
+template <bool is_desc>
+void
+PushCandidate(std::vector<Candidate>& heap, int64_t topk, Candidate cand) {
+    Better<is_desc> better;
+    if (static_cast<int64_t>(heap.size()) < topk) {
+        heap.push_back(cand);
+        std::push_heap(heap.begin(), heap.end(), better);
+    } else if (better(cand, heap.front())) {
+        std::pop_heap(heap.begin(), heap.end(), better);
+        heap.back() = cand;
+        std::push_heap(heap.begin(), heap.end(), better);
+    }
+}
+
+template <typename T>
+void
+ToFloat(const T* src, int64_t n, float* dst) {
+    for (int64_t i = 0; i < n; ++i) {
+        dst[i] = static_cast<float>(src[i]);
+    }
+}
+
+float
+Norm(const float* x, int64_t dim) {
+    float sum = 0;
+    for (int64_t d = 0; d < dim; ++d) {
+        sum += x[d] * x[d];
+    }
+    return std::sqrt(sum);
+}
+
+// squared L2 distances or inner products of num_query consecutive queries
+// to one base vector
+template <BlockedMetric metric, int64_t num_query>
+void
+ScoreBase(const float* queries, int64_t dim, const float* base, float* out) {
+    float acc[num_query][kLanes] = {};
+    int64_t d = 0;
+    for (; d + kLanes <= dim; d += kLanes) {
+        for (int64_t q = 0; q < num_query; ++q) {
+            const float* x = queries + q * dim + d;
+            for (int64_t l = 0; l < kLanes; ++l) {
+                if constexpr (metric == BlockedMetric::L2) {
+                    auto diff = x[l] - base[d + l];
+                    acc[q][l] += diff * diff;
+                } else {
+                    acc[q][l] += x[l] * base[d + l];
+                }
+            }
+        }
+    }
+    for (int64_t q = 0; q < num_query; ++q) {
+        float sum = 0;
+        for (int64_t l = 0; l < kLanes; ++l) {
+            sum += acc[q][l];
+        }
+        const float* x = queries + q * dim;
+        for (int64_t t = d; t < dim; ++t) {
+            if constexpr (metric == BlockedMetric::L2) {
+                auto diff = x[t] - base[t];
+                sum += diff * diff;
+            } else {
+                sum += x[t] * base[t];
+            }
+        }
+        out[q] = sum;
+    }
+}
+
+template <typename T, BlockedMetric metric>
+void
+SearchBatch(const dataset::SearchDataset& query_ds,
+            const dataset::RawDataset& raw_ds,
+            const BitsetView& bitset,
+            int64_t query_begin,
+            int64_t query_end,
+            SubSearchResult& sub_result) {
+    constexpr bool is_desc = metric != BlockedMetric::L2;
+    auto dim = raw_ds.dim;
+    auto topk = query_ds.topk;
+    auto num_query = query_end - query_begin;
+
+    // queries as float, COSINE queries normalized so only the base norm is
+    // left to divide by
+    std::vector<float> queries(num_query * dim);
+    ToFloat(static_cast<const T*>(query_ds.query_data) + query_begin * dim,
+            num_query * dim,
+            queries.data());
+    if constexpr (metric == BlockedMetric::COSINE) {
+        for (int64_t q = 0; q < num_query; ++q) {
+            auto x = queries.data() + q * dim;
+            auto norm = Norm(x, dim);
+            if (norm > 0) {
+                std::transform(
+                    x, x + dim, x, [norm](float v) { return v / norm; });
+            }
+        }
+    }
+
+    auto base_data = static_cast<const T*>(raw_ds.raw_data);
+    auto tile_rows = std::max<int64_t>(
+        1, kBaseTileBytes / (dim * static_cast<int64_t>(sizeof(float))));
+    std::vector<float> tile;
+    if constexpr (!std::is_same_v<T, float>) {
+        tile.resize(tile_rows * dim);
+    }
+    std::vector<float> base_norms(tile_rows);
+    std::vector<int64_t> rows;
+    rows.reserve(tile_rows);
+    std::vector<std::vector<Candidate>> heaps(num_query);
+    for (auto& heap : heaps) {
+        heap.reserve(topk);
+    }
+
+    // scores of queries [q, q + n) to the base vector at row of the tile
+    auto push_scores = [&](int64_t q,
+                           int64_t n,
+                           int64_t tile_begin,
+                           int64_t row,
+                           const float* scores) {
+        auto offset = raw_ds.begin_id + tile_begin + row;
+        for (int64_t r = 0; r < n; ++r) {
+            auto distance = scores[r];
+            if constexpr (metric == BlockedMetric::COSINE) {
+                auto norm = base_norms[row];
+                distance = norm > 0 ? distance / norm : 0;
+            }
+            PushCandidate<is_desc>(heaps[q + r], topk, {distance, offset});
+        }
+    };
+
+    for (int64_t tile_begin = 0; tile_begin < raw_ds.num_raw_data;
+         tile_begin += tile_rows) {
+        auto tile_end = std::min(tile_begin + tile_rows, raw_ds.num_raw_data);
+        rows.clear();
+        for (auto i = tile_begin; i < tile_end; ++i) {
+            auto offset = raw_ds.begin_id + i;
+            if (!bitset.empty() &&
+                offset < static_cast<int64_t>(bitset.size()) &&
+                bitset.test(offset)) {
+                continue;
+            }
+            rows.push_back(i - tile_begin);
+        }
+        if (rows.empty()) {
+            continue;
+        }
+
+        const float* tile_data;
+        if constexpr (std::is_same_v<T, float>) {
+            tile_data = base_data + tile_begin * dim;
+        } else {
+            ToFloat(base_data + tile_begin * dim,
+                    (tile_end - tile_begin) * dim,
+                    tile.data());
+            tile_data = tile.data();
+        }
+        if constexpr (metric == BlockedMetric::COSINE) {
+            for (auto row : rows) {
+                base_norms[row] = Norm(tile_data + row * dim, dim);
+            }
+        }
+
+        float scores[kQueryRegs];
+        int64_t q = 0;
+        for (; q + kQueryRegs <= num_query; q += kQueryRegs) {
+            auto query = queries.data() + q * dim;
+            for (auto row : rows) {
+                ScoreBase<metric, kQueryRegs>(
+                    query, dim, tile_data + row * dim, scores);
+                push_scores(q, kQueryRegs, tile_begin, row, scores);
+            }
+        }
+        for (; q < num_query; ++q) {
+            auto query = queries.data() + q * dim;
+            for (auto row : rows) {
+                ScoreBase<metric, 1>(query, dim, tile_data + row * dim, scores);
+                push_scores(q, 1, tile_begin, row, scores);
+            }
+        }
+    }
+
+    auto init_value = SubSearchResult::init_value(query_ds.metric_type);
+    for (int64_t q = 0; q < num_query; ++q) {
+        auto& heap = heaps[q];
+        std::sort_heap(heap.begin(), heap.end(), Better<is_desc>());
+        auto offsets = sub_result.get_seg_offsets() + (query_begin + q) * topk;
+        auto distances = sub_result.get_distances() + (query_begin + q) * topk;
+        for (int64_t k = 0; k < topk; ++k) {
+            if (k < static_cast<int64_t>(heap.size())) {
+                offsets[k] = heap[k].offset;
+                distances[k] = heap[k].distance;
+            } else {
+                offsets[k] = INVALID_SEG_OFFSET;
+                distances[k] = init_value;
+            }
+        }
+    }
+}
+
+template <typename T>
+void
+SearchBatchByMetric(const dataset::SearchDataset& query_ds,
+                    const dataset::RawDataset& raw_ds,
+                    const BitsetView& bitset,
+                    int64_t query_begin,
+                    int64_t query_end,
+                    SubSearchResult& sub_result) {
+    auto& metric_type = query_ds.metric_type;
+    if (IsMetricType(metric_type, knowhere::metric::L2)) {
+        SearchBatch<T, BlockedMetric::L2>(
+            query_ds, raw_ds, bitset, query_begin, query_end, sub_result);
+    } else if (IsMetricType(metric_type, knowhere::metric::IP)) {
+        SearchBatch<T, BlockedMetric::IP>(
+            query_ds, raw_ds, bitset, query_begin, query_end, sub_result);
+    } else if (IsMetricType(metric_type, knowhere::metric::COSINE)) {
+        SearchBatch<T, BlockedMetric::COSINE>(
+            query_ds, raw_ds, bitset, query_begin, query_end, sub_result);
+    } else {
+        ThrowInfo(ErrorCode::Unsupported,
+                  "Unsupported metric type for blocked brute force search:{}",
+                  metric_type);
+    }
+}
+
+}  // namespace
+
+bool
+UseBlockedBruteForce(const dataset::SearchDataset& query_ds,
+                     const dataset::RawDataset& raw_ds,
+                     DataType data_type) {
+    auto min_nq = BLOCKED_BRUTE_FORCE_MIN_NQ.load();
+    if (min_nq <= 0 || query_ds.num_queries < min_nq || query_ds.topk <= 0 ||
+        raw_ds.dim <= 0) {
+        return false;
+    }
+    if (query_ds.query_offsets != nullptr ||
+        raw_ds.raw_data_offsets != nullptr) {
+        return false;
+    }
+    if (data_type != DataType::VECTOR_FLOAT &&
+        data_type != DataType::VECTOR_FLOAT16 &&
+        data_type != DataType::VECTOR_BFLOAT16 &&
+        data_type != DataType::VECTOR_INT8) {
+        return false;
+    }
+    auto& metric_type = query_ds.metric_type;
+    return IsMetricType(metric_type, knowhere::metric::L2) ||
+           IsMetricType(metric_type, knowhere::metric::IP) ||
+           IsMetricType(metric_type, knowhere::metric::COSINE);
+}
+
+void
+BlockedBruteForceSearch(const dataset::SearchDataset& query_ds,
+                        const dataset::RawDataset& raw_ds,
+                        const BitsetView& bitset,
+                        DataType data_type,
+                        int64_t query_begin,
+                        int64_t query_end,
+                        SubSearchResult& sub_result) {
+    AssertInfo(query_begin >= 0 && query_begin <= query_end &&
+                   query_end <= query_ds.num_queries,
+               "invalid query range [{}, {}) of {} queries",
+               query_begin,
+               query_end,
+               query_ds.num_queries);
+    switch (data_type) {
+        case DataType::VECTOR_FLOAT:
+            SearchBatchByMetric<float>(
+                query_ds, raw_ds, bitset, query_begin, query_end, sub_result);
+            break;
+        case DataType::VECTOR_FLOAT16:
+            SearchBatchByMetric<float16>(
+                query_ds, raw_ds, bitset, query_begin, query_end, sub_result);
+            break;
+        case DataType::VECTOR_BFLOAT16:
+            SearchBatchByMetric<bfloat16>(
+                query_ds, raw_ds, bitset, query_begin, query_end, sub_result);
+            break;
+        case DataType::VECTOR_INT8:
+            SearchBatchByMetric<int8>(
+                query_ds, raw_ds, bitset, query_begin, query_end, sub_result);
+            break;
+        default:
+            ThrowInfo(ErrorCode::Unsupported,
+                      "Unsupported dataType for blocked brute force search:{}",
+                      data_type);
+    }
+}
+
+}  // namespace milvus::query
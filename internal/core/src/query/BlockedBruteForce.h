@@ -0,0 +1,50 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include "common/BitsetView.h"
+#include "common/Types.h"
+#include "query/SubSearchResult.h"
+#include "query/helper.h"
+
+namespace milvus::query {
+
+// queries searched by one call of BlockedBruteForceSearch, the unit of work
+// spread over threads
+constexpr int64_t BLOCKED_SEARCH_QUERY_BATCH = 64;
+
+// Whether the top-k search of query_ds over raw_ds can run on the blocked
+// kernel: dense FLOAT, FLOAT16, BFLOAT16 or INT8 vectors without embedding
+// lists, L2, IP or COSINE metric, and at least BLOCKED_BRUTE_FORCE_MIN_NQ
+// queries.
+bool
+UseBlockedBruteForce(const dataset::SearchDataset& query_ds,
+                     const dataset::RawDataset& raw_ds,
+                     DataType data_type);
+
+// Searches queries [query_begin, query_end) of query_ds over raw_ds and
+// writes their top-k into sub_result, which has the layout of
+// BruteForceSearch. Base vectors are converted to float a tile at a time,
+// the tile stays in cache while every query of the batch is scored against
+// it, and each query keeps its own top-k heap, so the base data is read once
+// per batch instead of once per query. Bit i + raw_ds.begin_id of bitset
+// filters base vector i out.
+void
+BlockedBruteForceSearch(const dataset::SearchDataset& query_ds,
+                        const dataset::RawDataset& raw_ds,
+                        const BitsetView& bitset,
+                        DataType data_type,
+                        int64_t query_begin,
+                        int64_t query_end,
+                        SubSearchResult& sub_result);
+
+}  // namespace milvus::query
@@ -0,0 +1,256 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+
+#include "common/Common.h"
+#include "common/Utils.h"
+#include "query/BlockedBruteForce.h"
+#include "query/SearchBruteForce.h"
+
+using namespace milvus;
+using namespace milvus::query;
+
+namespace {
+
+// sets the min nq of the blocked kernel, which is off by default, for the
+// scope
+class ScopedBlockedMinNq {
+ public:
+    explicit ScopedBlockedMinNq(int64_t min_nq)
+        : saved_(BLOCKED_BRUTE_FORCE_MIN_NQ.load()) {
+        BLOCKED_BRUTE_FORCE_MIN_NQ.store(min_nq);
+    }
+
+    ~ScopedBlockedMinNq() {
+        BLOCKED_BRUTE_FORCE_MIN_NQ.store(saved_);
+    }
+
+ private:
+    int64_t saved_;
+};
+
+// checks the blocked kernel against scoring every base vector in double
+template <typename T>
+void
+CheckBlockedSearch(DataType data_type,
+                   const knowhere::MetricType& metric_type,
+                   int64_t nq,
+                   int64_t nb,
+                   int64_t dim,
+                   int64_t topk) {
+    std::default_random_engine er(42);
+    std::uniform_int_distribution<int> dist(-100, 100);
+    std::vector<T> queries(nq * dim);
+    std::vector<T> base(nb * dim);
+    for (auto& v : queries) {
+        v = T(static_cast<float>(dist(er)));
+    }
+    for (auto& v : base) {
+        v = T(static_cast<float>(dist(er)));
+    }
+    // base vectors start at segment offset begin_id
+    int64_t begin_id = 100;
+    BitsetType filtered(begin_id + nb);
+    for (int64_t i = 0; i < begin_id + nb; ++i) {
+        filtered[i] = er() % 3 == 0;
+    }
+
+    dataset::SearchDataset query_ds{
+        metric_type, nq, topk, -1, dim, queries.data()};
+    dataset::RawDataset raw_ds{begin_id, dim, nb, base.data()};
+    ASSERT_TRUE(UseBlockedBruteForce(query_ds, raw_ds, data_type));
+    SubSearchResult result(nq, topk, metric_type, -1);
+    for (int64_t begin = 0; begin < nq; begin += BLOCKED_SEARCH_QUERY_BATCH) {
+        auto end = std::min(nq, begin + BLOCKED_SEARCH_QUERY_BATCH);
+        BlockedBruteForceSearch(query_ds,
+                                raw_ds,
+                                BitsetView(filtered),
+                                data_type,
+                                begin,
+                                end,
+                                result);
+    }
+
+    auto is_desc = PositivelyRelated(metric_type);
+    for (int64_t q = 0; q < nq; ++q) {
+        std::vector<std::pair<double, int64_t>> expected;
+        for (int64_t i = 0; i < nb; ++i) {
+            if (filtered[begin_id + i]) {
+                continue;
+            }
+            double score = 0, query_norm = 0, base_norm = 0;
+            for (int64_t d = 0; d < dim; ++d) {
+                double x = float(queries[q * dim + d]);
+                double y = float(base[i * dim + d]);
+                score += IsMetricType(metric_type, knowhere::metric::L2)
+                             ? (x - y) * (x - y)
+                             : x * y;
+                query_norm += x * x;
+                base_norm += y * y;
+            }
+            if (IsMetricType(metric_type, knowhere::metric::COSINE)) {
+                score /= std::sqrt(query_norm * base_norm);
+            }
+            expected.emplace_back(is_desc ? -score : score, begin_id + i);
+        }
+        std::sort(expected.begin(), expected.end());
+        for (int64_t k = 0; k < topk; ++k) {
+            auto offset = result.get_seg_offsets()[q * topk + k];
+            auto distance = result.get_distances()[q * topk + k];
+            if (k >= static_cast<int64_t>(expected.size())) {
+                ASSERT_EQ(INVALID_SEG_OFFSET, offset);
+                continue;
+            }
+            auto score = is_desc ? -expected[k].first : expected[k].first;
+            ASSERT_NEAR(score, distance, 1e-4 * std::max(1.0, std::abs(score)));
+            // offsets of equal scores may come in either order
+            ASSERT_FALSE(filtered[offset]);
+        }
+    }
+}
+
+}  // namespace
+
+TEST(BlockedBruteForce, SameAsExhaustive) {
+    ScopedBlockedMinNq min_nq(32);
+    for (auto metric_type : {knowhere::metric::L2,
+                             knowhere::metric::IP,
+                             knowhere::metric::COSINE}) {
+        // query counts and dims off the register and lane widths
+        CheckBlockedSearch<float>(
+            DataType::VECTOR_FLOAT, metric_type, 70, 3000, 37, 10);
+        CheckBlockedSearch<float16>(
+            DataType::VECTOR_FLOAT16, metric_type, 33, 1000, 16, 5);
+        CheckBlockedSearch<bfloat16>(
+            DataType::VECTOR_BFLOAT16, metric_type, 32, 1000, 8, 5);
+        CheckBlockedSearch<int8>(
+            DataType::VECTOR_INT8, metric_type, 40, 500, 64, 7);
+        // fewer unfiltered base vectors than topk
+        CheckBlockedSearch<float>(
+            DataType::VECTOR_FLOAT, metric_type, 32, 20, 4, 30);
+    }
+}
+
+TEST(BlockedBruteForce, Fallback) {
+    std::vector<float> data(64 * 8);
+    dataset::SearchDataset query_ds{
+        knowhere::metric::L2, 64, 10, -1, 8, data.data()};
+    dataset::RawDataset raw_ds{0, 8, 64, data.data()};
+    // off by default
+    ASSERT_FALSE(
+        UseBlockedBruteForce(query_ds, raw_ds, DataType::VECTOR_FLOAT));
+
+    ScopedBlockedMinNq min_nq(32);
+    ASSERT_TRUE(UseBlockedBruteForce(query_ds, raw_ds, DataType::VECTOR_FLOAT));
+    ASSERT_FALSE(
+        UseBlockedBruteForce(query_ds, raw_ds, DataType::VECTOR_BINARY));
+
+    query_ds.num_queries = BLOCKED_BRUTE_FORCE_MIN_NQ.load() - 1;
+    ASSERT_FALSE(
+        UseBlockedBruteForce(query_ds, raw_ds, DataType::VECTOR_FLOAT));
+
+    query_ds.num_queries = 64;
+    query_ds.metric_type = knowhere::metric::HAMMING;
+    ASSERT_FALSE(
+        UseBlockedBruteForce(query_ds, raw_ds, DataType::VECTOR_FLOAT));
+}
+
+namespace {
+
+// checks BruteForceSearch on the blocked kernel against knowhere
+template <typename T>
+void
+CheckSameAsKnowhere(DataType data_type,
+                    const knowhere::MetricType& metric_type,
+                    int64_t nq,
+                    int64_t nb,
+                    int64_t dim,
+                    int64_t topk) {
+    std::default_random_engine er(7);
+    std::uniform_int_distribution<int> dist(-100, 100);
+    std::vector<T> queries(nq * dim);
+    std::vector<T> base(nb * dim);
+    for (auto& v : queries) {
+        v = T(static_cast<float>(dist(er)));
+    }
+    for (auto& v : base) {
+        v = T(static_cast<float>(dist(er)));
+    }
+    BitsetType filtered(nb);
+    for (int64_t i = 0; i < nb; ++i) {
+        filtered[i] = er() % 4 == 0;
+    }
+
+    SearchInfo search_info;
+    search_info.topk_ = topk;
+    search_info.metric_type_ = metric_type;
+    dataset::SearchDataset query_ds{
+        metric_type, nq, topk, -1, dim, queries.data()};
+    dataset::RawDataset raw_ds{0, dim, nb, base.data()};
+    auto search = [&]() {
+        return BruteForceSearch(query_ds,
+                                raw_ds,
+                                search_info,
+                                {},
+                                BitsetView(filtered),
+                                data_type,
+                                DataType::NONE,
+                                nullptr);
+    };
+    auto expected = search();
+    ScopedBlockedMinNq min_nq(1);
+    ASSERT_TRUE(UseBlockedBruteForce(query_ds, raw_ds, data_type));
+    auto result = search();
+
+    auto near = [](float a, float b) {
+        return std::abs(a - b) <=
+               1e-4 * std::max(1.0f, std::max(std::abs(a), std::abs(b)));
+    };
+    for (int64_t q = 0; q < nq; ++q) {
+        auto offsets = expected.get_seg_offsets() + q * topk;
+        auto distances = expected.get_distances() + q * topk;
+        for (int64_t k = 0; k < topk; ++k) {
+            auto i = q * topk + k;
+            ASSERT_TRUE(near(distances[k], result.get_distances()[i]))
+                << metric_type << " " << data_type << " query " << q
+                << " rank " << k << ": " << distances[k] << " vs "
+                << result.get_distances()[i];
+            // the offsets of equal distances may come in either order
+            bool tied = (k > 0 && near(distances[k], distances[k - 1])) ||
+                        (k + 1 < topk && near(distances[k], distances[k + 1]));
+            if (!tied) {
+                ASSERT_EQ(offsets[k], result.get_seg_offsets()[i])
+                    << metric_type << " " << data_type << " query " << q
+                    << " rank " << k;
+            }
+        }
+    }
+}
+
+}  // namespace
+
+TEST(BlockedBruteForce, SameAsKnowhere) {
+    for (auto metric_type : {knowhere::metric::L2,
+                             knowhere::metric::IP,
+                             knowhere::metric::COSINE}) {
+        CheckSameAsKnowhere<float>(
+            DataType::VECTOR_FLOAT, metric_type, 70, 2000, 37, 10);
+        CheckSameAsKnowhere<float16>(
+            DataType::VECTOR_FLOAT16, metric_type, 33, 1000, 16, 5);
+        CheckSameAsKnowhere<bfloat16>(
+            DataType::VECTOR_BFLOAT16, metric_type, 32, 1000, 8, 5);
+        CheckSameAsKnowhere<int8>(
+            DataType::VECTOR_INT8, metric_type, 40, 500, 64, 7);
+    }
+}
@@ -11,10 +11,14 @@
 
 #include "query/ExecPlanNodeVisitor.h"
 
+#include <cmath>
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include "expr/ITypeExpr.h"
+#include "monitor/Monitor.h"
+#include "query/FilterStrategy.h"
 #include "query/PlanImpl.h"
 #include "query/SubSearchResult.h"
 #include "query/Utils.h"
@@ -93,9 +97,6 @@ ExecPlanNodeVisitor::VectorVisitorImpl(VectorPlanNode& node) {
         return;
     }
 
-    // Construct plan fragment
-    auto plan = plan::PlanFragment(node.plannodes_);
-
     // Set query context
     auto query_context =
         std::make_shared<milvus::exec::QueryContext>(DEAFULT_QUERY_ID,
@@ -113,9 +114,61 @@ ExecPlanNodeVisitor::VectorVisitorImpl(VectorPlanNode& node) {
     auto op_context = milvus::OpContext();
     query_context->set_op_context(&op_context);
 
+    // Construct plan fragment, of the filter strategy cheaper on this segment
+    // for adaptive filter execution
+    auto plannodes = node.plannodes_;
+    // the hint is kept for group by, which still runs the pre filter plan
+    bool iterative_filter = node.search_info_.iterative_filter_execution &&
+                            !node.search_info_.group_by_field_id_.has_value();
+    std::optional<double> estimated_selectivity;
+    if (node.search_info_.adaptive_filter_execution &&
+        node.iterative_plannodes_ != nullptr &&
+        SupportsIterativeFilter(node.search_info_)) {
+        estimated_selectivity =
+            EstimateFilterSelectivity(query_context.get(), node.filter_);
+        auto strategy = ChooseFilterStrategy(
+            estimated_selectivity,
+            active_count,
+            placeholder_group_->at(0).num_of_queries_,
+            node.search_info_.topk_,
+            segment->HasIndex(node.search_info_.field_id_));
+        if (strategy == FilterStrategy::kIterativeFilter) {
+            auto search_info = node.search_info_;
+            search_info.iterative_filter_execution = true;
+            query_context->set_search_info(search_info);
+            plannodes = node.iterative_plannodes_;
+            iterative_filter = true;
+            monitor::internal_core_search_filter_strategy_iterative_filter
+                .Increment();
+        } else {
+            monitor::internal_core_search_filter_strategy_pre_filter
+                .Increment();
+        }
+        tracer::AddEvent(
+            fmt::format("filter_strategy: {}, estimated_selectivity: {}",
+                        FilterStrategyName(strategy),
+                        estimated_selectivity.value_or(-1)));
+    }
+    // the pre filter scans every row anyway, so deletes are masked along,
+    // search iterator v2 returns its batches without the iterative filter
+    // node, so it can't leave the deletes to it
+    if (iterative_filter && !node.search_info_.iterator_v2_info_.has_value() &&
+        UseLazyDelete(segment->get_deleted_count(), active_count)) {
+        query_context->set_lazy_delete(true);
+    }
+    auto plan = plan::PlanFragment(plannodes);
+
     // Do plan fragment task work
     auto result = ExecuteTask(plan, query_context);
 
+    auto selectivity = query_context->get_filter_selectivity();
+    if (estimated_selectivity.has_value() && selectivity.has_value()) {
+        monitor::internal_core_estimated_filter_ratio.Observe(
+            estimated_selectivity.value());
+        monitor::internal_core_filter_ratio_estimate_error.Observe(
+            std::abs(estimated_selectivity.value() - selectivity.value()));
+    }
+
     // Store result
     search_result_opt_ = std::move(query_context->get_search_result());
     search_result_opt_->search_storage_cost_.scanned_remote_bytes =
@@ -180,7 +233,13 @@ ExecPlanNodeVisitor::visit(RetrievePlanNode& node) {
     auto bitset_holder = ExecuteTask(plan, query_context);
 
     // Store result
-    if (node.is_count_) {
+    // operators that produce the whole retrieve result
+    auto is_aggregation =
+        std::dynamic_pointer_cast<const plan::AggregationNode>(
+            node.plannodes_) != nullptr;
+    auto is_order_by = std::dynamic_pointer_cast<const plan::OrderByNode>(
+                           node.plannodes_) != nullptr;
+    if (node.is_count_ || is_aggregation || is_order_by) {
         retrieve_result_opt_ = std::move(query_context->get_retrieve_result());
         retrieve_result_opt_->retrieve_storage_cost_.scanned_remote_bytes =
             op_context.storage_usage.scanned_cold_bytes.load();
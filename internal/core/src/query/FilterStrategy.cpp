@@ -0,0 +1,109 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "query/FilterStrategy.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "common/Consts.h"
+#include "common/EasyAssert.h"
+#include "exec/expression/EvalCtx.h"
+#include "exec/expression/Expr.h"
+
+namespace milvus::query {
+
+std::string_view
+FilterStrategyName(FilterStrategy strategy) {
+    switch (strategy) {
+        case FilterStrategy::kPreFilter:
+            return "pre_filter";
+        case FilterStrategy::kIterativeFilter:
+            return "iterative_filter";
+    }
+    return "unknown";
+}
+
+std::optional<double>
+EstimateFilterSelectivity(exec::QueryContext* query_context,
+                          const expr::TypedExprPtr& filter,
+                          int64_t sample_rows) {
+    auto active_count = query_context->get_active_count();
+    if (active_count == 0 || sample_rows <= 0) {
+        return std::nullopt;
+    }
+    exec::ExecContext exec_context(query_context);
+    exec::ExprSet exprs({filter}, &exec_context);
+    for (const auto& expr : exprs.exprs()) {
+        if (!expr->SupportOffsetInput()) {
+            return std::nullopt;
+        }
+    }
+
+    // evenly spread rows, starting half a stride in so that neither end of
+    // the segment is over-represented
+    auto num_samples = std::min(sample_rows, active_count);
+    exec::OffsetVector offsets;
+    offsets.reserve(num_samples);
+    for (int64_t i = 0; i < num_samples; ++i) {
+        offsets.push_back(
+            static_cast<int32_t>((2 * i + 1) * active_count / (2 * num_samples)));
+    }
+
+    exec::EvalCtx eval_ctx(&exec_context, &exprs);
+    eval_ctx.set_offset_input(&offsets);
+    std::vector<VectorPtr> results;
+    exprs.Eval(0, 1, true, eval_ctx, results);
+    AssertInfo(results.size() == 1 && results[0] != nullptr,
+               "filter selectivity sample result size should be size one and "
+               "not be nullptr");
+    auto col_vec = std::dynamic_pointer_cast<ColumnVector>(results[0]);
+    AssertInfo(col_vec != nullptr && col_vec->IsBitmap(),
+               "filter selectivity sample result should be bitmap");
+    TargetBitmapView view(col_vec->GetRawData(), col_vec->size());
+    AssertInfo(view.size() == offsets.size(),
+               "filter selectivity sample result size {} not equal to "
+               "sampled rows {}",
+               view.size(),
+               offsets.size());
+    return static_cast<double>(view.count()) / view.size();
+}
+
+bool
+SupportsIterativeFilter(const SearchInfo& search_info) {
+    return !search_info.iterator_v2_info_.has_value() &&
+           !search_info.search_params_.contains(RADIUS);
+}
+
+FilterStrategy
+ChooseFilterStrategy(std::optional<double> selectivity,
+                     int64_t active_count,
+                     int64_t nq,
+                     int64_t topk,
+                     bool has_vector_index) {
+    if (!has_vector_index || !selectivity.has_value() ||
+        selectivity.value() < ADAPTIVE_FILTER_MIN_ITERATIVE_SELECTIVITY) {
+        return FilterStrategy::kPreFilter;
+    }
+    auto iterative_cost = nq * topk / selectivity.value() *
+                          ADAPTIVE_FILTER_ITERATIVE_ROW_COST;
+    return iterative_cost < active_count ? FilterStrategy::kIterativeFilter
+                                         : FilterStrategy::kPreFilter;
+}
+
+bool
+UseLazyDelete(int64_t deleted_count, int64_t active_count) {
+    // without deletes the mask is already skipped
+    return deleted_count > 0 &&
+           deleted_count <= active_count * LAZY_DELETE_MAX_DELETED_RATIO;
+}
+
+}  // namespace milvus::query
@@ -0,0 +1,80 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include "common/QueryInfo.h"
+#include "exec/QueryContext.h"
+#include "expr/ITypeExpr.h"
+
+namespace milvus::query {
+
+enum class FilterStrategy {
+    // filter every row into a bitset and search around it, a search over
+    // few unfiltered rows ends up brute force on them
+    kPreFilter,
+    // search with vector iterators and filter the candidates they return
+    kIterativeFilter,
+};
+
+std::string_view
+FilterStrategyName(FilterStrategy strategy);
+
+// rows of a segment the filter is evaluated on to estimate its selectivity
+constexpr int64_t ADAPTIVE_FILTER_SAMPLE_ROWS = 256;
+// the iterative filter is not chosen below this estimated selectivity, its
+// iterators would walk most of the index to fill the top-k
+constexpr double ADAPTIVE_FILTER_MIN_ITERATIVE_SELECTIVITY = 0.1;
+// cost of pulling a candidate from an iterator and filtering it on its own,
+// in rows filtered by the pre filter
+constexpr int64_t ADAPTIVE_FILTER_ITERATIVE_ROW_COST = 32;
+
+// Fraction of the active rows of the segment of query_context passing
+// filter, estimated on sample_rows rows spread evenly over the segment.
+// Returns std::nullopt when filter can not be evaluated on single rows.
+std::optional<double>
+EstimateFilterSelectivity(exec::QueryContext* query_context,
+                          const expr::TypedExprPtr& filter,
+                          int64_t sample_rows = ADAPTIVE_FILTER_SAMPLE_ROWS);
+
+// Whether the adaptive strategy may pick the iterative filter for a search.
+// Search iterator v2 and range search return their results without vector
+// iterators, so the iterative filter would not filter them at all.
+bool
+SupportsIterativeFilter(const SearchInfo& search_info);
+
+// Picks the cheaper strategy for a search of nq queries for topk results
+// over active_count rows. The pre filter costs a pass over every row, the
+// iterative filter about nq * topk / selectivity candidates, each costing
+// ADAPTIVE_FILTER_ITERATIVE_ROW_COST rows. Without a vector index there is
+// nothing to iterate cheaply, so the pre filter is kept.
+FilterStrategy
+ChooseFilterStrategy(std::optional<double> selectivity,
+                     int64_t active_count,
+                     int64_t nq,
+                     int64_t topk,
+                     bool has_vector_index);
+
+// deletes are checked on the candidates of the iterative filter only while
+// at most this fraction of the rows is deleted, beyond it the iterators pull
+// too many deleted rows to be cheaper than a mask of the whole segment
+constexpr double LAZY_DELETE_MAX_DELETED_RATIO = 0.05;
+
+// Whether the iterative filter over active_count rows checks its candidates
+// against deleted_count deletes instead of the mvcc node masking every row.
+bool
+UseLazyDelete(int64_t deleted_count, int64_t active_count);
+
+}  // namespace milvus::query
@@ -0,0 +1,295 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <google/protobuf/text_format.h>
+
+#include <unordered_set>
+
+#include "common/Schema.h"
+#include "query/FilterStrategy.h"
+#include "query/Plan.h"
+#include "query/PlanImpl.h"
+#include "test_utils/cachinglayer_test_utils.h"
+#include "test_utils/DataGen.h"
+#include "test_utils/storage_test_utils.h"
+
+using namespace milvus;
+using namespace milvus::query;
+using namespace milvus::segcore;
+
+namespace {
+
+constexpr int64_t N = 1000;
+constexpr int64_t DIM = 16;
+
+// search plan for the top-k of values < bound, with hints and extra fields
+// of the query info
+std::string
+SearchPlan(int64_t topk,
+           int64_t bound,
+           const std::string& hints,
+           const std::string& query_info_extra = "") {
+    return fmt::format(R"(vector_anns: <
+                            field_id: 100
+                            predicates: <
+                              unary_range_expr: <
+                                column_info: <
+                                  field_id: 102
+                                  data_type: Int64
+                                >
+                                op: LessThan
+                                value: <
+                                  int64_val: {}
+                                >
+                              >
+                            >
+                            query_info: <
+                              topk: {}
+                              metric_type: "L2"
+                              hints: "{}"
+                              search_params: "{{\"ef\": 50}}"
+                              {}
+                            >
+                            placeholder_tag: "$0">)",
+                       bound,
+                       topk,
+                       hints,
+                       query_info_extra);
+}
+
+}  // namespace
+
+class FilterStrategyTest : public ::testing::Test {
+ protected:
+    void
+    SetUp() override {
+        schema_ = std::make_shared<Schema>();
+        vec_fid_ = schema_->AddDebugField(
+            "vec", DataType::VECTOR_FLOAT, DIM, knowhere::metric::L2);
+        pk_fid_ = schema_->AddDebugField("pk", DataType::INT64);
+        schema_->set_primary_field_id(pk_fid_);
+        value_fid_ = schema_->AddDebugField("value", DataType::INT64);
+        dataset_ = std::make_unique<GeneratedData>(DataGen(schema_, N));
+        // values 0..99, evenly spread over the segment
+        auto value_col = dataset_->raw_->mutable_fields_data()
+                             ->at(2)
+                             .mutable_scalars()
+                             ->mutable_long_data()
+                             ->mutable_data();
+        for (int i = 0; i < N; ++i) {
+            value_col->at(i) = (i * 37) % 100;
+        }
+        segment_ = CreateSealedWithFieldDataLoaded(schema_, *dataset_);
+    }
+
+    void
+    LoadVectorIndex() {
+        auto vector_data = dataset_->get_col<float>(vec_fid_);
+        auto indexing = GenVecIndexing(
+            N, DIM, vector_data.data(), knowhere::IndexEnum::INDEX_HNSW);
+        LoadIndexInfo load_index_info;
+        load_index_info.field_id = vec_fid_.get();
+        load_index_info.index_params = GenIndexParams(indexing.get());
+        load_index_info.cache_index =
+            CreateTestCacheIndex("test", std::move(indexing));
+        load_index_info.index_params["metric_type"] = knowhere::metric::L2;
+        segment_->LoadIndex(load_index_info);
+    }
+
+    std::optional<double>
+    Estimate(int64_t bound) {
+        exec::QueryContext query_context(
+            "test", segment_.get(), N, MAX_TIMESTAMP);
+        proto::plan::GenericValue value;
+        value.set_int64_val(bound);
+        auto filter = std::make_shared<expr::UnaryRangeFilterExpr>(
+            expr::ColumnInfo(value_fid_, DataType::INT64),
+            proto::plan::OpType::LessThan,
+            value);
+        return EstimateFilterSelectivity(&query_context, filter);
+    }
+
+    std::unique_ptr<SearchResult>
+    Search(const std::string& raw_plan, std::unique_ptr<Plan>& plan) {
+        proto::plan::PlanNode plan_node;
+        EXPECT_TRUE(google::protobuf::TextFormat::ParseFromString(raw_plan,
+                                                                  &plan_node));
+        plan = CreateSearchPlanFromPlanNode(schema_, plan_node);
+        auto ph_group_raw = CreatePlaceholderGroup(1, DIM, 1024);
+        auto ph_group =
+            ParsePlaceholderGroup(plan.get(), ph_group_raw.SerializeAsString());
+        return segment_->Search(plan.get(), ph_group.get(), MAX_TIMESTAMP);
+    }
+
+    // the results of search pass the filter, and there are topk of them
+    void
+    CheckResult(const SearchResult& result, int64_t topk, int64_t bound) {
+        auto values = dataset_->get_col<int64_t>(value_fid_);
+        ASSERT_EQ(result.seg_offsets_.size(), topk);
+        for (auto offset : result.seg_offsets_) {
+            ASSERT_NE(offset, INVALID_SEG_OFFSET);
+            ASSERT_LT(values[offset], bound);
+        }
+    }
+
+    SchemaPtr schema_;
+    FieldId vec_fid_;
+    FieldId pk_fid_;
+    FieldId value_fid_;
+    std::unique_ptr<GeneratedData> dataset_;
+    SegmentSealedUPtr segment_;
+};
+
+TEST_F(FilterStrategyTest, EstimateSelectivity) {
+    for (int64_t bound : {0, 10, 50, 90, 100}) {
+        auto selectivity = Estimate(bound);
+        ASSERT_TRUE(selectivity.has_value());
+        ASSERT_NEAR(selectivity.value(), bound / 100.0, 0.05);
+    }
+}
+
+TEST_F(FilterStrategyTest, ChooseStrategy) {
+    // no vector index or no estimate
+    ASSERT_EQ(ChooseFilterStrategy(1.0, N, 1, 10, false),
+              FilterStrategy::kPreFilter);
+    ASSERT_EQ(ChooseFilterStrategy(std::nullopt, N, 1, 10, true),
+              FilterStrategy::kPreFilter);
+    // too selective for the iterators to fill the top-k
+    ASSERT_EQ(ChooseFilterStrategy(0.01, 1000000, 1, 10, true),
+              FilterStrategy::kPreFilter);
+    // few candidates to filter against a large segment
+    ASSERT_EQ(ChooseFilterStrategy(0.9, 1000000, 1, 10, true),
+              FilterStrategy::kIterativeFilter);
+    // many queries and a large top-k cost more than filtering every row
+    ASSERT_EQ(ChooseFilterStrategy(0.9, 1000000, 100, 1000, true),
+              FilterStrategy::kPreFilter);
+}
+
+TEST_F(FilterStrategyTest, UseLazyDelete) {
+    ASSERT_FALSE(UseLazyDelete(0, N));
+    ASSERT_TRUE(UseLazyDelete(N / 100, N));
+    ASSERT_FALSE(UseLazyDelete(N / 2, N));
+}
+
+TEST_F(FilterStrategyTest, AdaptivePlan) {
+    LoadVectorIndex();
+    std::unique_ptr<Plan> plan;
+    // filters out little, iterating is cheaper than filtering every row
+    auto result = Search(SearchPlan(1, 90, "adaptive_filter"), plan);
+    ASSERT_TRUE(plan->plan_node_->search_info_.adaptive_filter_execution);
+    ASSERT_NE(plan->plan_node_->iterative_plannodes_, nullptr);
+    ASSERT_NE(plan->plan_node_->filter_, nullptr);
+    CheckResult(*result, 1, 90);
+
+    // filters out most rows, the pre filter still fills the top-k
+    result = Search(SearchPlan(10, 3, "adaptive_filter"), plan);
+    CheckResult(*result, 10, 3);
+
+    // the iterative filter hint keeps a single plan
+    Search(SearchPlan(1, 90, "iterative_filter"), plan);
+    ASSERT_FALSE(plan->plan_node_->search_info_.adaptive_filter_execution);
+    ASSERT_EQ(plan->plan_node_->iterative_plannodes_, nullptr);
+}
+
+TEST_F(FilterStrategyTest, LazyDelete) {
+    LoadVectorIndex();
+    std::unique_ptr<Plan> plan;
+    auto result = Search(SearchPlan(10, 90, "iterative_filter"), plan);
+    CheckResult(*result, 10, 90);
+
+    // delete the nearest rows, few enough to be checked lazily
+    auto pks = dataset_->get_col<int64_t>(pk_fid_);
+    std::vector<int64_t> deleted_pks;
+    for (auto offset : result->seg_offsets_) {
+        deleted_pks.push_back(pks[offset]);
+    }
+    ASSERT_TRUE(UseLazyDelete(deleted_pks.size(), N));
+    auto ids = std::make_unique<IdArray>();
+    ids->mutable_int_id()->mutable_data()->Add(deleted_pks.begin(),
+                                               deleted_pks.end());
+    std::vector<Timestamp> timestamps(deleted_pks.size(), N * 10);
+    segment_->Delete(deleted_pks.size(), ids.get(), timestamps.data());
+
+    auto deleted = std::unordered_set<int64_t>(result->seg_offsets_.begin(),
+                                               result->seg_offsets_.end());
+    result = Search(SearchPlan(10, 90, "iterative_filter"), plan);
+    CheckResult(*result, 10, 90);
+    for (auto offset : result->seg_offsets_) {
+        ASSERT_EQ(deleted.count(offset), 0);
+    }
+}
+
+TEST_F(FilterStrategyTest, LazyDeleteSkipsSearchIteratorV2) {
+    LoadVectorIndex();
+    const std::string iterator_v2 =
+        R"(search_iterator_v2_info: < token: "lazy" batch_size: 10 >)";
+    std::unique_ptr<Plan> plan;
+    auto result =
+        Search(SearchPlan(10, 90, "iterative_filter", iterator_v2), plan);
+    ASSERT_TRUE(plan->plan_node_->search_info_.iterator_v2_info_.has_value());
+    ASSERT_FALSE(result->seg_offsets_.empty());
+
+    // delete the rows returned, few enough for the lazy delete
+    auto pks = dataset_->get_col<int64_t>(pk_fid_);
+    std::vector<int64_t> deleted_pks;
+    for (auto offset : result->seg_offsets_) {
+        if (offset != INVALID_SEG_OFFSET) {
+            deleted_pks.push_back(pks[offset]);
+        }
+    }
+    ASSERT_TRUE(UseLazyDelete(deleted_pks.size(), N));
+    auto ids = std::make_unique<IdArray>();
+    ids->mutable_int_id()->mutable_data()->Add(deleted_pks.begin(),
+                                               deleted_pks.end());
+    std::vector<Timestamp> timestamps(deleted_pks.size(), N * 10);
+    segment_->Delete(deleted_pks.size(), ids.get(), timestamps.data());
+
+    // the iterator batches are not checked by the iterative filter node,
+    // the mvcc node must still mask the deletes
+    auto deleted = std::unordered_set<int64_t>(result->seg_offsets_.begin(),
+                                               result->seg_offsets_.end());
+    const std::string next_iterator_v2 =
+        R"(search_iterator_v2_info: < token: "lazy-next" batch_size: 10 >)";
+    result =
+        Search(SearchPlan(10, 90, "iterative_filter", next_iterator_v2), plan);
+    ASSERT_FALSE(result->seg_offsets_.empty());
+    for (auto offset : result->seg_offsets_) {
+        ASSERT_EQ(deleted.count(offset), 0);
+    }
+}
+
+TEST_F(FilterStrategyTest, AdaptiveKeepsPreFilterWithoutIterators) {
+    SearchInfo search_info;
+    ASSERT_TRUE(SupportsIterativeFilter(search_info));
+    search_info.search_params_[RADIUS] = 10.0;
+    ASSERT_FALSE(SupportsIterativeFilter(search_info));
+    search_info.search_params_.erase(RADIUS);
+    search_info.iterator_v2_info_ = SearchIteratorV2Info{.token = "adaptive"};
+    ASSERT_FALSE(SupportsIterativeFilter(search_info));
+
+    // iterating would be cheaper, but the search iterator v2 batches must
+    // still go through the pre filter
+    LoadVectorIndex();
+    const std::string iterator_v2 =
+        R"(search_iterator_v2_info: < token: "adaptive" batch_size: 10 >)";
+    std::unique_ptr<Plan> plan;
+    auto result =
+        Search(SearchPlan(10, 90, "adaptive_filter", iterator_v2), plan);
+    ASSERT_NE(plan->plan_node_->iterative_plannodes_, nullptr);
+    auto values = dataset_->get_col<int64_t>(value_fid_);
+    ASSERT_FALSE(result->seg_offsets_.empty());
+    for (auto offset : result->seg_offsets_) {
+        if (offset != INVALID_SEG_OFFSET) {
+            ASSERT_LT(values[offset], 90);
+        }
+    }
+}
@@ -22,6 +22,9 @@
 namespace milvus::plan {
 class PlanNode;
 };
+namespace milvus::expr {
+class ITypeExpr;
+};
 namespace milvus::query {
 
 class PlanNodeVisitor;
@@ -50,6 +53,10 @@ struct VectorPlanNode : PlanNode {
     SearchInfo search_info_;
     std::string placeholder_tag_;
     std::shared_ptr<milvus::plan::PlanNode> plannodes_;
+    // set for adaptive filter execution: the filter, and the iterative filter
+    // plan a segment runs instead of plannodes_ when it is cheaper there
+    std::shared_ptr<const milvus::expr::ITypeExpr> filter_;
+    std::shared_ptr<milvus::plan::PlanNode> iterative_plannodes_;
 };
 
 struct RetrievePlanNode : PlanNode {
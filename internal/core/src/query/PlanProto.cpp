@@ -68,14 +68,13 @@ ProtoParser::PlanNodeFromProto(const planpb::PlanNode& plan_node_proto) {
     Assert(plan_node_proto.has_vector_anns());
     auto& anns_proto = plan_node_proto.vector_anns();
 
-    auto expr_parser = [&]() -> plan::PlanNodePtr {
+    auto filter_parser = [&]() -> expr::TypedExprPtr {
         auto expr = ParseExprs(anns_proto.predicates());
         if (plan_node_proto.has_namespace_()) {
             expr = MergeExprWithNamespace(
                 schema, expr, plan_node_proto.namespace_());
         }
-        return std::make_shared<plan::FilterBitsNode>(
-            milvus::plan::GetNextPlanNodeId(), expr);
+        return expr;
     };
 
     auto search_info_parser = [&]() -> SearchInfo {
@@ -98,6 +97,8 @@ ProtoParser::PlanNodeFromProto(const planpb::PlanNode& plan_node_proto) {
                     search_info.iterative_filter_execution = false;
                 } else if (query_info_proto.hints() == ITERATIVE_FILTER) {
                     search_info.iterative_filter_execution = true;
+                } else if (query_info_proto.hints() == ADAPTIVE_FILTER) {
+                    search_info.adaptive_filter_execution = true;
                 } else {
                     // check if hints is valid
                     ThrowInfo(ConfigInvalid,
@@ -107,6 +108,9 @@ ProtoParser::PlanNodeFromProto(const planpb::PlanNode& plan_node_proto) {
             } else if (search_info.search_params_.contains(HINTS)) {
                 if (search_info.search_params_[HINTS] == ITERATIVE_FILTER) {
                     search_info.iterative_filter_execution = true;
+                } else if (search_info.search_params_[HINTS] ==
+                           ADAPTIVE_FILTER) {
+                    search_info.adaptive_filter_execution = true;
                 } else {
                     // check if hints is valid
                     ThrowInfo(ConfigInvalid,
@@ -165,7 +169,7 @@ ProtoParser::PlanNodeFromProto(const planpb::PlanNode& plan_node_proto) {
     std::vector<milvus::plan::PlanNodePtr> sources;
 
     // mvcc node -> vector search node -> iterative filter node
-    auto iterative_filter_plan = [&]() {
+    auto iterative_filter_plan = [&](const expr::TypedExprPtr& expr) {
         plannode = std::make_shared<milvus::plan::MvccNode>(
             milvus::plan::GetNextPlanNodeId());
         sources = std::vector<milvus::plan::PlanNodePtr>{plannode};
@@ -173,19 +177,15 @@ ProtoParser::PlanNodeFromProto(const planpb::PlanNode& plan_node_proto) {
             milvus::plan::GetNextPlanNodeId(), sources);
         sources = std::vector<milvus::plan::PlanNodePtr>{plannode};
 
-        auto expr = ParseExprs(anns_proto.predicates());
-        if (plan_node_proto.has_namespace_()) {
-            expr = MergeExprWithNamespace(
-                schema, expr, plan_node_proto.namespace_());
-        }
         plannode = std::make_shared<plan::FilterNode>(
             milvus::plan::GetNextPlanNodeId(), expr, sources);
         sources = std::vector<milvus::plan::PlanNodePtr>{plannode};
     };
 
     // pre filter node -> mvcc node -> vector search node
-    auto pre_filter_plan = [&]() {
-        plannode = std::move(expr_parser());
+    auto pre_filter_plan = [&](const expr::TypedExprPtr& expr) {
+        plannode = std::make_shared<plan::FilterBitsNode>(
+            milvus::plan::GetNextPlanNodeId(), expr);
         if (plan_node->search_info_.materialized_view_involved) {
             const auto expr_info = plannode->GatherInfo();
             knowhere::MaterializedViewSearchInfo materialized_view_search_info;
@@ -212,17 +212,30 @@ ProtoParser::PlanNodeFromProto(const planpb::PlanNode& plan_node_proto) {
         sources = std::vector<milvus::plan::PlanNodePtr>{plannode};
     };
 
+    // the iterative filter plan of adaptive filter execution, built next to
+    // the pre filter plan, each segment runs one of them
+    milvus::plan::PlanNodePtr iterative_plannode;
     if (anns_proto.has_predicates()) {
+        auto expr = filter_parser();
         // currently limit iterative filter scope to search only
+        if (plan_node->search_info_.group_by_field_id_ != std::nullopt) {
+            plan_node->search_info_.adaptive_filter_execution = false;
+        }
         if (plan_node->search_info_.iterative_filter_execution &&
             plan_node->search_info_.group_by_field_id_ == std::nullopt) {
-            iterative_filter_plan();
+            iterative_filter_plan(expr);
+        } else if (plan_node->search_info_.adaptive_filter_execution) {
+            iterative_filter_plan(expr);
+            iterative_plannode = plannode;
+            pre_filter_plan(expr);
+            plan_node->filter_ = expr;
         } else {
-            pre_filter_plan();
+            pre_filter_plan(expr);
         }
     } else {
         // no filter, force set iterative filter hint to false, go with normal vector search path
         plan_node->search_info_.iterative_filter_execution = false;
+        plan_node->search_info_.adaptive_filter_execution = false;
         plannode = std::make_shared<milvus::plan::MvccNode>(
             milvus::plan::GetNextPlanNodeId(), sources);
         sources = std::vector<milvus::plan::PlanNodePtr>{plannode};
@@ -239,22 +252,27 @@ ProtoParser::PlanNodeFromProto(const planpb::PlanNode& plan_node_proto) {
     }
 
     // if has score function, run filter and scorer at last
-    if (plan_node_proto.scorers_size() > 0) {
-        std::vector<std::shared_ptr<rescores::Scorer>> scorers;
-        for (const auto& function : plan_node_proto.scorers()) {
-            scorers.push_back(ParseScorer(function));
+    std::vector<std::shared_ptr<rescores::Scorer>> scorers;
+    for (const auto& function : plan_node_proto.scorers()) {
+        scorers.push_back(ParseScorer(function));
+    }
+    auto rescores_plan = [&](const milvus::plan::PlanNodePtr& source) {
+        if (scorers.empty()) {
+            return source;
         }
+        return milvus::plan::PlanNodePtr(
+            std::make_shared<milvus::plan::RescoresNode>(
+                milvus::plan::GetNextPlanNodeId(),
+                scorers,
+                plan_node_proto.score_option(),
+                std::vector<milvus::plan::PlanNodePtr>{source}));
+    };
 
-        plannode = std::make_shared<milvus::plan::RescoresNode>(
-            milvus::plan::GetNextPlanNodeId(),
-            std::move(scorers),
-            plan_node_proto.score_option(),
-            sources);
-        sources = std::vector<milvus::plan::PlanNodePtr>{plannode};
+    plan_node->plannodes_ = rescores_plan(plannode);
+    if (iterative_plannode != nullptr) {
+        plan_node->iterative_plannodes_ = rescores_plan(iterative_plannode);
     }
 
-    plan_node->plannodes_ = plannode;
-
     PlanOptionsFromProto(plan_node_proto.plan_options(),
                          plan_node->plan_options_);
 
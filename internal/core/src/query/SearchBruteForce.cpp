@@ -9,11 +9,17 @@
 // is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <vector>
 
+#include "BlockedBruteForce.h"
 #include "SearchBruteForce.h"
 #include "SubSearchResult.h"
+#include "common/Common.h"
 #include "common/Consts.h"
 #include "common/EasyAssert.h"
 #include "common/RangeSearchHelper.h"
@@ -24,6 +30,7 @@
 #include "knowhere/comp/index_param.h"
 #include "knowhere/index/index_node.h"
 #include "log/Log.h"
+#include "storage/ThreadPools.h"
 
 namespace milvus::query {
 
@@ -118,6 +125,132 @@ PrepareBFDataSet(const dataset::SearchDataset& query_ds,
     return std::make_pair(query_dataset, base_dataset);
 };
 
+namespace {
+
+// a chunk whose unfiltered rows are at most this share of it is searched on
+// a gathered copy of those rows, below it most bitset words have no
+// unfiltered row and the dense scan mostly tests filtered bits
+constexpr int64_t kSparseScanMaxDensityInv = 32;
+
+CustomBitsetView
+RangeOf(const BitsetView& bitset, int64_t begin, int64_t size) {
+    return CustomBitsetView(const_cast<uint8_t*>(bitset.data()),
+                            static_cast<size_t>(begin),
+                            static_cast<size_t>(size));
+}
+
+// offsets in [0, size) of the rows from begin not filtered out by bitset,
+// if there are few enough of them to gather
+std::optional<std::vector<int64_t>>
+CollectSparseCandidates(const BitsetView& bitset,
+                        int64_t begin,
+                        int64_t size) {
+    if (bitset.empty() || size <= 0 ||
+        begin + size > static_cast<int64_t>(bitset.size())) {
+        return std::nullopt;
+    }
+    auto range = RangeOf(bitset, begin, size);
+    auto num_unfiltered = size - static_cast<int64_t>(range.count());
+    if (num_unfiltered * kSparseScanMaxDensityInv > size) {
+        return std::nullopt;
+    }
+    std::vector<int64_t> candidates;
+    candidates.reserve(num_unfiltered);
+    for (auto row = range.find_first(false); row.has_value();
+         row = range.find_next(row.value(), false)) {
+        candidates.push_back(row.value());
+    }
+    return candidates;
+}
+
+// shared with the pool tasks, which may only start after the tasks are done
+struct ClaimedTaskState {
+    explicit ClaimedTaskState(int64_t num_task) : num_task(num_task) {
+    }
+
+    const int64_t num_task;
+    std::atomic<int64_t> next_task{0};
+    std::atomic<bool> failed{false};
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    int64_t num_done{0};
+    std::exception_ptr error;
+};
+
+// set while a thread runs tasks of RunInParallel, tasks that run in parallel
+// themselves run inline then, so the pool never waits on itself
+thread_local bool in_parallel_task = false;
+
+// claims tasks until none is left, task is only touched after a task is
+// claimed, while the caller is still waiting for it
+void
+RunClaimedTasks(const std::shared_ptr<ClaimedTaskState>& state,
+                const std::function<void(int64_t)>* task) {
+    auto outer_in_parallel_task = in_parallel_task;
+    in_parallel_task = true;
+    int64_t task_id;
+    while ((task_id = state->next_task.fetch_add(1)) < state->num_task) {
+        std::exception_ptr error;
+        if (!state->failed.load()) {
+            try {
+                (*task)(task_id);
+            } catch (...) {
+                error = std::current_exception();
+                state->failed.store(true);
+            }
+        }
+        std::lock_guard<std::mutex> lck(state->mutex);
+        if (error && !state->error) {
+            state->error = error;
+        }
+        if (++state->num_done == state->num_task) {
+            state->cv.notify_all();
+        }
+    }
+    in_parallel_task = outer_in_parallel_task;
+}
+
+// runs task for [0, num_task) on up to parallelism threads, the calling
+// thread included, so the tasks complete even if no pool thread is free.
+// Only one level runs in parallel, nested calls run on the calling thread.
+void
+RunInParallel(int64_t num_task,
+              int64_t parallelism,
+              const std::function<void(int64_t)>& task) {
+    parallelism = std::min(parallelism, num_task);
+    if (parallelism <= 1 || in_parallel_task) {
+        for (int64_t task_id = 0; task_id < num_task; ++task_id) {
+            task(task_id);
+        }
+        return;
+    }
+
+    auto& pool = ThreadPools::GetThreadPool(ThreadPoolPriority::HIGH);
+    auto state = std::make_shared<ClaimedTaskState>(num_task);
+    for (int64_t i = 1; i < parallelism; ++i) {
+        pool.Submit(RunClaimedTasks, state, &task);
+    }
+    RunClaimedTasks(state, &task);
+    std::unique_lock<std::mutex> lck(state->mutex);
+    state->cv.wait(lck, [&] { return state->num_done == num_task; });
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
+
+}  // namespace
+
+int64_t
+CountUnfilteredRows(const BitsetView& bitset, int64_t begin, int64_t size) {
+    auto end = std::min(begin + size, static_cast<int64_t>(bitset.size()));
+    if (bitset.empty() || end <= begin) {
+        return size;
+    }
+    return size - static_cast<int64_t>(
+                      RangeOf(bitset, begin, end - begin).count());
+}
+
 SubSearchResult
 BruteForceSearch(const dataset::SearchDataset& query_ds,
                  const dataset::RawDataset& raw_ds,
@@ -133,6 +266,49 @@ BruteForceSearch(const dataset::SearchDataset& query_ds,
                                query_ds.round_decimal);
     auto topk = query_ds.topk;
     auto nq = query_ds.num_queries;
+
+    // under a selective filter, search a gathered copy of the unfiltered
+    // rows instead of scanning the whole chunk against the bitset
+    if ((IsDenseFloatVectorDataType(data_type) ||
+         IsBinaryVectorDataType(data_type) ||
+         IsIntVectorDataType(data_type)) &&
+        raw_ds.raw_data_offsets == nullptr) {
+        auto candidates = CollectSparseCandidates(
+            bitset, raw_ds.begin_id, raw_ds.num_raw_data);
+        if (candidates.has_value()) {
+            if (candidates->empty()) {
+                return sub_result;
+            }
+            auto row_bytes = vector_bytes_per_element(data_type, raw_ds.dim);
+            auto src = static_cast<const uint8_t*>(raw_ds.raw_data);
+            std::vector<uint8_t> gathered(candidates->size() * row_bytes);
+            for (size_t i = 0; i < candidates->size(); ++i) {
+                std::memcpy(gathered.data() + i * row_bytes,
+                            src + (*candidates)[i] * row_bytes,
+                            row_bytes);
+            }
+            dataset::RawDataset gathered_ds{
+                0,
+                raw_ds.dim,
+                static_cast<int64_t>(candidates->size()),
+                gathered.data()};
+            auto result = BruteForceSearch(query_ds,
+                                           gathered_ds,
+                                           search_info,
+                                           index_info,
+                                           BitsetView(),
+                                           data_type,
+                                           element_type,
+                                           op_context);
+            for (auto& offset : result.mutable_seg_offsets()) {
+                if (offset != INVALID_SEG_OFFSET) {
+                    offset = raw_ds.begin_id + (*candidates)[offset];
+                }
+            }
+            return result;
+        }
+    }
+
     auto [query_dataset, base_dataset] =
         PrepareBFDataSet(query_ds, raw_ds, data_type);
     auto search_cfg = PrepareBFSearchParams(search_info, index_info);
@@ -200,6 +376,22 @@ BruteForceSearch(const dataset::SearchDataset& query_ds,
             GetDatasetIDs(result), nq * topk, sub_result.get_seg_offsets());
         std::copy_n(
             GetDatasetDistance(result), nq * topk, sub_result.get_distances());
+    } else if (UseBlockedBruteForce(query_ds, raw_ds, data_type)) {
+        RunInParallel(upper_div(nq, BLOCKED_SEARCH_QUERY_BATCH),
+                      BRUTE_FORCE_SEARCH_PARALLELISM.load(),
+                      [&](int64_t batch) {
+                          auto begin = batch * BLOCKED_SEARCH_QUERY_BATCH;
+                          auto end = std::min(
+                              nq, begin + BLOCKED_SEARCH_QUERY_BATCH);
+                          BlockedBruteForceSearch(query_ds,
+                                                  raw_ds,
+                                                  bitset,
+                                                  data_type,
+                                                  begin,
+                                                  end,
+                                                  sub_result);
+                      });
+        milvus::tracer::AddEvent("finish_BlockedBruteForceSearch");
     } else {
         knowhere::Status stat;
         if (data_type == DataType::VECTOR_FLOAT) {
@@ -353,4 +545,35 @@ PackBruteForceSearchIteratorsIntoSubResult(
     }
 }
 
+SubSearchResult
+SearchChunks(const dataset::SearchDataset& query_ds,
+             int64_t num_chunk,
+             const std::function<SubSearchResult(int64_t chunk_id)>&
+                 search_chunk) {
+    SubSearchResult final_qr(query_ds.num_queries,
+                             query_ds.topk,
+                             query_ds.metric_type,
+                             query_ds.round_decimal);
+    if (std::min(BRUTE_FORCE_SEARCH_PARALLELISM.load(), num_chunk) <= 1) {
+        for (int64_t chunk_id = 0; chunk_id < num_chunk; ++chunk_id) {
+            final_qr.merge(search_chunk(chunk_id));
+        }
+        return final_qr;
+    }
+
+    std::vector<std::optional<SubSearchResult>> results(num_chunk);
+    RunInParallel(num_chunk,
+                  BRUTE_FORCE_SEARCH_PARALLELISM.load(),
+                  [&](int64_t chunk_id) {
+                      results[chunk_id].emplace(search_chunk(chunk_id));
+                  });
+    for (int64_t stride = 1; stride < num_chunk; stride *= 2) {
+        for (int64_t i = 0; i + stride < num_chunk; i += 2 * stride) {
+            results[i]->merge(*results[i + stride]);
+        }
+    }
+    final_qr.merge(*results[0]);
+    return final_qr;
+}
+
 }  // namespace milvus::query
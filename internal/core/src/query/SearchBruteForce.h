@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include "common/BitsetView.h"
 #include "common/FieldMeta.h"
 #include "common/QueryInfo.h"
@@ -24,6 +26,12 @@ void
 CheckBruteForceSearchParam(const FieldMeta& field,
                            const SearchInfo& search_info);
 
+// Number of rows in [begin, begin + size) not filtered out by bitset.
+int64_t
+CountUnfilteredRows(const BitsetView& bitset, int64_t begin, int64_t size);
+
+// Searches raw_ds for the queries of query_ds. When the bitset leaves few
+// rows of raw_ds, only those rows are gathered and searched.
 SubSearchResult
 BruteForceSearch(const dataset::SearchDataset& query_ds,
                  const dataset::RawDataset& raw_ds,
@@ -43,6 +51,16 @@ GetBruteForceSearchIterators(
     const BitsetView& bitset,
     DataType data_type);
 
+// Searches chunks [0, num_chunk) with search_chunk and merges the results in
+// chunk order. With BRUTE_FORCE_SEARCH_PARALLELISM > 1, the calling thread
+// and pool tasks claim chunks from a shared cursor, and the per-chunk results
+// are merged by a pairwise tree reduction once every chunk is searched.
+SubSearchResult
+SearchChunks(const dataset::SearchDataset& query_ds,
+             int64_t num_chunk,
+             const std::function<SubSearchResult(int64_t chunk_id)>&
+                 search_chunk);
+
 SubSearchResult
 PackBruteForceSearchIteratorsIntoSubResult(
     const dataset::SearchDataset& query_ds,
@@ -12,6 +12,7 @@
 #include <gtest/gtest.h>
 #include <random>
 
+#include "common/Common.h"
 #include "common/Utils.h"
 
 #include "query/SearchBruteForce.h"
@@ -170,3 +171,118 @@ TEST_F(TestFloatSearchBruteForce, IP) {
 TEST_F(TestFloatSearchBruteForce, NotSupported) {
     Run(100, 10, 5, 128, "aaaaaaaaaaaa");
 }
+
+TEST(SearchChunks, SameAsSequential) {
+    const int64_t nq = 3;
+    const int64_t topk = 7;
+    const int64_t num_chunk = 13;
+    dataset::SearchDataset query_ds{knowhere::metric::L2, nq, topk, -1};
+    std::default_random_engine er(42);
+    std::vector<std::vector<float>> chunk_distances;
+    for (int64_t chunk_id = 0; chunk_id < num_chunk; ++chunk_id) {
+        std::vector<float> distances(nq * topk);
+        for (auto& dis : distances) {
+            // few distinct values to produce ties across chunks
+            dis = er() % 10;
+        }
+        for (int64_t q = 0; q < nq; ++q) {
+            std::sort(distances.begin() + q * topk,
+                      distances.begin() + (q + 1) * topk);
+        }
+        chunk_distances.push_back(std::move(distances));
+    }
+    auto search_chunk = [&](int64_t chunk_id) {
+        SubSearchResult sub_qr(nq, topk, knowhere::metric::L2, -1);
+        sub_qr.mutable_distances() = chunk_distances[chunk_id];
+        for (int64_t i = 0; i < nq * topk; ++i) {
+            sub_qr.mutable_seg_offsets()[i] = chunk_id * 100 + i;
+        }
+        return sub_qr;
+    };
+
+    BRUTE_FORCE_SEARCH_PARALLELISM.store(1);
+    auto expected = SearchChunks(query_ds, num_chunk, search_chunk);
+    for (int64_t parallelism : {2, 4, 64}) {
+        BRUTE_FORCE_SEARCH_PARALLELISM.store(parallelism);
+        auto actual = SearchChunks(query_ds, num_chunk, search_chunk);
+        ASSERT_EQ(expected.mutable_seg_offsets(), actual.mutable_seg_offsets());
+        ASSERT_EQ(expected.mutable_distances(), actual.mutable_distances());
+    }
+
+    // errors of any chunk reach the caller
+    BRUTE_FORCE_SEARCH_PARALLELISM.store(4);
+    ASSERT_ANY_THROW(SearchChunks(query_ds, num_chunk, [&](int64_t chunk_id) {
+        if (chunk_id == 5) {
+            ThrowInfo(UnexpectedError, "chunk failed");
+        }
+        return search_chunk(chunk_id);
+    }));
+    BRUTE_FORCE_SEARCH_PARALLELISM.store(DEFAULT_BRUTE_FORCE_SEARCH_PARALLELISM);
+}
+
+TEST(SearchBruteForce, SelectiveFilter) {
+    int nb = 3000;
+    int nq = 4;
+    int topk = 5;
+    int dim = 16;
+    // the chunk starts at segment offset 1000, only every 97th row is left
+    int64_t begin_id = 1000;
+    BitsetType bitset(begin_id + nb);
+    bitset.set();
+    std::vector<float> kept_base;
+    std::vector<int64_t> kept_offsets;
+    auto base = GenFloatVecs(dim, nb, knowhere::metric::L2);
+    auto query = GenFloatVecs(dim, nq, knowhere::metric::L2, 43);
+    for (int i = 0; i < nb; i += 97) {
+        bitset[begin_id + i] = false;
+        kept_base.insert(kept_base.end(),
+                         base.begin() + i * dim,
+                         base.begin() + (i + 1) * dim);
+        kept_offsets.push_back(begin_id + i);
+    }
+    ASSERT_EQ(kept_offsets.size(),
+              CountUnfilteredRows(BitsetView(bitset), begin_id, nb));
+    ASSERT_EQ(0, CountUnfilteredRows(BitsetView(bitset), 0, begin_id));
+
+    SearchInfo search_info;
+    search_info.topk_ = topk;
+    search_info.metric_type_ = knowhere::metric::L2;
+    dataset::SearchDataset query_dataset{
+        knowhere::metric::L2, nq, topk, -1, dim, query.data()};
+    auto raw_dataset =
+        query::dataset::RawDataset{begin_id, dim, nb, base.data()};
+    auto result = BruteForceSearch(query_dataset,
+                                   raw_dataset,
+                                   search_info,
+                                   {},
+                                   BitsetView(bitset),
+                                   DataType::VECTOR_FLOAT,
+                                   DataType::NONE,
+                                   nullptr);
+    for (int i = 0; i < nq; i++) {
+        auto ref = Ref(kept_base.data(),
+                       query.data() + i * dim,
+                       static_cast<int>(kept_offsets.size()),
+                       dim,
+                       topk,
+                       knowhere::metric::L2);
+        for (int k = 0; k < topk; k++) {
+            ASSERT_EQ(kept_offsets[ref[k]],
+                      result.get_seg_offsets()[i * topk + k]);
+        }
+    }
+
+    // nothing left of the chunk
+    bitset.set();
+    auto empty = BruteForceSearch(query_dataset,
+                                  raw_dataset,
+                                  search_info,
+                                  {},
+                                  BitsetView(bitset),
+                                  DataType::VECTOR_FLOAT,
+                                  DataType::NONE,
+                                  nullptr);
+    for (int i = 0; i < nq * topk; i++) {
+        ASSERT_EQ(INVALID_SEG_OFFSET, empty.get_seg_offsets()[i]);
+    }
+}
@@ -130,7 +130,6 @@ SearchOnGrowing(const segcore::SegmentGrowingImpl& segment,
                                            op_context,
                                            search_result);
         }
-        SubSearchResult final_qr(num_queries, topk, metric_type, round_decimal);
         // TODO(SPARSE): see todo in PlanImpl.h::PlaceHolder.
         auto dim = field.get_data_type() == DataType::VECTOR_SPARSE_U32_F32
                        ? 0
@@ -142,7 +141,6 @@ SearchOnGrowing(const segcore::SegmentGrowingImpl& segment,
                                               dim,
                                               query_data,
                                               query_offsets};
-        int32_t current_chunk_id = 0;
 
         // get K1 and B from index for bm25 brute force
         std::map<std::string, std::string> index_info;
@@ -174,8 +172,7 @@ SearchOnGrowing(const segcore::SegmentGrowingImpl& segment,
         auto vec_size_per_chunk = vec_ptr->get_size_per_chunk();
         auto max_chunk = upper_div(active_count, vec_size_per_chunk);
 
-        for (int chunk_id = current_chunk_id; chunk_id < max_chunk;
-             ++chunk_id) {
+        auto search_chunk = [&](int64_t chunk_id) {
             auto chunk_data = vec_ptr->get_chunk_data(chunk_id);
 
             auto element_begin = chunk_id * vec_size_per_chunk;
@@ -231,26 +228,24 @@ SearchOnGrowing(const segcore::SegmentGrowingImpl& segment,
                            "vector array(embedding list) is not supported for "
                            "vector iterator");
 
-                auto sub_qr =
-                    PackBruteForceSearchIteratorsIntoSubResult(search_dataset,
-                                                               sub_data,
-                                                               info,
-                                                               index_info,
-                                                               bitset,
-                                                               data_type);
-                final_qr.merge(sub_qr);
-            } else {
-                auto sub_qr = BruteForceSearch(search_dataset,
-                                               sub_data,
-                                               info,
-                                               index_info,
-                                               bitset,
-                                               data_type,
-                                               element_type,
-                                               op_context);
-                final_qr.merge(sub_qr);
+                return PackBruteForceSearchIteratorsIntoSubResult(
+                    search_dataset,
+                    sub_data,
+                    info,
+                    index_info,
+                    bitset,
+                    data_type);
             }
-        }
+            return BruteForceSearch(search_dataset,
+                                    sub_data,
+                                    info,
+                                    index_info,
+                                    bitset,
+                                    data_type,
+                                    element_type,
+                                    op_context);
+        };
+        auto final_qr = SearchChunks(search_dataset, max_chunk, search_chunk);
         if (milvus::exec::UseVectorIterator(info)) {
             std::vector<int64_t> chunk_rows(max_chunk, 0);
             for (int i = 1; i < max_chunk; ++i) {
@@ -144,19 +144,22 @@ SearchOnSealedColumn(const Schema& schema,
     }
 
     auto num_chunk = column->num_chunks();
+    auto& chunk_offsets = column->GetNumRowsUntilChunk();
 
-    SubSearchResult final_qr(num_queries,
-                             search_info.topk_,
-                             search_info.metric_type_,
-                             search_info.round_decimal_);
-
-    auto offset = 0;
-    for (int i = 0; i < num_chunk; ++i) {
+    auto search_chunk = [&](int64_t i) {
+        auto chunk_size = column->chunk_row_nums(i);
+        // a chunk the filter leaves nothing of is not even pinned
+        if (!milvus::exec::UseVectorIterator(search_info) &&
+            CountUnfilteredRows(bitview, chunk_offsets[i], chunk_size) == 0) {
+            return SubSearchResult(num_queries,
+                                   search_info.topk_,
+                                   search_info.metric_type_,
+                                   search_info.round_decimal_);
+        }
         auto pw = column->DataOfChunk(op_context, i);
         auto vec_data = pw.get();
-        auto chunk_size = column->chunk_row_nums(i);
-        auto raw_dataset =
-            query::dataset::RawDataset{offset, dim, chunk_size, vec_data};
+        auto raw_dataset = query::dataset::RawDataset{
+            chunk_offsets[i], dim, chunk_size, vec_data};
 
         PinWrapper<const size_t*> offsets_pw;
         if (data_type == DataType::VECTOR_ARRAY) {
@@ -172,27 +175,23 @@ SearchOnSealedColumn(const Schema& schema,
             AssertInfo(data_type != DataType::VECTOR_ARRAY,
                        "vector array(embedding list) is not supported for "
                        "vector iterator");
-            auto sub_qr =
-                PackBruteForceSearchIteratorsIntoSubResult(query_dataset,
-                                                           raw_dataset,
-                                                           search_info,
-                                                           index_info,
-                                                           bitview,
-                                                           data_type);
-            final_qr.merge(sub_qr);
-        } else {
-            auto sub_qr = BruteForceSearch(query_dataset,
-                                           raw_dataset,
-                                           search_info,
-                                           index_info,
-                                           bitview,
-                                           data_type,
-                                           element_type,
-                                           op_context);
-            final_qr.merge(sub_qr);
+            return PackBruteForceSearchIteratorsIntoSubResult(query_dataset,
+                                                              raw_dataset,
+                                                              search_info,
+                                                              index_info,
+                                                              bitview,
+                                                              data_type);
         }
-        offset += chunk_size;
-    }
+        return BruteForceSearch(query_dataset,
+                                raw_dataset,
+                                search_info,
+                                index_info,
+                                bitview,
+                                data_type,
+                                element_type,
+                                op_context);
+    };
+    auto final_qr = SearchChunks(query_dataset, num_chunk, search_chunk);
     if (milvus::exec::UseVectorIterator(search_info)) {
         result.AssembleChunkVectorIterators(num_queries,
                                             num_chunk,
@@ -691,6 +691,42 @@ ChunkedSegmentSealedImpl::chunk_string_view_impl(
               "chunk_string_view_impl only used for variable column field ");
 }
 
+PinWrapper<const StringChunk*>
+ChunkedSegmentSealedImpl::chunk_string_dictionary(milvus::OpContext* op_ctx,
+                                                  FieldId field_id,
+                                                  int64_t chunk_id) const {
+    std::shared_lock lck(mutex_);
+    auto column = get_column(field_id);
+    if (column == nullptr ||
+        !IsStringDataType(schema_->operator[](field_id).get_data_type())) {
+        return PinWrapper<const StringChunk*>(nullptr);
+    }
+    auto pw = column->GetChunk(op_ctx, chunk_id);
+    auto chunk = static_cast<const StringChunk*>(pw.get());
+    if (!chunk->IsDictionaryEncoded()) {
+        return PinWrapper<const StringChunk*>(nullptr);
+    }
+    return PinWrapper<const StringChunk*>(pw, chunk);
+}
+
+PinWrapper<const JSONChunk*>
+ChunkedSegmentSealedImpl::chunk_json_key_index(milvus::OpContext* op_ctx,
+                                               FieldId field_id,
+                                               int64_t chunk_id) const {
+    std::shared_lock lck(mutex_);
+    auto column = get_column(field_id);
+    if (column == nullptr ||
+        !IsJsonDataType(schema_->operator[](field_id).get_data_type())) {
+        return PinWrapper<const JSONChunk*>(nullptr);
+    }
+    auto pw = column->GetChunk(op_ctx, chunk_id);
+    auto chunk = static_cast<const JSONChunk*>(pw.get());
+    if (!chunk->HasKeyIndex()) {
+        return PinWrapper<const JSONChunk*>(nullptr);
+    }
+    return PinWrapper<const JSONChunk*>(pw, chunk);
+}
+
 PinWrapper<std::pair<std::vector<std::string_view>, FixedVector<bool>>>
 ChunkedSegmentSealedImpl::chunk_string_views_by_offsets(
     milvus::OpContext* op_ctx,
@@ -802,6 +838,20 @@ ChunkedSegmentSealedImpl::mask_with_delete(BitsetTypeView& bitset,
     deleted_record_.Query(bitset, ins_barrier, timestamp);
 }
 
+DeleteProbe
+ChunkedSegmentSealedImpl::gather_deletes(Timestamp timestamp) const {
+    return deleted_record_.Gather(timestamp);
+}
+
+void
+ChunkedSegmentSealedImpl::mask_offsets_with_delete(
+    BitsetTypeView& bitset,
+    const int32_t* offsets,
+    int64_t count,
+    const DeleteProbe& probe) const {
+    deleted_record_.Query(bitset, offsets, count, probe);
+}
+
 void
 ChunkedSegmentSealedImpl::vector_search(SearchInfo& search_info,
                                         const void* query_data,
@@ -1026,82 +1076,141 @@ ChunkedSegmentSealedImpl::check_search(const query::Plan* plan) const {
     }
 }
 
-void
-ChunkedSegmentSealedImpl::search_pks(BitsetType& bitset,
-                                     const std::vector<PkType>& pks) const {
-    BitsetTypeView bitset_view(bitset);
-    if (!is_sorted_by_pk_) {
-        for (auto& pk : pks) {
-            insert_record_.search_pk_range(
-                pk, proto::plan::OpType::Equal, bitset_view);
+// Sorts the pks once, so that every sorted pk chunk is probed by one merge walk
+// instead of one binary search per pk.
+template <typename T>
+static std::vector<std::pair<T, size_t>>
+SortPks(const std::vector<PkType>& pks) {
+    std::vector<std::pair<T, size_t>> sorted_pks;
+    sorted_pks.reserve(pks.size());
+    for (size_t i = 0; i < pks.size(); ++i) {
+        if constexpr (std::is_same_v<T, std::string_view>) {
+            sorted_pks.emplace_back(std::get<std::string>(pks[i]), i);
+        } else {
+            sorted_pks.emplace_back(std::get<T>(pks[i]), i);
         }
-        return;
     }
+    std::sort(sorted_pks.begin(), sorted_pks.end());
+    return sorted_pks;
+}
 
-    auto pk_field_id = schema_->get_primary_field_id().value_or(FieldId(-1));
-    AssertInfo(pk_field_id.get() != -1, "Primary key is -1");
-    auto pk_column = get_column(pk_field_id);
-    AssertInfo(pk_column != nullptr, "primary key column not loaded");
-
-    auto all_chunk_pins = pk_column->GetAllChunks(nullptr);
-    switch (schema_->get_fields().at(pk_field_id).get_data_type()) {
+// Whether one of the sorted pks falls in [min, max] of the zone of a chunk.
+template <typename T, typename Zone>
+static bool
+SortedPksHitZone(const std::vector<std::pair<T, size_t>>& sorted_pks,
+                 const Zone& zone) {
+    if (zone.num_rows == 0) {
+        return false;
+    }
+    auto it = std::lower_bound(
+        sorted_pks.begin(),
+        sorted_pks.end(),
+        zone.min,
+        [](const std::pair<T, size_t>& pk, const decltype(zone.min)& value) {
+            return pk.first < value;
+        });
+    return it != sorted_pks.end() && !(zone.max < it->first);
+}
+
+// Calls on_match(segment_offset, pk_index) for every row of a column sorted by
+// pk that equals one of the pks. With the zone map of the column, only the
+// chunks whose pk range holds one of the pks are pinned.
+template <typename OnMatch>
+static void
+MergeJoinSortedPkColumn(const ChunkedColumnInterface& pk_column,
+                        DataType pk_type,
+                        const ZoneMap<int64_t>& int64_zone_map,
+                        const ZoneMap<std::string>& string_zone_map,
+                        const std::vector<PkType>& pks,
+                        OnMatch&& on_match) {
+    auto num_chunk = pk_column.num_chunks();
+    std::vector<PinWrapper<Chunk*>> all_chunk_pins;
+    auto pin_chunk = [&](bool has_zone_map, int i) {
+        if (has_zone_map) {
+            return pk_column.GetChunk(nullptr, i);
+        }
+        if (all_chunk_pins.empty()) {
+            all_chunk_pins = pk_column.GetAllChunks(nullptr);
+        }
+        return all_chunk_pins[i];
+    };
+    switch (pk_type) {
         case DataType::INT64: {
-            auto num_chunk = pk_column->num_chunks();
+            auto sorted_pks = SortPks<int64_t>(pks);
+            bool has_zone_map = int64_zone_map.num_chunks() == num_chunk;
             for (int i = 0; i < num_chunk; ++i) {
-                auto pw = all_chunk_pins[i];
+                if (has_zone_map &&
+                    !SortedPksHitZone(sorted_pks, int64_zone_map.zone(i))) {
+                    continue;
+                }
+                auto pw = pin_chunk(has_zone_map, i);
                 auto src =
                     reinterpret_cast<const int64_t*>(pw.get()->RawData());
-                auto chunk_row_num = pk_column->chunk_row_nums(i);
-                for (size_t j = 0; j < pks.size(); j++) {
-                    // get int64 pks
-                    auto target = std::get<int64_t>(pks[j]);
-                    auto it = std::lower_bound(
-                        src,
-                        src + chunk_row_num,
-                        target,
-                        [](const int64_t& elem, const int64_t& value) {
-                            return elem < value;
-                        });
-                    auto num_rows_until_chunk =
-                        pk_column->GetNumRowsUntilChunk(i);
-                    for (; it != src + chunk_row_num && *it == target; ++it) {
-                        auto offset = it - src + num_rows_until_chunk;
-                        bitset[offset] = true;
-                    }
-                }
+                auto num_rows_until_chunk = pk_column.GetNumRowsUntilChunk(i);
+                merge_join_sorted_pks(
+                    [src](int64_t offset) { return src[offset]; },
+                    pk_column.chunk_row_nums(i),
+                    sorted_pks,
+                    [&](int64_t offset, size_t pk_idx) {
+                        on_match(offset + num_rows_until_chunk, pk_idx);
+                    });
             }
-
             break;
         }
         case DataType::VARCHAR: {
-            auto num_chunk = pk_column->num_chunks();
+            auto sorted_pks = SortPks<std::string_view>(pks);
+            bool has_zone_map = string_zone_map.num_chunks() == num_chunk;
             for (int i = 0; i < num_chunk; ++i) {
-                // TODO @xiaocai2333, @sunby: chunk need to record the min/max.
-                auto num_rows_until_chunk = pk_column->GetNumRowsUntilChunk(i);
-                auto pw = all_chunk_pins[i];
-                auto string_chunk = static_cast<StringChunk*>(pw.get());
-                for (size_t j = 0; j < pks.size(); ++j) {
-                    // get varchar pks
-                    auto& target = std::get<std::string>(pks[j]);
-                    auto offset = string_chunk->binary_search_string(target);
-                    for (; offset != -1 && offset < string_chunk->RowNums() &&
-                           string_chunk->operator[](offset) == target;
-                         ++offset) {
-                        auto segment_offset = offset + num_rows_until_chunk;
-                        bitset[segment_offset] = true;
-                    }
+                if (has_zone_map &&
+                    !SortedPksHitZone(sorted_pks, string_zone_map.zone(i))) {
+                    continue;
                 }
+                auto pw = pin_chunk(has_zone_map, i);
+                auto string_chunk = static_cast<StringChunk*>(pw.get());
+                auto num_rows_until_chunk = pk_column.GetNumRowsUntilChunk(i);
+                merge_join_sorted_pks(
+                    [string_chunk](int64_t offset) {
+                        return (*string_chunk)[offset];
+                    },
+                    string_chunk->RowNums(),
+                    sorted_pks,
+                    [&](int64_t offset, size_t pk_idx) {
+                        on_match(offset + num_rows_until_chunk, pk_idx);
+                    });
             }
             break;
         }
         default: {
-            ThrowInfo(
-                DataTypeInvalid,
-                fmt::format(
-                    "unsupported type {}",
-                    schema_->get_fields().at(pk_field_id).get_data_type()));
+            ThrowInfo(DataTypeInvalid,
+                      fmt::format("unsupported type {}", pk_type));
+        }
+    }
+}
+
+void
+ChunkedSegmentSealedImpl::search_pks(BitsetType& bitset,
+                                     const std::vector<PkType>& pks) const {
+    BitsetTypeView bitset_view(bitset);
+    if (!is_sorted_by_pk_) {
+        for (auto& pk : pks) {
+            insert_record_.search_pk_range(
+                pk, proto::plan::OpType::Equal, bitset_view);
         }
+        return;
     }
+
+    auto pk_field_id = schema_->get_primary_field_id().value_or(FieldId(-1));
+    AssertInfo(pk_field_id.get() != -1, "Primary key is -1");
+    auto pk_column = get_column(pk_field_id);
+    AssertInfo(pk_column != nullptr, "primary key column not loaded");
+
+    MergeJoinSortedPkColumn(
+        *pk_column,
+        schema_->get_fields().at(pk_field_id).get_data_type(),
+        int64_pk_zone_map_,
+        string_pk_zone_map_,
+        pks,
+        [&bitset](int64_t offset, size_t) { bitset[offset] = true; });
 }
 
 void
@@ -1129,8 +1238,6 @@ ChunkedSegmentSealedImpl::search_batch_pks(
     auto pk_column = get_column(pk_field_id);
     AssertInfo(pk_column != nullptr, "primary key column not loaded");
 
-    auto all_chunk_pins = pk_column->GetAllChunks(nullptr);
-
     auto timestamp_hit = include_same_ts
                              ? [](const Timestamp& ts1,
                                   const Timestamp& ts2) { return ts1 <= ts2; }
@@ -1138,73 +1245,18 @@ ChunkedSegmentSealedImpl::search_batch_pks(
                                    return ts1 < ts2;
                                };
 
-    switch (schema_->get_fields().at(pk_field_id).get_data_type()) {
-        case DataType::INT64: {
-            auto num_chunk = pk_column->num_chunks();
-            for (int i = 0; i < num_chunk; ++i) {
-                auto pw = all_chunk_pins[i];
-                auto src =
-                    reinterpret_cast<const int64_t*>(pw.get()->RawData());
-                auto chunk_row_num = pk_column->chunk_row_nums(i);
-                for (size_t j = 0; j < pks.size(); j++) {
-                    // get int64 pks
-                    auto target = std::get<int64_t>(pks[j]);
-                    auto timestamp = get_timestamp(j);
-                    auto it = std::lower_bound(
-                        src,
-                        src + chunk_row_num,
-                        target,
-                        [](const int64_t& elem, const int64_t& value) {
-                            return elem < value;
-                        });
-                    auto num_rows_until_chunk =
-                        pk_column->GetNumRowsUntilChunk(i);
-                    for (; it != src + chunk_row_num && *it == target; ++it) {
-                        auto offset = it - src + num_rows_until_chunk;
-                        if (timestamp_hit(insert_record_.timestamps_[offset],
-                                          timestamp)) {
-                            callback(SegOffset(offset), timestamp);
-                        }
-                    }
-                }
+    MergeJoinSortedPkColumn(
+        *pk_column,
+        schema_->get_fields().at(pk_field_id).get_data_type(),
+        int64_pk_zone_map_,
+        string_pk_zone_map_,
+        pks,
+        [&](int64_t offset, size_t pk_idx) {
+            auto timestamp = get_timestamp(pk_idx);
+            if (timestamp_hit(insert_record_.timestamps_[offset], timestamp)) {
+                callback(SegOffset(offset), timestamp);
             }
-
-            break;
-        }
-        case DataType::VARCHAR: {
-            auto num_chunk = pk_column->num_chunks();
-            for (int i = 0; i < num_chunk; ++i) {
-                // TODO @xiaocai2333, @sunby: chunk need to record the min/max.
-                auto num_rows_until_chunk = pk_column->GetNumRowsUntilChunk(i);
-                auto pw = all_chunk_pins[i];
-                auto string_chunk = static_cast<StringChunk*>(pw.get());
-                for (size_t j = 0; j < pks.size(); ++j) {
-                    // get varchar pks
-                    auto& target = std::get<std::string>(pks[j]);
-                    auto timestamp = get_timestamp(j);
-                    auto offset = string_chunk->binary_search_string(target);
-                    for (; offset != -1 && offset < string_chunk->RowNums() &&
-                           string_chunk->operator[](offset) == target;
-                         ++offset) {
-                        auto segment_offset = offset + num_rows_until_chunk;
-                        if (timestamp_hit(
-                                insert_record_.timestamps_[segment_offset],
-                                timestamp)) {
-                            callback(SegOffset(segment_offset), timestamp);
-                        }
-                    }
-                }
-            }
-            break;
-        }
-        default: {
-            ThrowInfo(
-                DataTypeInvalid,
-                fmt::format(
-                    "unsupported type {}",
-                    schema_->get_fields().at(pk_field_id).get_data_type()));
-        }
-    }
+        });
 }
 
 void
@@ -1220,6 +1272,27 @@ ChunkedSegmentSealedImpl::pk_range(milvus::OpContext* op_ctx,
     search_sorted_pk_range(op_ctx, op, pk, bitset);
 }
 
+// Decides a chunk of the pk column by its zone alone: returns true when no
+// pk of the chunk satisfies op, or when every pk does and its rows are set.
+template <typename T>
+static bool
+DecideSortedPkChunkByZone(const ZoneMap<T>& zone_map,
+                          int64_t chunk_id,
+                          proto::plan::OpType op,
+                          const T& target,
+                          BitsetTypeView& bitset) {
+    if (zone_map.CanSkip(chunk_id, op, target)) {
+        return true;
+    }
+    if (zone_map.AllMatch(chunk_id, op, target)) {
+        bitset.set(zone_map.rows_until(chunk_id),
+                   zone_map.zone(chunk_id).num_rows,
+                   true);
+        return true;
+    }
+    return false;
+}
+
 void
 ChunkedSegmentSealedImpl::search_sorted_pk_range(milvus::OpContext* op_ctx,
                                                  proto::plan::OpType op,
@@ -1236,7 +1309,13 @@ ChunkedSegmentSealedImpl::search_sorted_pk_range(milvus::OpContext* op_ctx,
             auto target = std::get<int64_t>(pk);
 
             auto num_chunk = pk_column->num_chunks();
+            bool has_zone_map = int64_pk_zone_map_.num_chunks() == num_chunk;
             for (int i = 0; i < num_chunk; ++i) {
+                if (has_zone_map &&
+                    DecideSortedPkChunkByZone(
+                        int64_pk_zone_map_, i, op, target, bitset)) {
+                    continue;
+                }
                 auto pw = pk_column->DataOfChunk(op_ctx, i);
                 auto src = reinterpret_cast<const int64_t*>(pw.get());
                 auto chunk_row_num = pk_column->chunk_row_nums(i);
@@ -1326,7 +1405,13 @@ ChunkedSegmentSealedImpl::search_sorted_pk_range(milvus::OpContext* op_ctx,
             auto target = std::get<std::string>(pk);
 
             auto num_chunk = pk_column->num_chunks();
+            bool has_zone_map = string_pk_zone_map_.num_chunks() == num_chunk;
             for (int i = 0; i < num_chunk; ++i) {
+                if (has_zone_map &&
+                    DecideSortedPkChunkByZone(
+                        string_pk_zone_map_, i, op, target, bitset)) {
+                    continue;
+                }
                 auto num_rows_until_chunk = pk_column->GetNumRowsUntilChunk(i);
                 auto pw = pk_column->GetChunk(op_ctx, i);
                 auto string_chunk = static_cast<StringChunk*>(pw.get());
@@ -1622,6 +1707,9 @@ ChunkedSegmentSealedImpl::ClearData() {
         vector_indexings_.clear();
         ngram_indexings_.wlock()->clear();
         insert_record_.clear();
+        int64_pk_zone_map_ = {};
+        string_pk_zone_map_ = {};
+        timestamp_zone_map_ = {};
         fields_.wlock()->clear();
         variable_fields_avg_size_.clear();
         stats_.mem_size = 0;
@@ -2292,9 +2380,16 @@ ChunkedSegmentSealedImpl::mask_with_timestamps(BitsetTypeView& bitset_chunk,
             bitset_chunk.set();
             return;
         } else {
-            auto ttl_mask = TimestampIndex::GenerateTTLBitset(
-                timestamps_data, timestamps_data_size, collection_ttl, range);
-            bitset_chunk |= ttl_mask;
+            // [0, beg) expired, [end, size) alive, zones decide the rest
+            if (range.first > 0) {
+                bitset_chunk.set(0, range.first, true);
+            }
+            MaskExpiredTimestamps(bitset_chunk,
+                                  timestamp_zone_map_,
+                                  timestamps_data,
+                                  range.first,
+                                  range.second,
+                                  collection_ttl);
         }
     }
 
@@ -2317,9 +2412,17 @@ ChunkedSegmentSealedImpl::mask_with_timestamps(BitsetTypeView& bitset_chunk,
         bitset_chunk.set();
         return;
     }
-    auto mask = TimestampIndex::GenerateBitset(
-        timestamp, range, timestamps_data, timestamps_data_size);
-    bitset_chunk |= mask;
+    // [0, beg) visible, [end, size) not visible, zones decide the rest
+    if (range.second < timestamps_data_size) {
+        bitset_chunk.set(
+            range.second, timestamps_data_size - range.second, true);
+    }
+    MaskNewerTimestamps(bitset_chunk,
+                        timestamp_zone_map_,
+                        timestamps_data,
+                        range.first,
+                        range.second,
+                        timestamp);
 }
 
 bool
@@ -2476,6 +2579,16 @@ ChunkedSegmentSealedImpl::load_field_data_common(
     bool enable_mmap,
     bool is_proxy_column,
     std::optional<ParquetStatistics> statistics) {
+    // pk lookups read the zone maps without a lock once they found the pk
+    // column, so they are built first and published along with it
+    bool is_sorted_pk =
+        schema_->get_primary_field_id() == field_id && is_sorted_by_pk_;
+    ZoneMap<int64_t> int64_pk_zone_map;
+    ZoneMap<std::string> string_pk_zone_map;
+    if (is_sorted_pk) {
+        build_pk_zone_map(
+            data_type, *column, int64_pk_zone_map, string_pk_zone_map);
+    }
     {
         std::unique_lock lck(mutex_);
         AssertInfo(SystemProperty::Instance().IsSystem(field_id) ||
@@ -2488,6 +2601,10 @@ ChunkedSegmentSealedImpl::load_field_data_common(
         });
         AssertInfo(
             !already_exists, "field {} column already exists", field_id.get());
+        if (is_sorted_pk) {
+            int64_pk_zone_map_ = std::move(int64_pk_zone_map);
+            string_pk_zone_map_ = std::move(string_pk_zone_map);
+        }
         fields_.wlock()->emplace(field_id, column);
         if (enable_mmap) {
             mmap_field_ids_.insert(field_id);
@@ -2561,13 +2678,59 @@ ChunkedSegmentSealedImpl::init_timestamp_index(
     // todo ::opt to avoid copy timestamps from field data
     index.build_with(timestamps.data(), num_rows);
 
+    auto zone_map = BuildTimestampZoneMap(timestamps.data(), num_rows);
+
     // use special index
     std::unique_lock lck(mutex_);
     AssertInfo(insert_record_.timestamps_.empty(), "already exists");
     insert_record_.init_timestamps(timestamps, index);
+    timestamp_zone_map_ = std::move(zone_map);
     stats_.mem_size += sizeof(Timestamp) * num_rows;
 }
 
+void
+ChunkedSegmentSealedImpl::build_pk_zone_map(
+    DataType data_type,
+    const ChunkedColumnInterface& column,
+    ZoneMap<int64_t>& int64_zone_map,
+    ZoneMap<std::string>& string_zone_map) {
+    // sorted by pk, so the first and last rows bound each chunk, chunks are
+    // pinned one at a time
+    auto num_chunk = column.num_chunks();
+    switch (data_type) {
+        case DataType::INT64: {
+            for (int i = 0; i < num_chunk; ++i) {
+                auto pin = column.GetChunk(nullptr, i);
+                auto num_rows = column.chunk_row_nums(i);
+                auto src =
+                    reinterpret_cast<const int64_t*>(pin.get()->RawData());
+                int64_zone_map.Add(num_rows,
+                                   num_rows > 0 ? src[0] : 0,
+                                   num_rows > 0 ? src[num_rows - 1] : 0);
+            }
+            break;
+        }
+        case DataType::VARCHAR: {
+            for (int i = 0; i < num_chunk; ++i) {
+                auto pin = column.GetChunk(nullptr, i);
+                auto string_chunk = static_cast<StringChunk*>(pin.get());
+                auto num_rows = string_chunk->RowNums();
+                string_zone_map.Add(
+                    num_rows,
+                    num_rows > 0 ? std::string((*string_chunk)[0])
+                                 : std::string(),
+                    num_rows > 0 ? std::string((*string_chunk)[num_rows - 1])
+                                 : std::string());
+            }
+            break;
+        }
+        default: {
+            ThrowInfo(DataTypeInvalid,
+                      fmt::format("unsupported pk type {}", data_type));
+        }
+    }
+}
+
 void
 ChunkedSegmentSealedImpl::Reopen(SchemaPtr sch) {
     std::unique_lock lck(mutex_);
@@ -37,6 +37,7 @@
 #include "parquet/statistics.h"
 #include "segcore/IndexConfigGenerator.h"
 #include "segcore/SegcoreConfig.h"
+#include "segcore/ZoneMap.h"
 #include "folly/concurrency/ConcurrentHashMap.h"
 #include "index/json_stats/JsonKeyStats.h"
 #include "pb/index_cgo_msg.pb.h"
@@ -235,6 +236,16 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
         return true;
     }
 
+    PinWrapper<const StringChunk*>
+    chunk_string_dictionary(milvus::OpContext* op_ctx,
+                            FieldId field_id,
+                            int64_t chunk_id) const override;
+
+    PinWrapper<const JSONChunk*>
+    chunk_json_key_index(milvus::OpContext* op_ctx,
+                         FieldId field_id,
+                         int64_t chunk_id) const override;
+
     void
     search_pks(BitsetType& bitset, const std::vector<PkType>& pks) const;
 
@@ -460,6 +471,15 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
                      int64_t ins_barrier,
                      Timestamp timestamp) const override;
 
+    DeleteProbe
+    gather_deletes(Timestamp timestamp) const override;
+
+    void
+    mask_offsets_with_delete(BitsetTypeView& bitset,
+                             const int32_t* offsets,
+                             int64_t count,
+                             const DeleteProbe& probe) const override;
+
     bool
     is_system_field_ready() const {
         return system_ready_count_ == 1;
@@ -484,6 +504,14 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
     init_timestamp_index(const std::vector<Timestamp>& timestamps,
                          size_t num_rows);
 
+    // min and max pk of each chunk of the pk column sorted by pk, into the
+    // zone map of data_type
+    static void
+    build_pk_zone_map(DataType data_type,
+                      const ChunkedColumnInterface& column,
+                      ZoneMap<int64_t>& int64_zone_map,
+                      ZoneMap<std::string>& string_zone_map);
+
     void
     load_field_data_internal(const LoadFieldDataInfo& load_info);
 
@@ -549,6 +577,12 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
     // inserted fields data and row_ids, timestamps
     InsertRecord<true> insert_record_;
 
+    // zone maps of the pk column when sorted by pk, by pk type
+    ZoneMap<int64_t> int64_pk_zone_map_;
+    ZoneMap<std::string> string_pk_zone_map_;
+    // min and max timestamp of each TIMESTAMP_ZONE_ROWS rows
+    ZoneMap<Timestamp> timestamp_zone_map_;
+
     // deleted pks
     mutable DeletedRecord<true> deleted_record_;
 
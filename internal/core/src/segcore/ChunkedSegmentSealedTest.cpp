@@ -489,3 +489,78 @@ TEST_P(TestChunkSegment, TestPkRange) {
         EXPECT_EQ(0, bitset_sorted_view.count());
     }
 }
+
+TEST_P(TestChunkSegment, TestPkRangeAcrossChunks) {
+    using namespace milvus::segcore;
+    bool pk_is_string = GetParam();
+    auto segment_impl = dynamic_cast<ChunkedSegmentSealedImpl*>(segment.get());
+    ASSERT_NE(segment_impl, nullptr);
+
+    // the pks in segment order, chunk 0 holds the first test_data_count
+    auto num_rows = chunk_num * test_data_count;
+    std::vector<PkType> pks;
+    std::vector<std::string> str_pks;
+    for (int i = 0; i < num_rows; i++) {
+        str_pks.push_back("test" + std::to_string(i));
+    }
+    std::sort(str_pks.begin(), str_pks.end());
+    for (int i = 0; i < num_rows; i++) {
+        pks.push_back(pk_is_string ? PkType(str_pks[i]) : PkType(int64_t(i)));
+    }
+
+    // targets before, inside, at both ends of and after each chunk
+    std::vector<PkType> targets;
+    for (int64_t row : {int64_t(0),
+                        int64_t(test_data_count / 2),
+                        int64_t(test_data_count - 1),
+                        int64_t(test_data_count),
+                        int64_t(num_rows - 1)}) {
+        targets.push_back(pks[row]);
+    }
+    targets.push_back(pk_is_string ? PkType(std::string("a"))
+                                   : PkType(int64_t(-1)));
+    targets.push_back(pk_is_string ? PkType(std::string("z"))
+                                   : PkType(int64_t(num_rows)));
+
+    for (auto op : {proto::plan::OpType::Equal,
+                    proto::plan::OpType::GreaterThan,
+                    proto::plan::OpType::GreaterEqual,
+                    proto::plan::OpType::LessThan,
+                    proto::plan::OpType::LessEqual}) {
+        for (auto& target : targets) {
+            BitsetType bitset(num_rows);
+            BitsetTypeView view(bitset);
+            segment_impl->pk_range(nullptr, op, target, view);
+            for (int i = 0; i < num_rows; i++) {
+                bool expected;
+                switch (op) {
+                    case proto::plan::OpType::Equal:
+                        expected = pks[i] == target;
+                        break;
+                    case proto::plan::OpType::GreaterThan:
+                        expected = pks[i] > target;
+                        break;
+                    case proto::plan::OpType::GreaterEqual:
+                        expected = pks[i] >= target;
+                        break;
+                    case proto::plan::OpType::LessThan:
+                        expected = pks[i] < target;
+                        break;
+                    default:
+                        expected = pks[i] <= target;
+                        break;
+                }
+                ASSERT_EQ(bool(bitset[i]), expected) << op << " " << i;
+            }
+        }
+    }
+
+    // point lookups hit only the chunks holding their pks
+    BitsetType bitset(num_rows);
+    segment_impl->search_pks(bitset, targets);
+    ASSERT_EQ(bitset.count(), 5);
+    ASSERT_TRUE(bitset[0]);
+    ASSERT_TRUE(bitset[test_data_count - 1]);
+    ASSERT_TRUE(bitset[test_data_count]);
+    ASSERT_TRUE(bitset[num_rows - 1]);
+}
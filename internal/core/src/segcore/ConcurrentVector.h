@@ -14,6 +14,7 @@
 #include <fmt/core.h>
 #include <tbb/concurrent_vector.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <deque>
@@ -36,67 +37,90 @@
 
 namespace milvus::segcore {
 
+// Validity of the rows of a nullable field, appended in insert order.
+// Stored in chunks of size_per_chunk rows, aligned with the chunks of the
+// field's ConcurrentVector, so readers can take a chunk's validity as one
+// contiguous span. Readers never lock, appends are serialized among writers
+// and published by the release store of length_.
 class ThreadSafeValidData {
  public:
-    explicit ThreadSafeValidData() = default;
+    explicit ThreadSafeValidData(int64_t size_per_chunk)
+        : size_per_chunk_(size_per_chunk) {
+    }
     explicit ThreadSafeValidData(FixedVector<bool> data)
-        : data_(std::move(data)) {
+        : size_per_chunk_(std::max<int64_t>(data.size(), 1)) {
+        chunks_.emplace_back(std::move(data));
+        length_.store(chunks_[0].size(), std::memory_order_release);
     }
 
     void
     set_data_raw(const std::vector<FieldDataPtr>& datas) {
-        std::unique_lock<std::shared_mutex> lck(mutex_);
-        auto total = 0;
-        for (auto& field_data : datas) {
-            total += field_data->get_num_rows();
-        }
-        if (length_ + total > data_.size()) {
-            data_.resize(length_ + total);
-        }
-
+        std::lock_guard<std::mutex> lck(write_mutex_);
+        auto length = length_.load(std::memory_order_relaxed);
         for (auto& field_data : datas) {
             auto num_row = field_data->get_num_rows();
+            reserve(length + num_row);
             for (size_t i = 0; i < num_row; i++) {
-                data_[length_ + i] = field_data->is_valid(i);
+                at(length + i) = field_data->is_valid(i);
             }
-            length_ += num_row;
+            length += num_row;
         }
+        length_.store(length, std::memory_order_release);
     }
 
     void
     set_data_raw(size_t num_rows,
                  const DataArray* data,
                  const FieldMeta& field_meta) {
-        std::unique_lock<std::shared_mutex> lck(mutex_);
         if (field_meta.is_nullable()) {
-            if (length_ + num_rows > data_.size()) {
-                data_.resize(length_ + num_rows);
-            }
+            std::lock_guard<std::mutex> lck(write_mutex_);
+            auto length = length_.load(std::memory_order_relaxed);
+            reserve(length + num_rows);
             auto src = data->valid_data().data();
-            std::copy_n(src, num_rows, data_.data() + length_);
-            length_ += num_rows;
+            for (size_t copied = 0; copied < num_rows;) {
+                auto offset = length + copied;
+                auto n = std::min(num_rows - copied,
+                                  size_per_chunk_ - offset % size_per_chunk_);
+                std::copy_n(src + copied, n, &at(offset));
+                copied += n;
+            }
+            length_.store(length + num_rows, std::memory_order_release);
         }
     }
 
     bool
-    is_valid(size_t offset) {
-        std::shared_lock<std::shared_mutex> lck(mutex_);
-        Assert(offset < length_);
-        return data_[offset];
+    is_valid(size_t offset) const {
+        Assert(offset < length_.load(std::memory_order_acquire));
+        return at(offset);
     }
 
+    // valid until the end of the chunk holding offset
     bool*
-    get_chunk_data(size_t offset) {
-        std::shared_lock<std::shared_mutex> lck(mutex_);
-        Assert(offset < length_);
-        return &data_[offset];
+    get_chunk_data(size_t offset) const {
+        Assert(offset < length_.load(std::memory_order_acquire));
+        return &at(offset);
+    }
+
+ private:
+    bool&
+    at(size_t offset) const {
+        return chunks_[offset / size_per_chunk_][offset % size_per_chunk_];
+    }
+
+    void
+    reserve(size_t length) {
+        while (static_cast<size_t>(chunks_.size()) * size_per_chunk_ <
+               length) {
+            chunks_.emplace_back(size_per_chunk_);
+        }
     }
 
  private:
-    mutable std::shared_mutex mutex_{};
-    FixedVector<bool> data_;
+    const size_t size_per_chunk_;
+    std::mutex write_mutex_;
+    ChunkDirectory<FixedVector<bool>> chunks_;
     // number of actual elements
-    size_t length_{0};
+    std::atomic<size_t> length_{0};
 };
 using ThreadSafeValidDataPtr = std::shared_ptr<ThreadSafeValidData>;
 
@@ -18,6 +18,7 @@
 #include "segcore/ConcurrentVector.h"
 #include "segcore/SegmentGrowing.h"
 #include "segcore/AckResponder.h"
+#include "storage/Util.h"
 
 using namespace milvus::segcore;
 using std::vector;
@@ -110,3 +111,67 @@ TEST(ConcurrentVector, TestAckSingle) {
     }
     EXPECT_EQ(ack.GetAck(), N);
 }
+
+TEST(ConcurrentVector, ChunkDirectoryReadWhileAppend) {
+    milvus::ChunkDirectory<std::vector<int64_t>> directory;
+    constexpr int64_t num_chunks = 5000;
+    std::atomic<bool> stop{false};
+    std::thread writer([&]() {
+        for (int64_t i = 0; i < num_chunks; ++i) {
+            directory.emplace_back(4, i);
+        }
+        stop.store(true);
+    });
+    // readers only see fully constructed chunks, which never move
+    std::vector<const int64_t*> addresses;
+    while (!stop.load()) {
+        auto size = directory.size();
+        for (int64_t i = addresses.size(); i < size; ++i) {
+            addresses.push_back(directory[i].data());
+        }
+        for (int64_t i = 0; i < size; ++i) {
+            EXPECT_EQ(i, directory[i][3]);
+        }
+    }
+    writer.join();
+
+    ASSERT_EQ(num_chunks, directory.size());
+    for (int64_t i = 0; i < addresses.size(); ++i) {
+        ASSERT_EQ(addresses[i], directory[i].data());
+    }
+    directory.clear();
+    ASSERT_EQ(0, directory.size());
+}
+
+TEST(ConcurrentVector, ThreadSafeValidDataChunks) {
+    int64_t size_per_chunk = 32;
+    ThreadSafeValidData valid_data(size_per_chunk);
+    std::default_random_engine e(42);
+    std::vector<bool> expected;
+    for (int i = 0; i < 100; ++i) {
+        int64_t num_rows = e() % 50 + 1;
+        std::vector<int64_t> values(num_rows);
+        std::vector<uint8_t> bitmap((num_rows + 7) / 8);
+        for (int64_t j = 0; j < num_rows; ++j) {
+            bool valid = e() % 3 != 0;
+            bitmap[j / 8] |= valid << (j % 8);
+            expected.push_back(valid);
+        }
+        auto field_data = milvus::storage::CreateFieldData(
+            milvus::DataType::INT64, milvus::DataType::NONE, true);
+        field_data->FillFieldData(values.data(), bitmap.data(), num_rows, 0);
+        valid_data.set_data_raw({field_data});
+    }
+
+    for (int64_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(expected[i], valid_data.is_valid(i)) << i;
+    }
+    // validity of a chunk is contiguous
+    for (int64_t begin = 0; begin < expected.size(); begin += size_per_chunk) {
+        auto data = valid_data.get_chunk_data(begin);
+        auto end = std::min<int64_t>(begin + size_per_chunk, expected.size());
+        for (int64_t i = begin; i < end; ++i) {
+            ASSERT_EQ(expected[i], data[i - begin]) << i;
+        }
+    }
+}
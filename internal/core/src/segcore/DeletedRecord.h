@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <mutex>
@@ -86,13 +87,16 @@ class DeletedRecord {
             return;
         }
 
+        std::lock_guard<std::mutex> lock(push_lock_);
         auto max_deleted_ts = InternalPush(pks, timestamps);
 
         if (max_deleted_ts > max_load_timestamp_) {
             max_load_timestamp_ = max_deleted_ts;
         }
 
-        //TODO: add support for dump snapshot when load finished
+        // a load may bring many deletes at once, cover them all with a
+        // single checkpoint instead of one full bitmap per dump batch
+        DumpSnapshot(true);
     }
 
     // stream push delete timestamps should be sorted outside of the interface
@@ -103,20 +107,28 @@ class DeletedRecord {
             return;
         }
 
+        std::lock_guard<std::mutex> lock(push_lock_);
         InternalPush(pks, timestamps);
-
-        bool can_dump = timestamps[0] >= max_load_timestamp_;
-        if (can_dump) {
-            DumpSnapshot();
-        }
+        DumpSnapshot(false);
     }
 
+    // callers must hold push_lock_
     Timestamp
     InternalPush(const std::vector<PkType>& pks, const Timestamp* timestamps) {
         int64_t removed_num = 0;
         int64_t mem_add = 0;
         Timestamp max_timestamp = 0;
 
+        // only pushers add checkpoints, so this stays valid for the push
+        Timestamp last_checkpoint_ts = 0;
+        {
+            std::shared_lock<std::shared_mutex> lock(snap_lock_);
+            if (!snapshots_.empty()) {
+                last_checkpoint_ts = snapshots_.back().first;
+            }
+        }
+        std::vector<std::pair<Timestamp, Offset>> behind_checkpoint;
+
         SortedDeleteList::Accessor accessor(deleted_lists_);
         for (size_t i = 0; i < pks.size(); ++i) {
             auto deleted_ts = timestamps[i];
@@ -139,6 +151,9 @@ class DeletedRecord {
                     return;
                 }
                 accessor.insert(std::make_pair(delete_ts, row_id));
+                if (delete_ts <= last_checkpoint_ts) {
+                    behind_checkpoint.emplace_back(delete_ts, row_id);
+                }
                 if constexpr (is_sealed) {
                     Assert(deleted_mask_.size() > 0);
                     deleted_mask_.set(row_id);
@@ -151,6 +166,7 @@ class DeletedRecord {
                 mem_add += DELETE_PAIR_SIZE;
             });
 
+        PatchSnapshots(behind_checkpoint);
         n_.fetch_add(removed_num);
         mem_size_.fetch_add(mem_add);
 
@@ -186,30 +202,28 @@ class DeletedRecord {
             return;
         }
 
-        // try use snapshot to skip iterations
-        bool hit_snapshot = false;
-        SortedDeleteList::iterator next_iter;
+        // apply the latest checkpoint not newer than query_timestamp,
+        // then only the delta of deletes after it
+        auto it = accessor.begin();
         {
             std::shared_lock<std::shared_mutex> lock(snap_lock_);
-            // find last meeted snapshot
-            if (!snapshots_.empty()) {
-                int loc = snapshots_.size() - 1;
-                while (loc >= 0 && snapshots_[loc].first > query_timestamp) {
-                    loc--;
-                }
-                if (loc >= 0) {
-                    next_iter = snap_next_iter_[loc];
-                    auto or_size =
-                        std::min(snapshots_[loc].second.size(), bitset.size());
-                    bitset.inplace_or_with_count(snapshots_[loc].second,
-                                                 or_size);
-                    hit_snapshot = true;
+            auto snap = std::upper_bound(
+                snapshots_.begin(),
+                snapshots_.end(),
+                query_timestamp,
+                [](Timestamp ts, const auto& snap) { return ts < snap.first; });
+            if (snap != snapshots_.begin()) {
+                --snap;
+                auto or_size = std::min(snap->second.size(), bitset.size());
+                bitset.inplace_or_with_count(snap->second, or_size);
+                if (snap->first == query_timestamp) {
+                    return;
                 }
+                it = accessor.lower_bound(std::make_pair(
+                    snap->first + 1, std::numeric_limits<Offset>::min()));
             }
         }
 
-        auto it = hit_snapshot ? next_iter : accessor.begin();
-
         while (it != accessor.end() && it->first <= query_timestamp) {
             if (it->second < insert_barrier) {
                 bitset.set(it->second);
@@ -218,6 +232,94 @@ class DeletedRecord {
         }
     }
 
+    // collect what Query over offsets needs at query_timestamp: the latest
+    // checkpoint not after it and the sorted deletes between the two, so
+    // callers probing many batches of the same query pay for it only once
+    DeleteProbe
+    Gather(Timestamp query_timestamp) const {
+        DeleteProbe probe;
+        SortedDeleteList::Accessor accessor(deleted_lists_);
+        if (accessor.size() == 0) {
+            return probe;
+        }
+
+        auto it = accessor.begin();
+        {
+            std::shared_lock<std::shared_mutex> lock(snap_lock_);
+            auto snap = std::upper_bound(
+                snapshots_.begin(),
+                snapshots_.end(),
+                query_timestamp,
+                [](Timestamp ts, const auto& snap) { return ts < snap.first; });
+            if (snap != snapshots_.begin()) {
+                --snap;
+                probe.checkpoint_ts = snap->first;
+                if (snap->first == query_timestamp) {
+                    return probe;
+                }
+                it = accessor.lower_bound(std::make_pair(
+                    snap->first + 1, std::numeric_limits<Offset>::min()));
+            }
+        }
+
+        for (; it != accessor.end() && it->first <= query_timestamp; ++it) {
+            probe.deleted.push_back(it->second);
+        }
+        std::sort(probe.deleted.begin(), probe.deleted.end());
+        return probe;
+    }
+
+    // same as Query, but only for the rows at offsets: bitset[i] is set if
+    // offsets[i] is deleted per the gathered probe, the cost is linear in
+    // count and logarithmic in the deletes after the checkpoint
+    void
+    Query(BitsetTypeView& bitset,
+          const int32_t* offsets,
+          int64_t count,
+          const DeleteProbe& probe) const {
+        Assert(bitset.size() == count);
+
+        if (probe.checkpoint_ts != 0) {
+            // checkpoints are never dropped, so the one found by Gather
+            // is still there
+            std::shared_lock<std::shared_mutex> lock(snap_lock_);
+            auto snap = std::lower_bound(
+                snapshots_.begin(),
+                snapshots_.end(),
+                probe.checkpoint_ts,
+                [](const auto& snap, Timestamp ts) { return snap.first < ts; });
+            AssertInfo(snap != snapshots_.end() &&
+                           snap->first == probe.checkpoint_ts,
+                       "delete checkpoint at ts {} not found",
+                       probe.checkpoint_ts);
+            auto& snap_bits = snap->second;
+            for (int64_t i = 0; i < count; ++i) {
+                if (static_cast<size_t>(offsets[i]) < snap_bits.size() &&
+                    snap_bits[offsets[i]]) {
+                    bitset.set(i);
+                }
+            }
+        }
+
+        if (probe.deleted.empty()) {
+            return;
+        }
+        for (int64_t i = 0; i < count; ++i) {
+            if (std::binary_search(
+                    probe.deleted.begin(), probe.deleted.end(), offsets[i])) {
+                bitset.set(i);
+            }
+        }
+    }
+
+    void
+    Query(BitsetTypeView& bitset,
+          const int32_t* offsets,
+          int64_t count,
+          Timestamp query_timestamp) const {
+        Query(bitset, offsets, count, Gather(query_timestamp));
+    }
+
     size_t
     GetSnapshotBitsSize() const {
         auto all_dump_bits = 0;
@@ -233,70 +335,99 @@ class DeletedRecord {
         return all_dump_bits;
     }
 
+    // materialize a new checkpoint for every DELETE_DUMP_BATCH_SIZE deletes
+    // that are not covered yet, or a single one for all of them if
+    // one_checkpoint is set, each checkpoint holds all deletes with
+    // ts <= its ts, so it is always cut at a timestamp boundary,
+    // callers must hold push_lock_
     void
-    DumpSnapshot() {
+    DumpSnapshot(bool one_checkpoint) {
         SortedDeleteList::Accessor accessor(deleted_lists_);
-        int total_size = accessor.size();
-
-        while (total_size - dumped_entry_count_.load() >
-               DELETE_DUMP_BATCH_SIZE) {
-            int32_t bitsize = 0;
-            if constexpr (is_sealed) {
-                bitsize = sealed_row_count_;
-            } else {
-                bitsize = insert_record_->size();
-            }
-            BitsetType bitmap(bitsize, false);
+        int64_t total_size = accessor.size();
+        int64_t dumped = dumped_entry_count_.load();
+        if (total_size - dumped <= DELETE_DUMP_BATCH_SIZE) {
+            return;
+        }
 
-            auto it = accessor.begin();
-            Timestamp last_dump_ts = 0;
+        int64_t bitsize = 0;
+        if constexpr (is_sealed) {
+            bitsize = sealed_row_count_;
+        } else {
+            bitsize = insert_record_->size();
+        }
+        BitsetType bitmap(bitsize, false);
+
+        auto it = accessor.begin();
+        {
+            std::shared_lock<std::shared_mutex> lock(snap_lock_);
             if (!snapshots_.empty()) {
-                it = snap_next_iter_.back();
-                last_dump_ts = snapshots_.back().first;
-                bitmap.inplace_or_with_count(snapshots_.back().second,
-                                             snapshots_.back().second.size());
+                auto& last = snapshots_.back();
+                bitmap.inplace_or_with_count(
+                    last.second,
+                    std::min(last.second.size(), static_cast<size_t>(bitsize)));
+                it = accessor.lower_bound(std::make_pair(
+                    last.first + 1, std::numeric_limits<Offset>::min()));
             }
+        }
 
-            while (total_size - dumped_entry_count_.load() >
-                       DELETE_DUMP_BATCH_SIZE &&
-                   it != accessor.end()) {
-                Timestamp dump_ts = 0;
+        while (total_size - dumped > DELETE_DUMP_BATCH_SIZE &&
+               it != accessor.end()) {
+            // same coverage as dumping batch by batch, in one bitmap
+            int64_t batch_size = DELETE_DUMP_BATCH_SIZE;
+            if (one_checkpoint) {
+                batch_size *=
+                    (total_size - dumped - 1) / DELETE_DUMP_BATCH_SIZE;
+            }
+            Timestamp dump_ts = 0;
+            int64_t size = 0;
+            for (; size < batch_size && it != accessor.end(); ++it, ++size) {
+                bitmap.set(it->second);
+                dump_ts = it->first;
+            }
+            // deletes sharing the cut timestamp belong to this checkpoint
+            for (; it != accessor.end() && it->first == dump_ts; ++it, ++size) {
+                bitmap.set(it->second);
+            }
 
-                for (auto size = 0;
-                     size < DELETE_DUMP_BATCH_SIZE && it != accessor.end();
-                     ++it, ++size) {
-                    bitmap.set(it->second);
-                    dump_ts = it->first;
-                }
+            size_t snapshot_count = 0;
+            {
+                std::unique_lock<std::shared_mutex> lock(snap_lock_);
+                snapshots_.emplace_back(dump_ts, bitmap.clone());
+                snapshot_count = snapshots_.size();
+                dumped += size;
+                dumped_entry_count_.store(dumped);
+            }
+            LOG_INFO(
+                "dump delete record snapshot at ts: {}, cursor: {}, "
+                "total size:{} "
+                "current snapshot size: {} for segment: {}",
+                dump_ts,
+                dumped,
+                total_size,
+                snapshot_count,
+                segment_id_);
+        }
+    }
 
-                {
-                    std::unique_lock<std::shared_mutex> lock(snap_lock_);
-                    if (dump_ts == last_dump_ts) {
-                        // only update
-                        snapshots_.back().second = std::move(bitmap.clone());
-                        snap_next_iter_.back() = it;
-                    } else {
-                        // add new snapshot
-                        snapshots_.push_back(
-                            std::make_pair(dump_ts, bitmap.clone()));
-                        Assert(it != accessor.end() && it.good());
-                        snap_next_iter_.push_back(it);
-                    }
+    // deletes older than the latest checkpoint, e.g. replayed by LoadPush,
+    // must be visible in every checkpoint that covers their timestamps
+    void
+    PatchSnapshots(const std::vector<std::pair<Timestamp, Offset>>& deletes) {
+        if (deletes.empty()) {
+            return;
+        }
+        std::unique_lock<std::shared_mutex> lock(snap_lock_);
+        for (auto& [delete_ts, row_id] : deletes) {
+            for (auto snap = snapshots_.rbegin();
+                 snap != snapshots_.rend() && snap->first >= delete_ts;
+                 ++snap) {
+                if (snap->second.size() <= static_cast<size_t>(row_id)) {
+                    snap->second.resize(row_id + 1, false);
                 }
-
-                dumped_entry_count_.fetch_add(DELETE_DUMP_BATCH_SIZE);
-                LOG_INFO(
-                    "dump delete record snapshot at ts: {}, cursor: {}, "
-                    "total size:{} "
-                    "current snapshot size: {} for segment: {}",
-                    dump_ts,
-                    dumped_entry_count_.load(),
-                    total_size,
-                    snapshots_.size(),
-                    segment_id_);
-                last_dump_ts = dump_ts;
+                snap->second.set(row_id);
             }
         }
+        dumped_entry_count_.fetch_add(deletes.size());
     }
 
     int64_t
@@ -343,11 +474,13 @@ class DeletedRecord {
     // used to remove duplicated deleted records for fast access
     BitsetType deleted_mask_;
 
+    // serializes LoadPush and StreamPush, the only writers of the delete
+    // list, deleted_mask_ and of new checkpoints
+    std::mutex push_lock_;
     // dump snapshot low frequency
     mutable std::shared_mutex snap_lock_;
+    // checkpoints sorted by ts, each bitmap holds all deletes with ts <= it
     std::vector<std::pair<Timestamp, BitsetType>> snapshots_;
-    // next delete record iterator that follows every snapshot
-    std::vector<SortedDeleteList::iterator> snap_next_iter_;
     // total number of delete entries that have been incorporated into snapshots
     std::atomic<int64_t> dumped_entry_count_{0};
     // estimated memory size of DeletedRecord, only used for sealed segment
@@ -677,3 +677,352 @@ TEST(DeleteMVCC, SnapshotDumpProgress) {
     ASSERT_EQ(2, snapshots.size());
     ASSERT_EQ(20000, snapshots[1].second.count());
 }
+
+TEST(DeleteMVCC, LoadPushBeforeSnapshot) {
+    using namespace milvus;
+    using namespace milvus::query;
+    using namespace milvus::segcore;
+
+    auto schema = std::make_shared<Schema>();
+    auto vec_fid = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto i64_fid = schema->AddDebugField("age", DataType::INT64);
+    schema->set_primary_field_id(i64_fid);
+
+    const int N = 21000;
+    InsertRecord<false> insert_record(*schema, N);
+    DeletedRecord<false> delete_record(
+        &insert_record,
+        [&insert_record](
+            const std::vector<PkType>& pks,
+            const Timestamp* timestamps,
+            std::function<void(const SegOffset offset, const Timestamp ts)>
+                cb) {
+            for (size_t i = 0; i < pks.size(); ++i) {
+                auto timestamp = timestamps[i];
+                auto offsets = insert_record.search_pk(pks[i], timestamp);
+                for (auto offset : offsets) {
+                    cb(offset, timestamp);
+                }
+            }
+        },
+        0);
+
+    // insert pk=i at ts=i
+    std::vector<int64_t> age_data(N);
+    std::vector<Timestamp> tss(N);
+    for (int i = 0; i < N; ++i) {
+        age_data[i] = i;
+        tss[i] = i;
+        insert_record.insert_pk(age_data[i], i);
+    }
+    auto insert_offset = insert_record.reserved.fetch_add(N);
+    insert_record.timestamps_.set_data_raw(insert_offset, tss.data(), N);
+    auto field_data = insert_record.get_data_base(i64_fid);
+    field_data->set_data_raw(insert_offset, age_data.data(), N);
+    insert_record.ack_responder_.AddSegment(insert_offset, insert_offset + N);
+
+    // delete pk 10 .. 10010 at ts 20 .. 10020, dumps a snapshot at ts 10019
+    const int B = 10000;
+    const int SN = B + 1;
+    std::vector<Timestamp> stream_ts(SN);
+    std::vector<PkType> stream_pk(SN);
+    for (int i = 0; i < SN; ++i) {
+        stream_pk[i] = age_data[10 + i];
+        stream_ts[i] = 20 + i;
+    }
+    delete_record.StreamPush(stream_pk, stream_ts.data());
+    auto snapshots = delete_record.get_snapshots();
+    ASSERT_EQ(1, snapshots.size());
+    ASSERT_EQ(B + 19, snapshots[0].first);
+    ASSERT_EQ(B, snapshots[0].second.count());
+
+    // load older deletes of pk 0 .. 9 at ts 1 .. 10 after the snapshot
+    const int LN = 10;
+    std::vector<Timestamp> load_ts(LN);
+    std::vector<PkType> load_pk(LN);
+    for (int i = 0; i < LN; ++i) {
+        load_pk[i] = age_data[i];
+        load_ts[i] = i + 1;
+    }
+    delete_record.LoadPush(load_pk, load_ts.data());
+    snapshots = delete_record.get_snapshots();
+    ASSERT_EQ(1, snapshots.size());
+    ASSERT_EQ(B + LN, snapshots[0].second.count());
+
+    // query hits the snapshot and still sees the loaded deletes
+    for (Timestamp query_timestamp : {Timestamp(B + 19), Timestamp(B + 20)}) {
+        BitsetType bitsets(N);
+        BitsetTypeView bitsets_view(bitsets);
+        delete_record.Query(bitsets_view, N, query_timestamp);
+        int deleted = query_timestamp - 20 + 1 + 10;
+        for (int i = 0; i < N; i++) {
+            ASSERT_EQ(bitsets_view[i], i < deleted) << i;
+        }
+    }
+
+    // query older than the snapshot replays deletes only
+    {
+        BitsetType bitsets(N);
+        BitsetTypeView bitsets_view(bitsets);
+        delete_record.Query(bitsets_view, N, 5);
+        for (int i = 0; i < N; i++) {
+            ASSERT_EQ(bitsets_view[i], i < 5) << i;
+        }
+    }
+}
+
+TEST(DeleteMVCC, LoadPushDumpsOneCheckpoint) {
+    using namespace milvus;
+    using namespace milvus::query;
+    using namespace milvus::segcore;
+
+    auto schema = std::make_shared<Schema>();
+    auto vec_fid = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto i64_fid = schema->AddDebugField("age", DataType::INT64);
+    schema->set_primary_field_id(i64_fid);
+
+    const int N = 36000;
+    InsertRecord<false> insert_record(*schema, N);
+    DeletedRecord<false> delete_record(
+        &insert_record,
+        [&insert_record](
+            const std::vector<PkType>& pks,
+            const Timestamp* timestamps,
+            std::function<void(const SegOffset offset, const Timestamp ts)>
+                cb) {
+            for (size_t i = 0; i < pks.size(); ++i) {
+                auto timestamp = timestamps[i];
+                auto offsets = insert_record.search_pk(pks[i], timestamp);
+                for (auto offset : offsets) {
+                    cb(offset, timestamp);
+                }
+            }
+        },
+        0);
+
+    // insert pk=i at ts=i
+    std::vector<int64_t> age_data(N);
+    std::vector<Timestamp> tss(N);
+    for (int i = 0; i < N; ++i) {
+        age_data[i] = i;
+        tss[i] = i;
+        insert_record.insert_pk(age_data[i], i);
+    }
+    auto insert_offset = insert_record.reserved.fetch_add(N);
+    insert_record.timestamps_.set_data_raw(insert_offset, tss.data(), N);
+    auto field_data = insert_record.get_data_base(i64_fid);
+    field_data->set_data_raw(insert_offset, age_data.data(), N);
+    insert_record.ack_responder_.AddSegment(insert_offset, insert_offset + N);
+
+    // load deletes of pk i at ts N + i, in reverse ts order
+    const int LN = 35000;
+    std::vector<Timestamp> load_ts(LN);
+    std::vector<PkType> load_pk(LN);
+    for (int i = 0; i < LN; ++i) {
+        load_pk[i] = age_data[LN - 1 - i];
+        load_ts[i] = N + LN - 1 - i;
+    }
+    delete_record.LoadPush(load_pk, load_ts.data());
+
+    // one checkpoint with the coverage of three dump batches
+    auto snapshots = delete_record.get_snapshots();
+    ASSERT_EQ(1, snapshots.size());
+    ASSERT_EQ(Timestamp(N + 30000 - 1), snapshots[0].first);
+    ASSERT_EQ(30000, snapshots[0].second.count());
+
+    for (Timestamp query_timestamp : {Timestamp(N + 100),
+                                      Timestamp(N + 30000 - 1),
+                                      Timestamp(N + LN)}) {
+        BitsetType bitsets(N);
+        BitsetTypeView bitsets_view(bitsets);
+        delete_record.Query(bitsets_view, N, query_timestamp);
+        int deleted = std::min<int>(query_timestamp - N + 1, LN);
+        for (int i = 0; i < N; i++) {
+            ASSERT_EQ(bitsets_view[i], i < deleted) << i;
+        }
+    }
+}
+
+TEST(DeleteMVCC, QueryOffsets) {
+    using namespace milvus;
+    using namespace milvus::query;
+    using namespace milvus::segcore;
+
+    auto schema = std::make_shared<Schema>();
+    auto vec_fid = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto i64_fid = schema->AddDebugField("age", DataType::INT64);
+    schema->set_primary_field_id(i64_fid);
+
+    const int N = 30000;
+    InsertRecord<false> insert_record(*schema, N);
+    DeletedRecord<false> delete_record(
+        &insert_record,
+        [&insert_record](
+            const std::vector<PkType>& pks,
+            const Timestamp* timestamps,
+            std::function<void(const SegOffset offset, const Timestamp ts)>
+                cb) {
+            for (size_t i = 0; i < pks.size(); ++i) {
+                auto timestamp = timestamps[i];
+                auto offsets = insert_record.search_pk(pks[i], timestamp);
+                for (auto offset : offsets) {
+                    cb(offset, timestamp);
+                }
+            }
+        },
+        0);
+
+    // insert pk=i at ts=i
+    std::vector<int64_t> age_data(N);
+    std::vector<Timestamp> tss(N);
+    for (int i = 0; i < N; ++i) {
+        age_data[i] = i;
+        tss[i] = i;
+        insert_record.insert_pk(age_data[i], i);
+    }
+    auto insert_offset = insert_record.reserved.fetch_add(N);
+    insert_record.timestamps_.set_data_raw(insert_offset, tss.data(), N);
+    auto field_data = insert_record.get_data_base(i64_fid);
+    field_data->set_data_raw(insert_offset, age_data.data(), N);
+    insert_record.ack_responder_.AddSegment(insert_offset, insert_offset + N);
+
+    // delete every other pk at ts N + i, dumps a snapshot on the way
+    const int DN = 12000;
+    std::vector<Timestamp> delete_ts(DN);
+    std::vector<PkType> delete_pk(DN);
+    for (int i = 0; i < DN; ++i) {
+        delete_pk[i] = age_data[2 * i];
+        delete_ts[i] = N + i;
+    }
+    delete_record.StreamPush(delete_pk, delete_ts.data());
+    ASSERT_EQ(1, delete_record.get_snapshots().size());
+
+    // candidates out of order and repeated, as returned by an iterator
+    std::vector<int32_t> offsets;
+    for (int i = 0; i < 1000; ++i) {
+        offsets.push_back((i * 7919) % N);
+    }
+    offsets.push_back(offsets.front());
+
+    auto snapshot_ts = delete_record.get_snapshots()[0].first;
+    for (Timestamp query_timestamp : {Timestamp(N - 1),
+                                      Timestamp(N + 100),
+                                      snapshot_ts,
+                                      snapshot_ts + 1,
+                                      Timestamp(N + DN)}) {
+        BitsetType all(N);
+        BitsetTypeView all_view(all);
+        delete_record.Query(all_view, N, query_timestamp);
+
+        BitsetType deleted(offsets.size());
+        BitsetTypeView deleted_view(deleted);
+        delete_record.Query(
+            deleted_view, offsets.data(), offsets.size(), query_timestamp);
+        for (size_t i = 0; i < offsets.size(); ++i) {
+            ASSERT_EQ(deleted_view[i], all_view[offsets[i]])
+                << query_timestamp << " " << offsets[i];
+        }
+    }
+}
+
+TEST(DeleteMVCC, QueryOffsetsWithGatheredProbe) {
+    using namespace milvus;
+    using namespace milvus::query;
+    using namespace milvus::segcore;
+
+    auto schema = std::make_shared<Schema>();
+    auto vec_fid = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto i64_fid = schema->AddDebugField("age", DataType::INT64);
+    schema->set_primary_field_id(i64_fid);
+
+    const int N = 30000;
+    InsertRecord<false> insert_record(*schema, N);
+    DeletedRecord<false> delete_record(
+        &insert_record,
+        [&insert_record](
+            const std::vector<PkType>& pks,
+            const Timestamp* timestamps,
+            std::function<void(const SegOffset offset, const Timestamp ts)>
+                cb) {
+            for (size_t i = 0; i < pks.size(); ++i) {
+                auto timestamp = timestamps[i];
+                auto offsets = insert_record.search_pk(pks[i], timestamp);
+                for (auto offset : offsets) {
+                    cb(offset, timestamp);
+                }
+            }
+        },
+        0);
+
+    // insert pk=i at ts=i
+    std::vector<int64_t> age_data(N);
+    std::vector<Timestamp> tss(N);
+    for (int i = 0; i < N; ++i) {
+        age_data[i] = i;
+        tss[i] = i;
+        insert_record.insert_pk(age_data[i], i);
+    }
+    auto insert_offset = insert_record.reserved.fetch_add(N);
+    insert_record.timestamps_.set_data_raw(insert_offset, tss.data(), N);
+    auto field_data = insert_record.get_data_base(i64_fid);
+    field_data->set_data_raw(insert_offset, age_data.data(), N);
+    insert_record.ack_responder_.AddSegment(insert_offset, insert_offset + N);
+
+    // delete every other pk at ts N + i, dumps a snapshot on the way
+    const int DN = 12000;
+    std::vector<Timestamp> delete_ts(DN);
+    std::vector<PkType> delete_pk(DN);
+    for (int i = 0; i < DN; ++i) {
+        delete_pk[i] = age_data[2 * i];
+        delete_ts[i] = N + i;
+    }
+    delete_record.StreamPush(delete_pk, delete_ts.data());
+    ASSERT_EQ(1, delete_record.get_snapshots().size());
+
+    std::vector<int32_t> offsets;
+    for (int i = 0; i < 1000; ++i) {
+        offsets.push_back((i * 7919) % N);
+    }
+
+    auto snapshot_ts = delete_record.get_snapshots()[0].first;
+    std::vector<Timestamp> query_timestamps{
+        Timestamp(N + 100), snapshot_ts, snapshot_ts + 1, Timestamp(N + DN)};
+    std::vector<DeleteProbe> probes;
+    std::vector<BitsetType> expected;
+    for (auto query_timestamp : query_timestamps) {
+        probes.push_back(delete_record.Gather(query_timestamp));
+        BitsetType all(N);
+        BitsetTypeView all_view(all);
+        delete_record.Query(all_view, N, query_timestamp);
+        expected.push_back(std::move(all));
+    }
+
+    // newer deletes and checkpoints must not change what a probe sees
+    for (int i = 0; i < DN; ++i) {
+        delete_pk[i] = age_data[2 * i + 1];
+        delete_ts[i] = N + DN + i;
+    }
+    delete_record.StreamPush(delete_pk, delete_ts.data());
+    ASSERT_LT(1, delete_record.get_snapshots().size());
+
+    // probe the same gathered deletes batch by batch, as an iterator does
+    const int64_t batch = 64;
+    for (size_t q = 0; q < probes.size(); ++q) {
+        for (size_t begin = 0; begin < offsets.size(); begin += batch) {
+            int64_t count =
+                std::min<int64_t>(batch, offsets.size() - begin);
+            BitsetType deleted(count);
+            BitsetTypeView deleted_view(deleted);
+            delete_record.Query(
+                deleted_view, offsets.data() + begin, count, probes[q]);
+            for (int64_t i = 0; i < count; ++i) {
+                ASSERT_EQ(deleted_view[i], expected[q][offsets[begin + i]])
+                    << query_timestamps[q] << " " << offsets[begin + i];
+            }
+        }
+    }
+}
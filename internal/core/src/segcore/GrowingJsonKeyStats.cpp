@@ -0,0 +1,279 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "segcore/GrowingJsonKeyStats.h"
+
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <type_traits>
+#include <unordered_set>
+
+#include "common/EasyAssert.h"
+
+namespace milvus::segcore {
+
+namespace {
+
+void
+AppendEscapedKey(std::string& pointer, std::string_view key) {
+    pointer.push_back('/');
+    for (auto c : key) {
+        if (c == '~') {
+            pointer.append("~0");
+        } else if (c == '/') {
+            pointer.append("~1");
+        } else {
+            pointer.push_back(c);
+        }
+    }
+}
+
+// Calls visit with the pointer and value of every scalar under object. Like
+// a lookup by pointer, only the first of duplicated keys is visited.
+template <typename Visit>
+void
+TraverseObject(simdjson::dom::object object,
+               std::string& pointer,
+               std::unordered_set<std::string>& seen,
+               Visit& visit) {
+    for (auto field : object) {
+        auto size = pointer.size();
+        AppendEscapedKey(pointer, field.key);
+        if (seen.insert(pointer).second) {
+            if (field.value.is_object()) {
+                TraverseObject(
+                    field.value.get_object().value(), pointer, seen, visit);
+            } else {
+                visit(pointer, field.value);
+            }
+        }
+        pointer.resize(size);
+    }
+}
+
+}  // namespace
+
+GrowingJsonKeyStats::Column::Column(index::JSONType type,
+                                    int64_t size_per_chunk)
+    : type(type), valid(size_per_chunk) {
+    switch (type) {
+        case index::JSONType::BOOL:
+            values = std::make_unique<ConcurrentVector<bool>>(size_per_chunk);
+            break;
+        case index::JSONType::INT64:
+            values =
+                std::make_unique<ConcurrentVector<int64_t>>(size_per_chunk);
+            break;
+        case index::JSONType::DOUBLE:
+            values =
+                std::make_unique<ConcurrentVector<double>>(size_per_chunk);
+            break;
+        case index::JSONType::STRING:
+            values = std::make_unique<ConcurrentVector<std::string>>(
+                size_per_chunk);
+            break;
+        default:
+            ThrowInfo(ErrorCode::UnexpectedError,
+                      "unsupported shredding type {} of growing json key "
+                      "stats",
+                      index::ToString(type));
+    }
+}
+
+GrowingJsonKeyStats::GrowingJsonKeyStats(int64_t size_per_chunk,
+                                         int64_t max_shredding_columns,
+                                         double shredding_ratio_threshold,
+                                         int64_t shredding_window)
+    : size_per_chunk_(size_per_chunk),
+      max_shredding_columns_(max_shredding_columns),
+      shredding_ratio_threshold_(shredding_ratio_threshold),
+      shredding_window_(shredding_window) {
+    AssertInfo(shredding_window_ > 0,
+               "shredding window of growing json key stats must be positive, "
+               "got {}",
+               shredding_window_);
+}
+
+int64_t
+GrowingJsonKeyStats::Append(int64_t offset, const Json& json) {
+    std::vector<index::JsonKey> shared_keys;
+    if (json.size() == 0) {
+        return AddSharedRow(shared_keys, offset);
+    }
+    thread_local simdjson::dom::parser parser;
+    auto doc = parser.parse(json.data().data(), json.size());
+    if (doc.error() != simdjson::SUCCESS) {
+        {
+            std::unique_lock lck(mutex_);
+            unparsed_rows_.push_back(offset);
+        }
+        return sizeof(int64_t) + AddSharedRow(shared_keys, offset);
+    }
+    if (!doc.value().is_object()) {
+        return AddSharedRow(shared_keys, offset);
+    }
+
+    int64_t bytes = 0;
+    auto set = [this, offset, &shared_keys, &bytes](
+                   const std::string& pointer,
+                   index::JSONType type,
+                   const auto& value) {
+        index::JsonKey key(pointer, type);
+        auto column = GetColumn(key);
+        if (column == nullptr) {
+            shared_keys.push_back(std::move(key));
+            return;
+        }
+        column->values->set_data_raw(offset, &value, 1);
+        bool valid = true;
+        column->valid.set_data_raw(offset, &valid, 1);
+        bytes += sizeof(value) + sizeof(bool);
+        if constexpr (std::is_same_v<std::decay_t<decltype(value)>,
+                                     std::string>) {
+            bytes += value.size();
+        }
+    };
+    auto visit = [&set](const std::string& pointer,
+                        simdjson::dom::element value) {
+        switch (value.type()) {
+            case simdjson::dom::element_type::BOOL:
+                set(pointer, index::JSONType::BOOL, value.get_bool().value());
+                break;
+            case simdjson::dom::element_type::INT64:
+                set(pointer,
+                    index::JSONType::INT64,
+                    value.get_int64().value());
+                break;
+            // out of the range of int64, read back as a double
+            case simdjson::dom::element_type::UINT64:
+            case simdjson::dom::element_type::DOUBLE:
+                set(pointer,
+                    index::JSONType::DOUBLE,
+                    value.get_double().value());
+                break;
+            case simdjson::dom::element_type::STRING:
+                set(pointer,
+                    index::JSONType::STRING,
+                    std::string(value.get_string().value()));
+                break;
+            default:
+                // arrays and nulls match no scalar filter
+                break;
+        }
+    };
+    std::string pointer;
+    std::unordered_set<std::string> seen;
+    TraverseObject(doc.value().get_object().value(), pointer, seen, visit);
+    return bytes + AddSharedRow(shared_keys, offset);
+}
+
+int64_t
+GrowingJsonKeyStats::AppendNull(int64_t offset) {
+    {
+        std::unique_lock lck(mutex_);
+        null_rows_.push_back(offset);
+    }
+    return sizeof(int64_t) + AddSharedRow({}, offset);
+}
+
+std::string
+GrowingJsonKeyStats::GetShreddingField(const std::string& pointer,
+                                       index::JSONType type) const {
+    auto name = index::JsonKey(pointer, type).ToColumnName();
+    std::shared_lock lck(mutex_);
+    return columns_.count(name) > 0 ? name : "";
+}
+
+std::vector<int64_t>
+GrowingJsonKeyStats::GetSharedRows(const std::string& pointer,
+                                   int64_t num_rows) const {
+    std::vector<int64_t> rows;
+    std::shared_lock lck(mutex_);
+    auto it = shared_rows_.find(pointer);
+    if (it != shared_rows_.end()) {
+        std::copy_if(it->second.begin(),
+                     it->second.end(),
+                     std::back_inserter(rows),
+                     [num_rows](int64_t row) { return row < num_rows; });
+    }
+    std::copy_if(unparsed_rows_.begin(),
+                 unparsed_rows_.end(),
+                 std::back_inserter(rows),
+                 [num_rows](int64_t row) { return row < num_rows; });
+    return rows;
+}
+
+std::vector<int64_t>
+GrowingJsonKeyStats::GetNullRows(int64_t num_rows) const {
+    std::vector<int64_t> rows;
+    std::shared_lock lck(mutex_);
+    std::copy_if(null_rows_.begin(),
+                 null_rows_.end(),
+                 std::back_inserter(rows),
+                 [num_rows](int64_t row) { return row < num_rows; });
+    return rows;
+}
+
+GrowingJsonKeyStats::Column*
+GrowingJsonKeyStats::GetColumn(const index::JsonKey& key) const {
+    std::shared_lock lck(mutex_);
+    auto it = columns_.find(key.ToColumnName());
+    return it != columns_.end() ? it->second.get() : nullptr;
+}
+
+int64_t
+GrowingJsonKeyStats::AddSharedRow(const std::vector<index::JsonKey>& keys,
+                                  int64_t offset) {
+    auto closes_window = (num_rows_.fetch_add(1) + 1) % shredding_window_ == 0;
+    if (keys.empty() && !closes_window) {
+        return 0;
+    }
+    std::unique_lock lck(mutex_);
+    for (const auto& key : keys) {
+        shared_rows_[key.key_].push_back(offset);
+        // a key seen once the columns ran out is never shredded
+        if (columns_.size() < max_shredding_columns_) {
+            ++window_hits_[key];
+        }
+    }
+    if (closes_window) {
+        PromoteKeys();
+    }
+    return keys.size() * sizeof(int64_t);
+}
+
+void
+GrowingJsonKeyStats::PromoteKeys() {
+    std::vector<std::pair<int64_t, const index::JsonKey*>> candidates;
+    for (const auto& [key, hits] : window_hits_) {
+        if (hits >= shredding_ratio_threshold_ * shredding_window_) {
+            candidates.emplace_back(hits, &key);
+        }
+    }
+    // the most frequent keys first if the columns run out
+    std::stable_sort(
+        candidates.begin(),
+        candidates.end(),
+        [](const auto& a, const auto& b) { return a.first > b.first; });
+    for (const auto& [hits, key] : candidates) {
+        if (columns_.size() >= max_shredding_columns_) {
+            break;
+        }
+        // the rows appended before keep their values in the shared rows, a
+        // filter reads both
+        columns_.emplace(key->ToColumnName(),
+                         std::make_unique<Column>(key->type_, size_per_chunk_));
+    }
+    window_hits_.clear();
+}
+
+}  // namespace milvus::segcore
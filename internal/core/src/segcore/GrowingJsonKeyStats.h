@@ -0,0 +1,216 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/Json.h"
+#include "common/Types.h"
+#include "index/json_stats/utils.h"
+#include "segcore/ConcurrentVector.h"
+
+namespace milvus::segcore {
+
+// (path, type) pairs of a growing segment shredded into typed columns, the
+// values of any further pair are read from the raw json of their rows
+constexpr int64_t GROWING_JSON_KEY_STATS_MAX_SHREDDING_COLUMNS = 1024;
+// min ratio of the rows of a window holding a (path, type) pair to shred it,
+// like the shredding ratio threshold of the sealed JsonKeyStats
+constexpr double GROWING_JSON_KEY_STATS_SHREDDING_RATIO_THRESHOLD = 0.3;
+// rows over which the hit ratio of the keys not shredded yet is measured
+constexpr int64_t GROWING_JSON_KEY_STATS_SHREDDING_WINDOW = 1024;
+
+// JSON key stats of a growing segment, maintained while rows are inserted.
+//
+// Every scalar value of a row is keyed by its JSON pointer and its type. The
+// rows holding the values of a key are first kept by pointer in an inverted
+// map, they are the only rows whose raw json is read for a filter on the
+// pointer. A key held by at least shredding_ratio_threshold of the rows of a
+// window is promoted to a typed column, named like the columns of the sealed
+// JsonKeyStats, so that a filter on it compares the column for the rows
+// appended afterwards; at most max_shredding_columns keys are promoted, rare
+// keys stay in the inverted map. Arrays, objects and nulls are not recorded,
+// no scalar filter matches them.
+class GrowingJsonKeyStats {
+ public:
+    GrowingJsonKeyStats(
+        int64_t size_per_chunk,
+        int64_t max_shredding_columns =
+            GROWING_JSON_KEY_STATS_MAX_SHREDDING_COLUMNS,
+        double shredding_ratio_threshold =
+            GROWING_JSON_KEY_STATS_SHREDDING_RATIO_THRESHOLD,
+        int64_t shredding_window = GROWING_JSON_KEY_STATS_SHREDDING_WINDOW);
+
+    // records the keys of the row at offset, rows may be appended
+    // concurrently and out of order. Returns the estimated bytes the row
+    // added to the stats.
+    int64_t
+    Append(int64_t offset, const Json& json);
+
+    // records the row at offset as a null json, returns the estimated bytes
+    // it added to the stats
+    int64_t
+    AppendNull(int64_t offset);
+
+    // shredded column of the values of type at pointer, empty if there is
+    // none
+    std::string
+    GetShreddingField(const std::string& pointer,
+                      index::JSONType type) const;
+
+    // Runs func over the chunks of the shredded column field for the rows
+    // before num_rows, like JsonKeyStats::ExecutorForShreddingData. Rows
+    // without a value in the column are not valid. Returns the number of
+    // rows processed, 0 if there is no such column.
+    template <typename T, typename FUNC>
+    int64_t
+    ExecutorForShreddingData(const std::string& field,
+                             FUNC func,
+                             TargetBitmapView res,
+                             TargetBitmapView valid_res,
+                             int64_t num_rows) const;
+
+    // rows before num_rows with a value at pointer that is not shredded, and
+    // rows whose json could not be parsed, in no particular order
+    std::vector<int64_t>
+    GetSharedRows(const std::string& pointer, int64_t num_rows) const;
+
+    // null rows before num_rows, in no particular order
+    std::vector<int64_t>
+    GetNullRows(int64_t num_rows) const;
+
+    int64_t
+    num_shredding_columns() const {
+        std::shared_lock lck(mutex_);
+        return columns_.size();
+    }
+
+ private:
+    struct Column {
+        Column(index::JSONType type, int64_t size_per_chunk);
+
+        index::JSONType type;
+        // ConcurrentVector of bool, int64_t, double or std::string
+        std::unique_ptr<VectorBase> values;
+        ConcurrentVector<bool> valid;
+    };
+
+    // column of key, nullptr if it is not shredded
+    Column*
+    GetColumn(const index::JsonKey& key) const;
+
+    // records the keys of the row at offset that have no column, and
+    // promotes the frequent keys once the row closes a window. Returns the
+    // estimated bytes added to the shared rows.
+    int64_t
+    AddSharedRow(const std::vector<index::JsonKey>& keys, int64_t offset);
+
+    // promotes the keys hit by enough rows of the closed window, the caller
+    // holds mutex_ exclusively
+    void
+    PromoteKeys();
+
+    const int64_t size_per_chunk_;
+    const int64_t max_shredding_columns_;
+    const double shredding_ratio_threshold_;
+    const int64_t shredding_window_;
+
+    mutable std::shared_mutex mutex_;
+    // column name -> column, columns are never removed
+    std::unordered_map<std::string, std::unique_ptr<Column>> columns_;
+    // pointer -> rows with a value at pointer that is not shredded
+    std::unordered_map<std::string, std::vector<int64_t>> shared_rows_;
+    // rows that could not be parsed, a value at any pointer may be there
+    std::vector<int64_t> unparsed_rows_;
+    std::vector<int64_t> null_rows_;
+    // rows appended, a window closes every shredding_window_ rows
+    std::atomic<int64_t> num_rows_ = 0;
+    // key without a column -> rows of the current window holding it
+    std::map<index::JsonKey, int64_t> window_hits_;
+};
+
+template <typename T, typename FUNC>
+int64_t
+GrowingJsonKeyStats::ExecutorForShreddingData(const std::string& field,
+                                              FUNC func,
+                                              TargetBitmapView res,
+                                              TargetBitmapView valid_res,
+                                              int64_t num_rows) const {
+    using ColumnType =
+        std::conditional_t<std::is_same_v<T, std::string_view>,
+                           std::string,
+                           T>;
+    const Column* column = nullptr;
+    {
+        std::shared_lock lck(mutex_);
+        auto it = columns_.find(field);
+        if (it == columns_.end()) {
+            return 0;
+        }
+        column = it->second.get();
+    }
+    auto values = dynamic_cast<const ConcurrentVector<ColumnType>*>(
+        column->values.get());
+    AssertInfo(values != nullptr,
+               "shredding column {} of growing json key stats is not of the "
+               "requested type",
+               field);
+
+    std::vector<std::string_view> views;
+    int64_t processed_size = 0;
+    for (int64_t chunk_id = 0; processed_size < num_rows; ++chunk_id) {
+        auto chunk_size =
+            std::min(size_per_chunk_, num_rows - processed_size);
+        // the valid flags are written after the values, a chunk without them
+        // holds no value before num_rows yet
+        if (chunk_id >= column->valid.num_chunk() ||
+            chunk_id >= values->num_chunk()) {
+            auto chunk_res = res + processed_size;
+            auto chunk_valid_res = valid_res + processed_size;
+            for (int64_t i = 0; i < chunk_size; ++i) {
+                chunk_res[i] = chunk_valid_res[i] = false;
+            }
+            processed_size += chunk_size;
+            continue;
+        }
+        auto valid_data =
+            static_cast<const bool*>(column->valid.get_chunk_data(chunk_id));
+        auto data = static_cast<const ColumnType*>(
+            values->get_chunk_data(chunk_id));
+        if constexpr (std::is_same_v<T, std::string_view>) {
+            views.assign(data, data + chunk_size);
+            func(views.data(),
+                 valid_data,
+                 chunk_size,
+                 res + processed_size,
+                 valid_res + processed_size);
+        } else {
+            func(data,
+                 valid_data,
+                 chunk_size,
+                 res + processed_size,
+                 valid_res + processed_size);
+        }
+        processed_size += chunk_size;
+    }
+    return processed_size;
+}
+
+}  // namespace milvus::segcore
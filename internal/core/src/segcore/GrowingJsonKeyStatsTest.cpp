@@ -0,0 +1,172 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "segcore/GrowingJsonKeyStats.h"
+
+using namespace milvus;
+using namespace milvus::segcore;
+
+namespace {
+
+Json
+MakeJson(const std::string& str) {
+    return Json(simdjson::padded_string(str));
+}
+
+std::vector<int64_t>
+Sorted(std::vector<int64_t> rows) {
+    std::sort(rows.begin(), rows.end());
+    return rows;
+}
+
+}  // namespace
+
+TEST(GrowingJsonKeyStats, ShreddingColumns) {
+    // every row closes a window, a key is shredded after its first row
+    GrowingJsonKeyStats stats(
+        4, GROWING_JSON_KEY_STATS_MAX_SHREDDING_COLUMNS, 0.3, 1);
+    stats.Append(0, MakeJson(R"({"a": 1, "b": {"c": "x"}, "d": true})"));
+    stats.Append(1, MakeJson(R"({"a": 2.5, "b": {"c": "y"}})"));
+    stats.Append(2, MakeJson(R"({"a": [1, 2], "e": null, "f/g": 3})"));
+    stats.AppendNull(3);
+
+    ASSERT_EQ(stats.num_shredding_columns(), 5);
+    ASSERT_EQ(stats.GetShreddingField("/a", index::JSONType::INT64),
+              index::JsonKey("/a", index::JSONType::INT64).ToColumnName());
+    ASSERT_NE(stats.GetShreddingField("/a", index::JSONType::DOUBLE), "");
+    ASSERT_NE(stats.GetShreddingField("/b/c", index::JSONType::STRING), "");
+    ASSERT_NE(stats.GetShreddingField("/d", index::JSONType::BOOL), "");
+    ASSERT_NE(stats.GetShreddingField("/f~1g", index::JSONType::INT64), "");
+    ASSERT_EQ(stats.GetShreddingField("/a", index::JSONType::STRING), "");
+    ASSERT_EQ(stats.GetShreddingField("/e", index::JSONType::INT64), "");
+    ASSERT_EQ(Sorted(stats.GetNullRows(4)), std::vector<int64_t>{3});
+    ASSERT_TRUE(stats.GetNullRows(3).empty());
+    ASSERT_EQ(Sorted(stats.GetSharedRows("/a", 4)),
+              (std::vector<int64_t>{0, 1}));
+    ASSERT_EQ(Sorted(stats.GetSharedRows("/b/c", 4)),
+              std::vector<int64_t>{0});
+}
+
+TEST(GrowingJsonKeyStats, ExecutorForShreddingData) {
+    // rows span several chunks, some never written
+    constexpr int64_t num_rows = 11;
+    GrowingJsonKeyStats stats(
+        4, GROWING_JSON_KEY_STATS_MAX_SHREDDING_COLUMNS, 0.3, 1);
+    for (int64_t i = 0; i < 6; ++i) {
+        stats.Append(i, MakeJson(fmt::format(R"({{"a": {}}})", i)));
+    }
+    stats.Append(6, MakeJson(R"({"a": "6"})"));
+    stats.Append(7, MakeJson(R"({"a": "6"})"));
+
+    auto field = stats.GetShreddingField("/a", index::JSONType::INT64);
+    TargetBitmap res(num_rows);
+    TargetBitmap valid_res(num_rows, true);
+    auto greater_than_two = [](const int64_t* src,
+                               const bool* valid,
+                               size_t size,
+                               TargetBitmapView res,
+                               TargetBitmapView valid_res) {
+        for (size_t i = 0; i < size; ++i) {
+            valid_res[i] = valid[i];
+            res[i] = valid[i] && src[i] > 2;
+        }
+    };
+    ASSERT_EQ(stats.ExecutorForShreddingData<int64_t>(
+                  field, greater_than_two, res, valid_res, num_rows),
+              num_rows);
+    for (int64_t i = 0; i < num_rows; ++i) {
+        ASSERT_EQ(res[i], i > 2 && i < 6) << i;
+        // the first row was appended before the column
+        ASSERT_EQ(valid_res[i], i > 0 && i < 6) << i;
+    }
+
+    field = stats.GetShreddingField("/a", index::JSONType::STRING);
+    auto equal_six = [](const std::string_view* src,
+                        const bool* valid,
+                        size_t size,
+                        TargetBitmapView res,
+                        TargetBitmapView valid_res) {
+        for (size_t i = 0; i < size; ++i) {
+            valid_res[i] = valid[i];
+            res[i] = valid[i] && src[i] == "6";
+        }
+    };
+    ASSERT_EQ(stats.ExecutorForShreddingData<std::string_view>(
+                  field, equal_six, res, valid_res, num_rows),
+              num_rows);
+    for (int64_t i = 0; i < num_rows; ++i) {
+        ASSERT_EQ(res[i], i == 7) << i;
+        ASSERT_EQ(valid_res[i], i == 7) << i;
+    }
+
+    ASSERT_EQ(stats.ExecutorForShreddingData<int64_t>(
+                  "missing", greater_than_two, res, valid_res, num_rows),
+              0);
+}
+
+TEST(GrowingJsonKeyStats, SharedRows) {
+    GrowingJsonKeyStats stats(4, 2, 0.3, 1);
+    stats.Append(0, MakeJson(R"({"a": 1, "b": 2})"));
+    stats.Append(1, MakeJson(R"({"a": 3, "c": 4, "b": "x"})"));
+    stats.Append(2, MakeJson(R"({"c": 5})"));
+    stats.Append(3, MakeJson(R"({"a": 1, "a": "dup"})"));
+    stats.Append(4, MakeJson(R"({"a": )"));
+
+    // the columns ran out after the first row, later keys are shared
+    ASSERT_EQ(stats.num_shredding_columns(), 2);
+    ASSERT_NE(stats.GetShreddingField("/a", index::JSONType::INT64), "");
+    ASSERT_NE(stats.GetShreddingField("/b", index::JSONType::INT64), "");
+    ASSERT_EQ(stats.GetShreddingField("/c", index::JSONType::INT64), "");
+    ASSERT_EQ(Sorted(stats.GetSharedRows("/c", 5)),
+              (std::vector<int64_t>{1, 2, 4}));
+    ASSERT_EQ(Sorted(stats.GetSharedRows("/b", 5)),
+              (std::vector<int64_t>{0, 1, 4}));
+    ASSERT_EQ(Sorted(stats.GetSharedRows("/c", 2)), std::vector<int64_t>{1});
+    // only the first of duplicated keys is recorded
+    ASSERT_EQ(Sorted(stats.GetSharedRows("/a", 5)),
+              (std::vector<int64_t>{0, 4}));
+}
+
+TEST(GrowingJsonKeyStats, ShreddingByHitRatio) {
+    GrowingJsonKeyStats stats(
+        8, GROWING_JSON_KEY_STATS_MAX_SHREDDING_COLUMNS, 0.3, 10);
+    int64_t size = 0;
+    for (int64_t i = 0; i < 30; ++i) {
+        // "rare" is held by 2 rows of a window, "common" by all of them
+        auto json = i % 10 < 2 ? R"({"common": 1, "rare": 2})"
+                               : R"({"common": 1})";
+        size += stats.Append(i, MakeJson(json));
+        if (i == 8) {
+            // the first window is not closed yet
+            ASSERT_EQ(stats.num_shredding_columns(), 0);
+        }
+    }
+    ASSERT_EQ(stats.num_shredding_columns(), 1);
+    ASSERT_NE(stats.GetShreddingField("/common", index::JSONType::INT64), "");
+    ASSERT_EQ(stats.GetShreddingField("/rare", index::JSONType::INT64), "");
+    std::vector<int64_t> first_window(10);
+    std::iota(first_window.begin(), first_window.end(), 0);
+    ASSERT_EQ(Sorted(stats.GetSharedRows("/common", 30)), first_window);
+    ASSERT_EQ(Sorted(stats.GetSharedRows("/rare", 30)),
+              (std::vector<int64_t>{0, 1, 10, 11, 20, 21}));
+
+    // the shared rows and the shredded values are accounted
+    ASSERT_EQ(size,
+              16 * sizeof(int64_t) + 20 * (sizeof(int64_t) + sizeof(bool)));
+    ASSERT_EQ(stats.AppendNull(30), sizeof(int64_t));
+}
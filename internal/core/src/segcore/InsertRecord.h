@@ -12,7 +12,10 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <functional>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
@@ -38,6 +41,8 @@ constexpr int64_t NoLimit = 0;
 // If `bitset_count * 100` > `total_count * BruteForceSelectivity`, we use pk index.
 // Otherwise, we use bruteforce to retrieve all the pks and then sort them.
 constexpr int64_t BruteForceSelectivity = 10;
+// Number of pks buffered unsorted before the growing pk index sorts them into a run.
+constexpr int64_t GrowingPkIndexDeltaCapacity = 1024;
 
 using Condition = std::function<bool(int64_t)>;
 
@@ -244,6 +249,426 @@ class OffsetOrderedMap : public OffsetMap {
     mutable std::shared_mutex mtx_;
 };
 
+// OffsetOrderedRuns is the pk index of growing segments.
+// New (pk, offset) pairs are appended to a fixed-capacity delta, a full delta
+// is sorted into an immutable run, and runs are merged so that their sizes
+// shrink geometrically, which keeps the number of runs logarithmic. Runs are
+// merged by a compaction step after the insert that filled the delta, out of
+// the write lock, so concurrent inserts never wait for a merge.
+// Every change publishes a new snapshot, readers only load the current
+// snapshot and never wait for writers.
+template <typename T>
+class OffsetOrderedRuns : public OffsetMap {
+ public:
+    using Entry = std::pair<T, int64_t>;
+    using Run = std::vector<Entry>;
+
+    explicit OffsetOrderedRuns(
+        int64_t delta_capacity = GrowingPkIndexDeltaCapacity)
+        : delta_capacity_(delta_capacity) {
+        AssertInfo(delta_capacity_ > 0,
+                   "delta capacity of pk index must be positive");
+        publish({}, std::make_shared<Delta>(delta_capacity_));
+    }
+
+    bool
+    contain(const PkType& pk) const override {
+        const T& target = std::get<T>(pk);
+        auto snapshot = load();
+        for (auto& run : snapshot->runs) {
+            auto it =
+                std::lower_bound(run->begin(), run->end(), target, KeyLess{});
+            if (it != run->end() && it->first == target) {
+                return true;
+            }
+        }
+        auto& delta = *snapshot->delta;
+        auto count = delta.count.load(std::memory_order_acquire);
+        for (int64_t i = 0; i < count; ++i) {
+            if (delta.entries[i].first == target) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::vector<int64_t>
+    find(const PkType& pk) const override {
+        std::vector<int64_t> offsets;
+        for_each_in_range(
+            load(),
+            std::get<T>(pk),
+            proto::plan::OpType::Equal,
+            [&offsets](int64_t offset) { offsets.push_back(offset); });
+        // keep the insertion order as the ordered map did
+        std::sort(offsets.begin(), offsets.end());
+        return offsets;
+    }
+
+    void
+    find_range(const PkType& pk,
+               proto::plan::OpType op,
+               BitsetTypeView& bitset,
+               Condition condition) const override {
+        for_each_in_range(
+            load(), std::get<T>(pk), op, [&](int64_t offset) {
+                if (condition(offset) && offset < bitset.size()) {
+                    bitset[offset] = true;
+                }
+            });
+    }
+
+    void
+    insert(const PkType& pk, int64_t offset) override {
+        {
+            std::lock_guard<std::mutex> lck(write_mtx_);
+            // only writers replace the snapshot, it is stable under
+            // write_mtx_
+            auto snapshot = load();
+            auto& delta = *snapshot->delta;
+            auto count = delta.count.load(std::memory_order_relaxed);
+            delta.entries[count] = Entry(std::get<T>(pk), offset);
+            delta.count.store(count + 1, std::memory_order_release);
+            if (count + 1 < delta_capacity_) {
+                return;
+            }
+            flush(*snapshot);
+        }
+        compact();
+    }
+
+    void
+    seal() override {
+        ThrowInfo(
+            NotImplemented,
+            "OffsetOrderedRuns used for growing segment could not be sealed.");
+    }
+
+    bool
+    empty() const override {
+        auto snapshot = load();
+        return snapshot->runs.empty() &&
+               snapshot->delta->count.load(std::memory_order_acquire) == 0;
+    }
+
+    std::pair<std::vector<OffsetMap::OffsetType>, bool>
+    find_first(int64_t limit, const BitsetType& bitset) const override {
+        auto snapshot = load();
+        auto runs = snapshot->runs;
+        auto& delta = *snapshot->delta;
+        auto count = delta.count.load(std::memory_order_acquire);
+        if (count > 0) {
+            runs.push_back(sorted_delta(delta, count));
+        }
+
+        if (limit == Unlimited || limit == NoLimit) {
+            limit = 0;
+            for (auto& run : runs) {
+                limit += run->size();
+            }
+        }
+
+        return find_first_by_index(limit, bitset, runs);
+    }
+
+    void
+    clear() override {
+        std::lock_guard<std::mutex> lck(write_mtx_);
+        publish({}, std::make_shared<Delta>(delta_capacity_));
+    }
+
+    size_t
+    size() const override {
+        return memory_size_.load(std::memory_order_relaxed);
+    }
+
+ private:
+    struct Delta {
+        explicit Delta(int64_t capacity) : entries(capacity) {
+        }
+        std::vector<Entry> entries;
+        // entries before count are fully written and visible to readers
+        std::atomic<int64_t> count{0};
+        // sorted copy of a prefix of the entries, extended on demand so that
+        // repeated reads do not sort the whole delta again
+        std::mutex sorted_mtx;
+        std::shared_ptr<const Run> sorted;
+    };
+
+    struct Snapshot {
+        std::vector<std::shared_ptr<const Run>> runs;
+        std::shared_ptr<Delta> delta;
+    };
+
+    struct KeyLess {
+        bool
+        operator()(const Entry& elem, const T& value) const {
+            return elem.first < value;
+        }
+        bool
+        operator()(const T& value, const Entry& elem) const {
+            return value < elem.first;
+        }
+    };
+
+    std::shared_ptr<const Snapshot>
+    load() const {
+        return std::atomic_load(&snapshot_);
+    }
+
+    void
+    publish(std::vector<std::shared_ptr<const Run>> runs,
+            std::shared_ptr<Delta> delta) {
+        // the delta and its sorted copy
+        size_t memory_size = 2 * delta->entries.capacity() * sizeof(Entry);
+        for (auto& run : runs) {
+            memory_size += run->capacity() * sizeof(Entry);
+        }
+        std::atomic_store(&snapshot_,
+                          std::shared_ptr<const Snapshot>(new Snapshot{
+                              std::move(runs), std::move(delta)}));
+        memory_size_.store(memory_size, std::memory_order_relaxed);
+    }
+
+    // returns the first count entries of delta sorted, readers of older
+    // snapshots may still scan the delta, so it is copied
+    static std::shared_ptr<const Run>
+    sorted_delta(Delta& delta, int64_t count) {
+        std::lock_guard<std::mutex> lck(delta.sorted_mtx);
+        auto sorted = delta.sorted;
+        int64_t sorted_count = sorted == nullptr ? 0 : sorted->size();
+        // a longer copy only holds more visible entries
+        if (sorted_count >= count) {
+            return sorted;
+        }
+        Run tail(delta.entries.begin() + sorted_count,
+                 delta.entries.begin() + count);
+        std::sort(tail.begin(), tail.end());
+        auto merged = std::make_shared<Run>();
+        if (sorted == nullptr) {
+            *merged = std::move(tail);
+        } else {
+            merged->reserve(count);
+            std::merge(sorted->begin(),
+                       sorted->end(),
+                       tail.begin(),
+                       tail.end(),
+                       std::back_inserter(*merged));
+        }
+        delta.sorted = merged;
+        return merged;
+    }
+
+    // turns the full delta into a run, the caller holds write_mtx_
+    void
+    flush(const Snapshot& snapshot) {
+        auto& delta = *snapshot.delta;
+        auto count = delta.count.load(std::memory_order_relaxed);
+        auto runs = snapshot.runs;
+        runs.push_back(sorted_delta(delta, count));
+        publish(std::move(runs), std::make_shared<Delta>(delta_capacity_));
+    }
+
+    // Merges the trailing runs until their sizes shrink geometrically again.
+    // The merge runs out of write_mtx_ on immutable runs, the result replaces
+    // them only if no clear happened meanwhile. At most one writer compacts,
+    // a run flushed while it finishes is merged after the next flush.
+    void
+    compact() {
+        std::unique_lock<std::mutex> compact_lck(compact_mtx_,
+                                                 std::try_to_lock);
+        if (!compact_lck.owns_lock()) {
+            return;
+        }
+        while (true) {
+            auto runs = load()->runs;
+            if (runs.size() < 2) {
+                return;
+            }
+            auto end = runs.size();
+            auto begin = end - 1;
+            size_t merged_size = runs.back()->size();
+            while (begin > 0 && runs[begin - 1]->size() <= 2 * merged_size) {
+                --begin;
+                merged_size += runs[begin]->size();
+            }
+            if (end - begin < 2) {
+                return;
+            }
+
+            auto merged = runs.back();
+            for (auto i = end - 1; i > begin; --i) {
+                auto& left = *runs[i - 1];
+                auto next = std::make_shared<Run>();
+                next->reserve(left.size() + merged->size());
+                std::merge(left.begin(),
+                           left.end(),
+                           merged->begin(),
+                           merged->end(),
+                           std::back_inserter(*next));
+                merged = std::move(next);
+            }
+
+            std::lock_guard<std::mutex> lck(write_mtx_);
+            // writers only append runs, the merged ones keep their place
+            // unless the index was cleared
+            auto snapshot = load();
+            auto& current = snapshot->runs;
+            if (current.size() < end ||
+                !std::equal(runs.begin() + begin,
+                            runs.begin() + end,
+                            current.begin() + begin)) {
+                return;
+            }
+            std::vector<std::shared_ptr<const Run>> compacted(
+                current.begin(), current.begin() + begin);
+            compacted.push_back(std::move(merged));
+            compacted.insert(
+                compacted.end(), current.begin() + end, current.end());
+            publish(std::move(compacted), snapshot->delta);
+        }
+    }
+
+    template <typename Func>
+    static void
+    for_each_in_range(const std::shared_ptr<const Snapshot>& snapshot,
+                      const T& target,
+                      proto::plan::OpType op,
+                      Func&& func) {
+        switch (op) {
+            case proto::plan::OpType::Equal:
+            case proto::plan::OpType::GreaterEqual:
+            case proto::plan::OpType::GreaterThan:
+            case proto::plan::OpType::LessEqual:
+            case proto::plan::OpType::LessThan:
+                break;
+            default:
+                ThrowInfo(ErrorCode::Unsupported,
+                          fmt::format("unsupported op type {}", op));
+        }
+
+        for (auto& run : snapshot->runs) {
+            auto begin = run->begin();
+            auto end = run->end();
+            switch (op) {
+                case proto::plan::OpType::Equal:
+                    begin = std::lower_bound(begin, end, target, KeyLess{});
+                    end = std::upper_bound(begin, end, target, KeyLess{});
+                    break;
+                case proto::plan::OpType::GreaterEqual:
+                    begin = std::lower_bound(begin, end, target, KeyLess{});
+                    break;
+                case proto::plan::OpType::GreaterThan:
+                    begin = std::upper_bound(begin, end, target, KeyLess{});
+                    break;
+                case proto::plan::OpType::LessEqual:
+                    end = std::upper_bound(begin, end, target, KeyLess{});
+                    break;
+                default:
+                    end = std::lower_bound(begin, end, target, KeyLess{});
+                    break;
+            }
+            for (auto it = begin; it != end; ++it) {
+                func(it->second);
+            }
+        }
+
+        auto& delta = *snapshot->delta;
+        auto count = delta.count.load(std::memory_order_acquire);
+        for (int64_t i = 0; i < count; ++i) {
+            if (in_range(delta.entries[i].first, target, op)) {
+                func(delta.entries[i].second);
+            }
+        }
+    }
+
+    static bool
+    in_range(const T& key, const T& target, proto::plan::OpType op) {
+        switch (op) {
+            case proto::plan::OpType::Equal:
+                return key == target;
+            case proto::plan::OpType::GreaterEqual:
+                return !(key < target);
+            case proto::plan::OpType::GreaterThan:
+                return target < key;
+            case proto::plan::OpType::LessEqual:
+                return !(target < key);
+            default:
+                return key < target;
+        }
+    }
+
+    std::pair<std::vector<OffsetMap::OffsetType>, bool>
+    find_first_by_index(
+        int64_t limit,
+        const BitsetType& bitset,
+        const std::vector<std::shared_ptr<const Run>>& runs) const {
+        int64_t hit_num = 0;  // avoid counting the number everytime.
+        auto size = bitset.size();
+        int64_t cnt = size - bitset.count();
+        limit = std::min(limit, cnt);
+        std::vector<int64_t> seg_offsets;
+        seg_offsets.reserve(limit);
+
+        using Cursor = std::pair<typename Run::const_iterator,
+                                 typename Run::const_iterator>;
+        std::vector<Cursor> cursors;
+        cursors.reserve(runs.size());
+        for (auto& run : runs) {
+            cursors.emplace_back(run->begin(), run->end());
+        }
+        // the number of runs is logarithmic, a linear pick of the
+        // smallest head is cheaper than maintaining a heap
+        while (hit_num < limit) {
+            const T* min_key = nullptr;
+            for (auto& [it, end] : cursors) {
+                if (it != end && (min_key == nullptr || it->first < *min_key)) {
+                    min_key = &it->first;
+                }
+            }
+            if (min_key == nullptr) {
+                break;
+            }
+            // runs are immutable, min_key stays valid while cursors move
+            int64_t latest_offset = -1;
+            for (auto& [it, end] : cursors) {
+                for (; it != end && it->first == *min_key; ++it) {
+                    auto seg_offset = it->second;
+                    if (seg_offset >= size) {
+                        // Frequently concurrent insert/query will cause this case.
+                        continue;
+                    }
+                    // Offsets in the growing segment are ordered by timestamp,
+                    // keep the latest one that passes the filter.
+                    if (!bitset[seg_offset]) {
+                        latest_offset = std::max(latest_offset, seg_offset);
+                    }
+                }
+            }
+            if (latest_offset >= 0) {
+                seg_offsets.push_back(latest_offset);
+                hit_num++;
+            }
+        }
+
+        bool has_more = std::any_of(
+            cursors.begin(), cursors.end(), [](const Cursor& cursor) {
+                return cursor.first != cursor.second;
+            });
+        return {seg_offsets, has_more};
+    }
+
+ private:
+    const int64_t delta_capacity_;
+    // accessed with std::atomic_load/std::atomic_store only
+    std::shared_ptr<const Snapshot> snapshot_;
+    std::atomic<size_t> memory_size_{0};
+    // serializes writers, readers never take it
+    std::mutex write_mtx_;
+    // held by the writer merging runs, taken before write_mtx_
+    std::mutex compact_mtx_;
+};
+
 template <typename T>
 class OffsetOrderedArray : public OffsetMap {
  public:
@@ -625,7 +1050,7 @@ class InsertRecordGrowing {
         const Schema& schema,
         const int64_t size_per_chunk,
         const storage::MmapChunkDescriptorPtr mmap_descriptor = nullptr)
-        : timestamps_(size_per_chunk) {
+        : timestamps_(size_per_chunk), timestamp_index_(size_per_chunk) {
         std::optional<FieldId> pk_field_id = schema.get_primary_field_id();
         for (auto& field : schema) {
             auto field_id = field.first;
@@ -636,12 +1061,12 @@ class InsertRecordGrowing {
                 switch (field_meta.get_data_type()) {
                     case DataType::INT64: {
                         pk2offset_ =
-                            std::make_unique<OffsetOrderedMap<int64_t>>();
+                            std::make_unique<OffsetOrderedRuns<int64_t>>();
                         break;
                     }
                     case DataType::VARCHAR: {
                         pk2offset_ =
-                            std::make_unique<OffsetOrderedMap<std::string>>();
+                            std::make_unique<OffsetOrderedRuns<std::string>>();
                         break;
                     }
                     default: {
@@ -665,7 +1090,7 @@ class InsertRecordGrowing {
     search_pk(const PkType& pk,
               Timestamp timestamp,
               bool include_same_ts = true) const {
-        std::shared_lock<std::shared_mutex> lck(shared_mutex_);
+        // pk2offset_ serves concurrent readers without locking
         std::vector<SegOffset> res_offsets;
         auto offset_iter = pk2offset_->find(pk);
         auto timestamp_hit =
@@ -736,7 +1161,6 @@ class InsertRecordGrowing {
 
     bool
     empty_pks() const {
-        std::shared_lock lck(shared_mutex_);
         return pk2offset_->empty();
     }
 
@@ -752,10 +1176,28 @@ class InsertRecordGrowing {
         return timestamps_;
     }
 
+    void
+    insert_timestamps(int64_t offset,
+                      const Timestamp* timestamps,
+                      int64_t size) {
+        timestamps_.set_data_raw(offset, timestamps, size);
+        timestamp_index_.update(offset, timestamps, size);
+    }
+
+    void
+    insert_timestamps(int64_t offset, const std::vector<FieldDataPtr>& datas) {
+        for (auto& data : datas) {
+            auto num_rows = data->get_num_rows();
+            insert_timestamps(
+                offset, static_cast<const Timestamp*>(data->Data()), num_rows);
+            offset += num_rows;
+        }
+    }
+
     void
     clear() {
         timestamps_.clear();
-        timestamp_index_ = TimestampIndex();
+        timestamp_index_.clear();
         if (pk2offset_) {
             pk2offset_->clear();
         }
@@ -771,7 +1213,7 @@ class InsertRecordGrowing {
         int64_t size_per_chunk,
         const storage::MmapChunkDescriptorPtr mmap_descriptor = nullptr) {
         if (field_meta.is_nullable()) {
-            this->append_valid_data(field_id);
+            this->append_valid_data(field_id, size_per_chunk);
         }
         const milvus::storage::MmapConfig mmap_config =
             storage::MmapManager::GetInstance().GetMmapConfig();
@@ -925,6 +1367,14 @@ class InsertRecordGrowing {
         pk2offset_->insert(pk, offset);
     }
 
+    void
+    insert_pks(const std::vector<PkType>& pks, int64_t start_offset) {
+        std::lock_guard lck(shared_mutex_);
+        for (size_t i = 0; i < pks.size(); ++i) {
+            pk2offset_->insert(pks[i], start_offset + i);
+        }
+    }
+
     // get data without knowing the type
     VectorBase*
     get_data_base(FieldId field_id) const {
@@ -993,8 +1443,9 @@ class InsertRecordGrowing {
 
     // append a column of scalar type
     void
-    append_valid_data(FieldId field_id) {
-        valid_data_.emplace(field_id, std::make_shared<ThreadSafeValidData>());
+    append_valid_data(FieldId field_id, int64_t size_per_chunk) {
+        valid_data_.emplace(
+            field_id, std::make_shared<ThreadSafeValidData>(size_per_chunk));
     }
 
     // append a column of vector type
@@ -1046,7 +1497,7 @@ class InsertRecordGrowing {
  public:
     ConcurrentVector<Timestamp> timestamps_;
     std::atomic<int64_t> reserved = 0;
-    TimestampIndex timestamp_index_;
+    GrowingTimestampIndex timestamp_index_;
     std::unique_ptr<OffsetMap> pk2offset_;
 
     // used for preInsert of growing segment
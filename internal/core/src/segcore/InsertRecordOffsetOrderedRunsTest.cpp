@@ -0,0 +1,204 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+#include "segcore/InsertRecord.h"
+
+using namespace milvus;
+using namespace milvus::segcore;
+
+template <typename T>
+class TypedOffsetOrderedRunsTest : public testing::Test {
+ public:
+    void
+    SetUp() override {
+        er = std::default_random_engine(42);
+    }
+
+    void
+    TearDown() override {
+    }
+
+ protected:
+    void
+    insert(T pk) {
+        runs_.insert(pk, offset_);
+        map_.insert(pk, offset_);
+        offset_++;
+    }
+
+    T
+    random_pk(int domain) {
+        if constexpr (std::is_same_v<std::string, T>) {
+            return std::to_string(er() % domain);
+        } else {
+            return static_cast<T>(er() % domain);
+        }
+    }
+
+ protected:
+    int64_t offset_ = 0;
+    // small delta capacity to exercise flush and merge of runs
+    milvus::segcore::OffsetOrderedRuns<T> runs_{8};
+    // reference implementation
+    milvus::segcore::OffsetOrderedMap<T> map_;
+    std::default_random_engine er;
+};
+
+using TypeOfPks = testing::Types<int64_t, std::string>;
+TYPED_TEST_SUITE_P(TypedOffsetOrderedRunsTest);
+
+TYPED_TEST_P(TypedOffsetOrderedRunsTest, same_as_ordered_map) {
+    {
+        auto [offsets, has_more_res] = this->runs_.find_first(Unlimited, {});
+        ASSERT_EQ(0, offsets.size());
+        ASSERT_FALSE(has_more_res);
+        ASSERT_TRUE(this->runs_.empty());
+    }
+
+    // duplicated pks spread across delta and several runs
+    int num = 1000;
+    int domain = 300;
+    for (int i = 0; i < num; i++) {
+        this->insert(this->random_pk(domain));
+    }
+    ASSERT_FALSE(this->runs_.empty());
+
+    std::vector<proto::plan::OpType> ops = {proto::plan::OpType::Equal,
+                                            proto::plan::OpType::GreaterThan,
+                                            proto::plan::OpType::GreaterEqual,
+                                            proto::plan::OpType::LessThan,
+                                            proto::plan::OpType::LessEqual};
+    for (int i = 0; i < 50; i++) {
+        auto pk = this->random_pk(domain);
+        ASSERT_EQ(this->map_.contain(pk), this->runs_.contain(pk));
+        ASSERT_EQ(this->map_.find(pk), this->runs_.find(pk));
+        for (auto op : ops) {
+            BitsetType expected(num);
+            BitsetType actual(num);
+            BitsetTypeView expected_view(expected);
+            BitsetTypeView actual_view(actual);
+            auto condition = [](int64_t offset) { return offset % 2 == 0; };
+            this->map_.find_range(pk, op, expected_view, condition);
+            this->runs_.find_range(pk, op, actual_view, condition);
+            for (int j = 0; j < num; j++) {
+                ASSERT_EQ(expected[j], actual[j]);
+            }
+        }
+    }
+
+    BitsetType filtered(num);
+    for (int i = 0; i < num; i += 3) {
+        filtered[i] = true;
+    }
+    for (int64_t limit : {Unlimited, NoLimit, int64_t(10), int64_t(100)}) {
+        auto expected = this->map_.find_first(limit, filtered);
+        auto actual = this->runs_.find_first(limit, filtered);
+        ASSERT_EQ(expected.first, actual.first);
+        ASSERT_EQ(expected.second, actual.second);
+    }
+
+    // corner case, segment offset exceeds the size of bitset.
+    BitsetType all_minus_1(num - 1);
+    all_minus_1.reset();
+    {
+        auto expected = this->map_.find_first(Unlimited, all_minus_1);
+        auto actual = this->runs_.find_first(Unlimited, all_minus_1);
+        ASSERT_EQ(expected.first, actual.first);
+        ASSERT_EQ(expected.second, actual.second);
+    }
+
+    this->runs_.clear();
+    ASSERT_TRUE(this->runs_.empty());
+}
+
+TYPED_TEST_P(TypedOffsetOrderedRunsTest, concurrent_read_write) {
+    int num = 100000;
+    BitsetType all(num);
+    all.reset();
+    std::atomic<bool> stop{false};
+    std::thread writer([&]() {
+        for (int i = 0; i < num; i++) {
+            if constexpr (std::is_same_v<std::string, TypeParam>) {
+                this->runs_.insert(std::to_string(i), i);
+            } else {
+                this->runs_.insert(static_cast<TypeParam>(i), i);
+            }
+        }
+        stop.store(true);
+    });
+    while (!stop.load()) {
+        // readers only observe fully written entries
+        auto visible = this->runs_.find_first(Unlimited, all);
+        for (auto offset : visible.first) {
+            EXPECT_LT(offset, num);
+        }
+    }
+    writer.join();
+
+    auto [offsets, has_more_res] = this->runs_.find_first(Unlimited, all);
+    ASSERT_EQ(num, offsets.size());
+    ASSERT_FALSE(has_more_res);
+}
+
+TYPED_TEST_P(TypedOffsetOrderedRunsTest, concurrent_writers) {
+    // writers flush deltas and compact runs concurrently
+    int num_writers = 4;
+    int num_per_writer = 5000;
+    int num = num_writers * num_per_writer;
+    std::vector<std::thread> writers;
+    for (int w = 0; w < num_writers; w++) {
+        writers.emplace_back([&, w]() {
+            for (int i = w; i < num; i += num_writers) {
+                if constexpr (std::is_same_v<std::string, TypeParam>) {
+                    this->runs_.insert(std::to_string(i % 1000), i);
+                } else {
+                    this->runs_.insert(static_cast<TypeParam>(i % 1000), i);
+                }
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+
+    for (int pk = 0; pk < 1000; pk++) {
+        std::vector<int64_t> expected;
+        for (int i = pk; i < num; i += 1000) {
+            expected.push_back(i);
+        }
+        if constexpr (std::is_same_v<std::string, TypeParam>) {
+            ASSERT_EQ(expected, this->runs_.find(std::to_string(pk)));
+        } else {
+            ASSERT_EQ(expected,
+                      this->runs_.find(static_cast<TypeParam>(pk)));
+        }
+    }
+    // the runs and the delta are accounted
+    ASSERT_GE(this->runs_.size(),
+              num * sizeof(std::pair<TypeParam, int64_t>));
+
+    BitsetType all(num);
+    all.reset();
+    auto [offsets, has_more_res] = this->runs_.find_first(Unlimited, all);
+    ASSERT_EQ(1000, offsets.size());
+    ASSERT_FALSE(has_more_res);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TypedOffsetOrderedRunsTest,
+                            same_as_ordered_map,
+                            concurrent_read_write,
+                            concurrent_writers);
+INSTANTIATE_TYPED_TEST_SUITE_P(Prefix, TypedOffsetOrderedRunsTest, TypeOfPks);
@@ -11,8 +11,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <limits>
 #include <utility>
+#include <vector>
 
 #include "common/Consts.h"
 #include "common/Types.h"
@@ -87,3 +89,150 @@ struct SearchResultPairComparator {
         return *rhs > *lhs;
     }
 };
+
+// Loser tree over the cursors of one nq, one leaf per segment. The per
+// segment topk lists are already sorted, so after the best entry is taken
+// and its cursor advanced, replaying the path from that leaf to the root
+// costs log(k) comparisons, one per level, instead of the two per level a
+// binary heap needs to sift down. Equal entries are taken from the segment
+// with the smaller index first.
+class SearchResultLoserTree {
+ public:
+    void
+    Reset(std::vector<SearchResultPair>* pairs) {
+        pairs_ = pairs;
+        leaves_ = 1;
+        while (leaves_ < pairs_->size()) {
+            leaves_ <<= 1;
+        }
+        // node i has children 2i and 2i+1, leaf j is node leaves_ + j
+        winners_.resize(2 * leaves_);
+        losers_.resize(leaves_);
+        for (size_t i = 0; i < leaves_; i++) {
+            winners_[leaves_ + i] = i;
+        }
+        for (size_t node = leaves_ - 1; node > 0; node--) {
+            auto left = winners_[2 * node];
+            auto right = winners_[2 * node + 1];
+            if (Beats(right, left)) {
+                winners_[node] = right;
+                losers_[node] = left;
+            } else {
+                winners_[node] = left;
+                losers_[node] = right;
+            }
+        }
+        losers_[0] = winners_[1];
+    }
+
+    // the best entry, nullptr if all cursors are exhausted
+    SearchResultPair*
+    Top() const {
+        auto winner = losers_[0];
+        return Exhausted(winner) ? nullptr : &(*pairs_)[winner];
+    }
+
+    // call after the pair returned by Top() was advanced
+    void
+    Replay() {
+        auto winner = losers_[0];
+        for (auto node = (leaves_ + winner) / 2; node > 0; node /= 2) {
+            if (Beats(losers_[node], winner)) {
+                std::swap(losers_[node], winner);
+            }
+        }
+        losers_[0] = winner;
+    }
+
+ private:
+    bool
+    Exhausted(size_t i) const {
+        return i >= pairs_->size() ||
+               (*pairs_)[i].offset_ >= (*pairs_)[i].offset_rb_;
+    }
+
+    bool
+    Beats(size_t a, size_t b) const {
+        if (Exhausted(a)) {
+            return false;
+        }
+        if (Exhausted(b)) {
+            return true;
+        }
+        const auto& lhs = (*pairs_)[a];
+        const auto& rhs = (*pairs_)[b];
+        if (lhs > rhs) {
+            return true;
+        }
+        return !(rhs > lhs) && a < b;
+    }
+
+ private:
+    std::vector<SearchResultPair>* pairs_ = nullptr;
+    size_t leaves_ = 1;
+    // losers_[0] holds the overall winner
+    std::vector<size_t> losers_;
+    std::vector<size_t> winners_;
+};
+
+// Open addressing set of primary keys for dropping duplicates while merging
+// one nq. Slots are stamped with a generation, so Clear() does not touch the
+// table and it is reused across nqs. Keys are borrowed and must stay alive
+// until the next Clear().
+class PkDedupSet {
+ public:
+    // at most max_size keys are inserted until the next Clear()
+    void
+    Clear(size_t max_size) {
+        size_t capacity = 16;
+        while (capacity < max_size * 2) {
+            capacity <<= 1;
+        }
+        if (capacity > slots_.size()) {
+            slots_.assign(capacity, Slot{});
+            generation_ = 0;
+        }
+        mask_ = slots_.size() - 1;
+        if (++generation_ == 0) {
+            std::fill(slots_.begin(), slots_.end(), Slot{});
+            generation_ = 1;
+        }
+    }
+
+    // returns false if pk is already in the set
+    bool
+    Insert(const milvus::PkType& pk) {
+        for (auto i = Hash(pk) & mask_;; i = (i + 1) & mask_) {
+            auto& slot = slots_[i];
+            if (slot.generation != generation_) {
+                slot.pk = &pk;
+                slot.generation = generation_;
+                return true;
+            }
+            if (*slot.pk == pk) {
+                return false;
+            }
+        }
+    }
+
+ private:
+    static size_t
+    Hash(const milvus::PkType& pk) {
+        uint64_t h;
+        if (auto int_pk = std::get_if<int64_t>(&pk)) {
+            h = static_cast<uint64_t>(*int_pk);
+        } else {
+            h = std::hash<milvus::PkType>{}(pk);
+        }
+        return static_cast<size_t>((h * 0x9E3779B97F4A7C15ULL) >> 32);
+    }
+
+    struct Slot {
+        const milvus::PkType* pk = nullptr;
+        uint32_t generation = 0;
+    };
+
+    std::vector<Slot> slots_;
+    size_t mask_ = 0;
+    uint32_t generation_ = 0;
+};
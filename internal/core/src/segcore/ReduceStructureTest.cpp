@@ -10,6 +10,9 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
 #include <gtest/gtest.h>
+#include <numeric>
+#include <queue>
+#include <random>
 
 #include "common/Consts.h"
 #include "segcore/ReduceStructure.h"
@@ -33,3 +36,111 @@ TEST(SearchResultPair, SameDistance) {
     ASSERT_EQ(pair2 > pair1, true);
     ASSERT_EQ(pair1.primary_key_, INVALID_PK);
 }
+
+TEST(SearchResultLoserTree, SameAsHeap) {
+    std::default_random_engine er(42);
+    for (int num_segments : {1, 2, 3, 7, 16}) {
+        std::vector<SearchResult> results(num_segments);
+        for (auto& result : results) {
+            auto size = er() % 20;
+            for (int i = 0; i < size; i++) {
+                // few distinct distances to exercise ties on pk
+                result.distances_.push_back(static_cast<float>(er() % 8));
+                result.primary_keys_.push_back(int64_t(er() % 50));
+            }
+            std::vector<int> order(size);
+            std::iota(order.begin(), order.end(), 0);
+            std::sort(order.begin(), order.end(), [&](int a, int b) {
+                return SearchResultPair(result.primary_keys_[a],
+                                        result.distances_[a],
+                                        nullptr,
+                                        0,
+                                        0,
+                                        1) >
+                       SearchResultPair(result.primary_keys_[b],
+                                        result.distances_[b],
+                                        nullptr,
+                                        0,
+                                        0,
+                                        1);
+            });
+            auto distances = result.distances_;
+            auto pks = result.primary_keys_;
+            for (int i = 0; i < size; i++) {
+                result.distances_[i] = distances[order[i]];
+                result.primary_keys_[i] = pks[order[i]];
+            }
+        }
+
+        std::vector<SearchResultPair> heap_pairs;
+        std::vector<SearchResultPair> tree_pairs;
+        for (int i = 0; i < num_segments; i++) {
+            auto& result = results[i];
+            if (result.distances_.empty()) {
+                continue;
+            }
+            heap_pairs.emplace_back(result.primary_keys_[0],
+                                    result.distances_[0],
+                                    &result,
+                                    i,
+                                    0,
+                                    result.distances_.size());
+            tree_pairs.push_back(heap_pairs.back());
+        }
+
+        std::priority_queue<SearchResultPair*,
+                            std::vector<SearchResultPair*>,
+                            SearchResultPairComparator>
+            heap;
+        for (auto& pair : heap_pairs) {
+            heap.push(&pair);
+        }
+        SearchResultLoserTree tree;
+        tree.Reset(&tree_pairs);
+        while (!heap.empty()) {
+            auto expected = heap.top();
+            heap.pop();
+            auto actual = tree.Top();
+            ASSERT_NE(actual, nullptr);
+            ASSERT_EQ(expected->distance_, actual->distance_);
+            ASSERT_EQ(expected->primary_key_, actual->primary_key_);
+            expected->advance();
+            if (expected->primary_key_ != INVALID_PK) {
+                heap.push(expected);
+            }
+            actual->advance();
+            tree.Replay();
+        }
+        ASSERT_EQ(tree.Top(), nullptr);
+    }
+}
+
+TEST(PkDedupSet, Insert) {
+    PkDedupSet set;
+    std::vector<milvus::PkType> pks;
+    for (int64_t i = 0; i < 100; i++) {
+        pks.emplace_back(i * 1024);
+        pks.emplace_back("pk_" + std::to_string(i));
+    }
+    for (int round = 0; round < 3; round++) {
+        set.Clear(pks.size());
+        for (auto& pk : pks) {
+            ASSERT_TRUE(set.Insert(pk));
+        }
+        for (auto& pk : pks) {
+            auto copy = pk;
+            ASSERT_FALSE(set.Insert(copy));
+        }
+    }
+
+    // a cleared set grows when more keys are expected
+    std::vector<milvus::PkType> more;
+    for (int64_t i = 0; i < 1000; i++) {
+        more.emplace_back(i);
+    }
+    set.Clear(more.size());
+    for (auto& pk : more) {
+        ASSERT_TRUE(set.Insert(pk));
+    }
+    ASSERT_FALSE(set.Insert(more[10]));
+}
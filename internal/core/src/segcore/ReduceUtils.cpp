@@ -14,9 +14,12 @@
 //
 
 #include "ReduceUtils.h"
+#include "google/protobuf/io/coded_stream.h"
 #include "google/protobuf/repeated_field.h"
 #include "pb/schema.pb.h"
 
+#include <cstring>
+
 namespace milvus::segcore {
 
 void
@@ -307,4 +310,176 @@ AssembleGroupByValues(
     }
 }
 
-}  // namespace milvus::segcore
\ No newline at end of file
+namespace {
+using google::protobuf::io::CodedOutputStream;
+using SearchResultData = milvus::proto::schema::SearchResultData;
+
+constexpr uint32_t kWireTypeVarint = 0;
+constexpr uint32_t kWireTypeLengthDelimited = 2;
+
+constexpr uint32_t
+MakeTag(int field_number, uint32_t wire_type) {
+    return (static_cast<uint32_t>(field_number) << 3) | wire_type;
+}
+
+size_t
+TagSize(int field_number) {
+    return CodedOutputStream::VarintSize32(
+        MakeTag(field_number, kWireTypeVarint));
+}
+
+// size of a length delimited field holding `size` bytes
+size_t
+LengthDelimitedSize(int field_number, size_t size) {
+    return TagSize(field_number) + CodedOutputStream::VarintSize64(size) +
+           size;
+}
+
+size_t
+VarintFieldSize(int field_number, int64_t value) {
+    // proto3 does not marshal default values
+    return value == 0 ? 0
+                      : TagSize(field_number) +
+                            CodedOutputStream::VarintSize64(value);
+}
+
+size_t
+PackedVarintsSize(const std::vector<int64_t>& values) {
+    size_t size = 0;
+    for (auto value : values) {
+        size += CodedOutputStream::VarintSize64(value);
+    }
+    return size;
+}
+
+uint8_t*
+WriteLengthDelimitedHeader(int field_number, size_t size, uint8_t* target) {
+    target = CodedOutputStream::WriteTagToArray(
+        MakeTag(field_number, kWireTypeLengthDelimited), target);
+    return CodedOutputStream::WriteVarint64ToArray(size, target);
+}
+
+uint8_t*
+WriteVarintField(int field_number, int64_t value, uint8_t* target) {
+    if (value == 0) {
+        return target;
+    }
+    target = CodedOutputStream::WriteTagToArray(
+        MakeTag(field_number, kWireTypeVarint), target);
+    return CodedOutputStream::WriteVarint64ToArray(value, target);
+}
+
+uint8_t*
+WritePackedVarints(int field_number,
+                   const std::vector<int64_t>& values,
+                   size_t size,
+                   uint8_t* target) {
+    if (values.empty()) {
+        return target;
+    }
+    target = WriteLengthDelimitedHeader(field_number, size, target);
+    for (auto value : values) {
+        target = CodedOutputStream::WriteVarint64ToArray(value, target);
+    }
+    return target;
+}
+}  // namespace
+
+size_t
+SearchResultDataSlice::ByteSize() {
+    if (str_pk) {
+        id_array_size_ = 0;
+        for (auto id : str_ids) {
+            id_array_size_ += LengthDelimitedSize(
+                milvus::proto::schema::StringArray::kDataFieldNumber,
+                id->size());
+        }
+        ids_size_ = LengthDelimitedSize(
+            milvus::proto::schema::IDs::kStrIdFieldNumber, id_array_size_);
+    } else {
+        int_ids_size_ = PackedVarintsSize(int_ids);
+        id_array_size_ =
+            int_ids.empty()
+                ? 0
+                : LengthDelimitedSize(
+                      milvus::proto::schema::LongArray::kDataFieldNumber,
+                      int_ids_size_);
+        ids_size_ = LengthDelimitedSize(
+            milvus::proto::schema::IDs::kIntIdFieldNumber, id_array_size_);
+    }
+    topks_size_ = PackedVarintsSize(topks);
+
+    size_t size = 0;
+    size += VarintFieldSize(SearchResultData::kNumQueriesFieldNumber,
+                            num_queries);
+    size += VarintFieldSize(SearchResultData::kTopKFieldNumber, top_k);
+    if (!scores.empty()) {
+        size += LengthDelimitedSize(SearchResultData::kScoresFieldNumber,
+                                    scores.size() * sizeof(float));
+    }
+    size += LengthDelimitedSize(SearchResultData::kIdsFieldNumber, ids_size_);
+    if (!topks.empty()) {
+        size += LengthDelimitedSize(SearchResultData::kTopksFieldNumber,
+                                    topks_size_);
+    }
+    size += VarintFieldSize(SearchResultData::kAllSearchCountFieldNumber,
+                            all_search_count);
+    return size + others->ByteSizeLong();
+}
+
+uint8_t*
+SearchResultDataSlice::SerializeToArray(uint8_t* target) const {
+    static_assert(sizeof(float) == sizeof(uint32_t));
+    target = WriteVarintField(
+        SearchResultData::kNumQueriesFieldNumber, num_queries, target);
+    target =
+        WriteVarintField(SearchResultData::kTopKFieldNumber, top_k, target);
+    if (!scores.empty()) {
+        target =
+            WriteLengthDelimitedHeader(SearchResultData::kScoresFieldNumber,
+                                       scores.size() * sizeof(float),
+                                       target);
+        for (auto score : scores) {
+            uint32_t bits;
+            std::memcpy(&bits, &score, sizeof(bits));
+            target = CodedOutputStream::WriteLittleEndian32ToArray(bits, target);
+        }
+    }
+
+    target = WriteLengthDelimitedHeader(
+        SearchResultData::kIdsFieldNumber, ids_size_, target);
+    if (str_pk) {
+        target = WriteLengthDelimitedHeader(
+            milvus::proto::schema::IDs::kStrIdFieldNumber,
+            id_array_size_,
+            target);
+        for (auto id : str_ids) {
+            target = WriteLengthDelimitedHeader(
+                milvus::proto::schema::StringArray::kDataFieldNumber,
+                id->size(),
+                target);
+            target = CodedOutputStream::WriteRawToArray(
+                id->data(), id->size(), target);
+        }
+    } else {
+        target = WriteLengthDelimitedHeader(
+            milvus::proto::schema::IDs::kIntIdFieldNumber,
+            id_array_size_,
+            target);
+        target = WritePackedVarints(
+            milvus::proto::schema::LongArray::kDataFieldNumber,
+            int_ids,
+            int_ids_size_,
+            target);
+    }
+
+    target = WritePackedVarints(
+        SearchResultData::kTopksFieldNumber, topks, topks_size_, target);
+    target = WriteVarintField(SearchResultData::kAllSearchCountFieldNumber,
+                              all_search_count,
+                              target);
+    // fields are parsed in any order, the rest follows
+    return others->SerializeWithCachedSizesToArray(target);
+}
+
+}  // namespace milvus::segcore
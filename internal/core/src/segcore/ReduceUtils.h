@@ -11,12 +11,52 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "pb/schema.pb.h"
+#include "common/QueryResult.h"
 #include "common/Types.h"
 #include "query/PlanImpl.h"
 
 namespace milvus::segcore {
 
+// The `milvus::proto::schema::SearchResultData` of one slice, before it is
+// marshaled. Ids, scores and topks are kept as plain arrays in result order
+// and written in the wire format straight from them, so they are never
+// copied into repeated fields; all other fields come from `others`.
+struct SearchResultDataSlice {
+    int64_t num_queries = 0;
+    int64_t top_k = 0;
+    int64_t all_search_count = 0;
+    std::vector<int64_t> topks;
+    std::vector<float> scores;
+    // exactly one of them is used, depending on the pk type; string ids
+    // point into the reduced search results, which must outlive the slice
+    std::vector<int64_t> int_ids;
+    std::vector<const std::string*> str_ids;
+    bool str_pk = false;
+    std::unique_ptr<milvus::proto::schema::SearchResultData> others =
+        std::make_unique<milvus::proto::schema::SearchResultData>();
+    StorageCost cost;
+
+    // marshaled size, must be called before SerializeToArray()
+    size_t
+    ByteSize();
+
+    // writes ByteSize() bytes to target, returns the end of them
+    uint8_t*
+    SerializeToArray(uint8_t* target) const;
+
+ private:
+    // sizes of the nested messages and packed fields
+    size_t ids_size_ = 0;
+    size_t id_array_size_ = 0;
+    size_t int_ids_size_ = 0;
+    size_t topks_size_ = 0;
+};
+
 void
 AssembleGroupByValues(
     std::unique_ptr<milvus::proto::schema::SearchResultData>& search_result,
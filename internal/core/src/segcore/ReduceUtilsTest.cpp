@@ -0,0 +1,105 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <limits>
+
+#include "segcore/ReduceUtils.h"
+
+using namespace milvus;
+using namespace milvus::segcore;
+
+namespace {
+
+proto::schema::SearchResultData
+MarshalAndParse(SearchResultDataSlice& slice) {
+    auto size = slice.ByteSize();
+    std::vector<uint8_t> buffer(size);
+    auto end = slice.SerializeToArray(buffer.data());
+    EXPECT_EQ(buffer.data() + size, end);
+    proto::schema::SearchResultData data;
+    EXPECT_TRUE(data.ParseFromArray(buffer.data(), size));
+    return data;
+}
+
+}  // namespace
+
+TEST(SearchResultDataSlice, IntIds) {
+    SearchResultDataSlice slice;
+    slice.num_queries = 2;
+    slice.top_k = 3;
+    slice.all_search_count = 1000;
+    slice.topks = {3, 1};
+    slice.scores = {0.5, -1.25, 3, 0};
+    slice.int_ids = {1, -2, std::numeric_limits<int64_t>::max(), 0};
+    slice.others->add_output_fields("field");
+
+    auto data = MarshalAndParse(slice);
+    ASSERT_EQ(2, data.num_queries());
+    ASSERT_EQ(3, data.top_k());
+    ASSERT_EQ(1000, data.all_search_count());
+    ASSERT_EQ(slice.topks,
+              std::vector<int64_t>(data.topks().begin(), data.topks().end()));
+    ASSERT_EQ(slice.scores,
+              std::vector<float>(data.scores().begin(), data.scores().end()));
+    ASSERT_TRUE(data.ids().has_int_id());
+    ASSERT_EQ(slice.int_ids,
+              std::vector<int64_t>(data.ids().int_id().data().begin(),
+                                   data.ids().int_id().data().end()));
+    ASSERT_EQ(1, data.output_fields_size());
+    ASSERT_EQ("field", data.output_fields(0));
+
+    // same size as protobuf marshals it
+    proto::schema::SearchResultData expected;
+    expected.set_num_queries(2);
+    expected.set_top_k(3);
+    expected.set_all_search_count(1000);
+    expected.mutable_topks()->Add(slice.topks.begin(), slice.topks.end());
+    expected.mutable_scores()->Add(slice.scores.begin(), slice.scores.end());
+    expected.mutable_ids()->mutable_int_id()->mutable_data()->Add(
+        slice.int_ids.begin(), slice.int_ids.end());
+    expected.add_output_fields("field");
+    ASSERT_EQ(expected.ByteSizeLong(), slice.ByteSize());
+}
+
+TEST(SearchResultDataSlice, StrIds) {
+    std::vector<std::string> pks = {"a", "", std::string(300, 'x')};
+    SearchResultDataSlice slice;
+    slice.num_queries = 1;
+    slice.top_k = 3;
+    slice.topks = {3};
+    slice.scores = {3, 2, 1};
+    slice.str_pk = true;
+    for (auto& pk : pks) {
+        slice.str_ids.push_back(&pk);
+    }
+
+    auto data = MarshalAndParse(slice);
+    ASSERT_TRUE(data.ids().has_str_id());
+    ASSERT_EQ(pks,
+              std::vector<std::string>(data.ids().str_id().data().begin(),
+                                       data.ids().str_id().data().end()));
+    ASSERT_EQ(0, data.all_search_count());
+}
+
+TEST(SearchResultDataSlice, Empty) {
+    SearchResultDataSlice slice;
+    slice.num_queries = 1;
+    slice.top_k = 10;
+    slice.topks = {0};
+
+    auto data = MarshalAndParse(slice);
+    // ids are always set, even without results
+    ASSERT_TRUE(data.ids().has_int_id());
+    ASSERT_EQ(0, data.ids().int_id().data_size());
+    ASSERT_EQ(0, data.scores_size());
+    ASSERT_EQ(1, data.topks_size());
+}
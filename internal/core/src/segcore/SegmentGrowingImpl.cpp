@@ -66,6 +66,19 @@ SegmentGrowingImpl::mask_with_delete(BitsetTypeView& bitset,
     deleted_record_.Query(bitset, ins_barrier, timestamp);
 }
 
+DeleteProbe
+SegmentGrowingImpl::gather_deletes(Timestamp timestamp) const {
+    return deleted_record_.Gather(timestamp);
+}
+
+void
+SegmentGrowingImpl::mask_offsets_with_delete(BitsetTypeView& bitset,
+                                             const int32_t* offsets,
+                                             int64_t count,
+                                             const DeleteProbe& probe) const {
+    deleted_record_.Query(bitset, offsets, count, probe);
+}
+
 void
 SegmentGrowingImpl::try_remove_chunks(FieldId fieldId) {
     //remove the chunk data to reduce memory consumption
@@ -152,7 +165,7 @@ SegmentGrowingImpl::Insert(int64_t reserved_offset,
     // query node already guarantees that the timestamp is ordered, avoid field data copy in c++
 
     // step 3: fill into Segment.ConcurrentVector
-    insert_record_.timestamps_.set_data_raw(
+    insert_record_.insert_timestamps(
         reserved_offset, timestamps_raw, num_rows);
 
     // update the mem size of timestamps and row IDs
@@ -215,6 +228,10 @@ SegmentGrowingImpl::Insert(int64_t reserved_offset,
                      reserved_offset);
         }
 
+        if (field_meta.enable_growing_jsonStats()) {
+            AddJsonKeyStats(field_id, reserved_offset, num_rows);
+        }
+
         // update average row data size
         auto field_data_size = GetRawDataSizeOfDataArray(
             &insert_record_proto->fields_data(data_offset),
@@ -245,9 +262,7 @@ SegmentGrowingImpl::Insert(int64_t reserved_offset,
     std::vector<PkType> pks(num_rows);
     ParsePksFromFieldData(
         pks, insert_record_proto->fields_data(field_id_to_offset[field_id]));
-    for (int i = 0; i < num_rows; ++i) {
-        insert_record_.insert_pk(pks[i], reserved_offset + i);
-    }
+    insert_record_.insert_pks(pks, reserved_offset);
 
     // step 5: update small indexes
     insert_record_.ack_responder_.AddSegment(reserved_offset,
@@ -347,7 +362,7 @@ SegmentGrowingImpl::load_field_data_common(
         // query node already guarantees that the timestamp is ordered, avoid field data copy in c++
 
         // step 3: fill into Segment.ConcurrentVector
-        insert_record_.timestamps_.set_data_raw(reserved_offset, field_data);
+        insert_record_.insert_timestamps(reserved_offset, field_data);
         return;
     }
 
@@ -394,6 +409,10 @@ SegmentGrowingImpl::load_field_data_common(
         index->Reload();
     }
 
+    if (field_meta.enable_growing_jsonStats()) {
+        AddJsonKeyStats(field_id, reserved_offset, num_rows);
+    }
+
     // update the mem size
     stats_.mem_size += storage::GetByteSizeOfFieldDatas(field_data);
 
@@ -1200,20 +1219,16 @@ void
 SegmentGrowingImpl::mask_with_timestamps(BitsetTypeView& bitset_chunk,
                                          Timestamp timestamp,
                                          Timestamp collection_ttl) const {
+    auto& timestamps = get_timestamps();
     if (collection_ttl > 0) {
-        auto& timestamps = get_timestamps();
-        auto size = bitset_chunk.size();
-        if (timestamps[size - 1] <= collection_ttl) {
-            bitset_chunk.set();
-            return;
-        }
-        auto pilot = upper_bound(timestamps, 0, size, collection_ttl);
-        BitsetType bitset;
-        bitset.reserve(size);
-        bitset.resize(pilot, true);
-        bitset.resize(size, false);
-        bitset_chunk |= bitset;
+        insert_record_.timestamp_index_.mask_expired(
+            bitset_chunk, timestamps, collection_ttl);
     }
+    // rows after the active count are already cut off, this only masks rows
+    // within it that were inserted out of timestamp order, whole chunks are
+    // skipped by their max timestamp in the common case
+    insert_record_.timestamp_index_.mask_newer(
+        bitset_chunk, timestamps, timestamp);
 }
 
 void
@@ -1246,6 +1261,42 @@ SegmentGrowingImpl::CreateTextIndexes() {
     }
 }
 
+void
+SegmentGrowingImpl::CreateJsonKeyStats() {
+    for (auto& [field_id, field_meta] : schema_->get_fields()) {
+        if (field_meta.enable_growing_jsonStats()) {
+            json_key_stats_[field_id] =
+                std::make_unique<GrowingJsonKeyStats>(size_per_chunk());
+        }
+    }
+}
+
+void
+SegmentGrowingImpl::AddJsonKeyStats(FieldId field_id,
+                                    int64_t offset_begin,
+                                    int64_t n) {
+    auto it = json_key_stats_.find(field_id);
+    if (it == json_key_stats_.end()) {
+        // a field added after the segment was created
+        return;
+    }
+    auto& stats = *it->second;
+    auto& src = *dynamic_cast<const ConcurrentVector<Json>*>(
+        insert_record_.get_data_base(field_id));
+    auto valid_data = insert_record_.is_valid_data_exist(field_id)
+                          ? insert_record_.get_valid_data(field_id)
+                          : nullptr;
+    int64_t stats_size = 0;
+    for (int64_t offset = offset_begin; offset < offset_begin + n; ++offset) {
+        if (valid_data != nullptr && !valid_data->is_valid(offset)) {
+            stats_size += stats.AppendNull(offset);
+        } else {
+            stats_size += stats.Append(offset, src[offset]);
+        }
+    }
+    stats_.mem_size += stats_size;
+}
+
 void
 SegmentGrowingImpl::AddTexts(milvus::FieldId field_id,
                              const std::string* texts,
@@ -327,6 +327,7 @@ class SegmentGrowingImpl : public SegmentGrowing {
               },
               segment_id) {
         this->CreateTextIndexes();
+        this->CreateJsonKeyStats();
     }
 
     ~SegmentGrowingImpl() {
@@ -372,6 +373,15 @@ class SegmentGrowingImpl : public SegmentGrowing {
                      int64_t ins_barrier,
                      Timestamp timestamp) const override;
 
+    DeleteProbe
+    gather_deletes(Timestamp timestamp) const override;
+
+    void
+    mask_offsets_with_delete(BitsetTypeView& bitset,
+                             const int32_t* offsets,
+                             int64_t count,
+                             const DeleteProbe& probe) const override;
+
     void
     search_ids(BitsetType& bitset, const IdArray& id_array) const override;
 
@@ -481,6 +491,12 @@ class SegmentGrowingImpl : public SegmentGrowing {
                   "GetJsonStats not implemented for SegmentGrowingImpl");
     }
 
+    const GrowingJsonKeyStats*
+    GetGrowingJsonStats(FieldId field_id) const override {
+        auto it = json_key_stats_.find(field_id);
+        return it != json_key_stats_.end() ? it->second.get() : nullptr;
+    }
+
     void
     RemoveJsonStats(FieldId field_id) override {
         ThrowInfo(ErrorCode::NotImplemented,
@@ -555,6 +571,15 @@ class SegmentGrowingImpl : public SegmentGrowing {
     void
     CreateTextIndexes();
 
+    // records rows [offset_begin, offset_begin + n) of the json field, which
+    // are in the insert record already, into its json key stats, and
+    // accounts the memory of the stats in the segment stats
+    void
+    AddJsonKeyStats(FieldId field_id, int64_t offset_begin, int64_t n);
+
+    void
+    CreateJsonKeyStats();
+
  private:
     storage::MmapChunkDescriptorPtr mmap_descriptor_ = nullptr;
     SegcoreConfig segcore_config_;
@@ -572,6 +597,10 @@ class SegmentGrowingImpl : public SegmentGrowing {
     // deleted pks
     mutable DeletedRecord<false> deleted_record_;
 
+    // json key stats of the json fields, set up at construction
+    std::unordered_map<FieldId, std::unique_ptr<GrowingJsonKeyStats>>
+        json_key_stats_;
+
     int64_t id_;
 
     SegmentStats stats_{};
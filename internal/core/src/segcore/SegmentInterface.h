@@ -42,6 +42,7 @@
 #include "index/SkipIndex.h"
 #include "index/TextMatchIndex.h"
 #include "segcore/ConcurrentVector.h"
+#include "segcore/GrowingJsonKeyStats.h"
 #include "segcore/InsertRecord.h"
 #include "index/NgramInvertedIndex.h"
 #include "index/json_stats/JsonKeyStats.h"
@@ -56,6 +57,14 @@ struct SegmentStats {
     std::atomic<size_t> mem_size{};
 };
 
+// deletes visible at a query timestamp, gathered once and probed per batch
+struct DeleteProbe {
+    // ts of the delete checkpoint to probe first, 0 if none applies
+    Timestamp checkpoint_ts = 0;
+    // sorted offsets deleted after the checkpoint, up to the query timestamp
+    std::vector<int32_t> deleted;
+};
+
 // common interface of SegmentSealed and SegmentGrowing used by C API
 class SegmentInterface {
  public:
@@ -186,6 +195,13 @@ class SegmentInterface {
     virtual void
     RemoveJsonStats(FieldId field_id) = 0;
 
+    // json key stats maintained while rows are inserted, only growing
+    // segments have them
+    virtual const GrowingJsonKeyStats*
+    GetGrowingJsonStats(FieldId field_id) const {
+        return nullptr;
+    }
+
     virtual void
     LazyCheckSchema(SchemaPtr sch) = 0;
 
@@ -237,10 +253,20 @@ class SegmentInternalInterface : public SegmentInterface {
             auto pw =
                 chunk_string_view_impl(op_ctx, field_id, chunk_id, offset_len);
             auto [string_views, valid_data] = pw.get();
+            // the key indexes are in the chunk pinned by pw
+            auto key_index_pw =
+                chunk_json_key_index(op_ctx, field_id, chunk_id);
+            auto key_index_chunk = key_index_pw.get();
+            auto start = offset_len.has_value() ? offset_len->first : 0;
             std::vector<Json> res;
             res.reserve(string_views.size());
-            for (const auto& str_view : string_views) {
-                res.emplace_back(Json(str_view));
+            for (size_t i = 0; i < string_views.size(); ++i) {
+                if (key_index_chunk != nullptr) {
+                    res.emplace_back(string_views[i],
+                                     key_index_chunk->KeyIndex(start + i));
+                } else {
+                    res.emplace_back(string_views[i]);
+                }
             }
             return PinWrapper<
                 std::pair<std::vector<ViewType>, FixedVector<bool>>>(
@@ -279,14 +305,23 @@ class SegmentInternalInterface : public SegmentInterface {
         } else if constexpr (std::is_same_v<ViewType, Json>) {
             auto pw = chunk_string_views_by_offsets(
                 op_ctx, field_id, chunk_id, offsets);
+            auto key_index_pw =
+                chunk_json_key_index(op_ctx, field_id, chunk_id);
+            auto key_index_chunk = key_index_pw.get();
+            const auto& views = pw.get().first;
             std::vector<ViewType> res;
-            res.reserve(pw.get().first.size());
-            for (const auto& view : pw.get().first) {
-                res.emplace_back(view);
+            res.reserve(views.size());
+            for (size_t i = 0; i < views.size(); ++i) {
+                if (key_index_chunk != nullptr) {
+                    res.emplace_back(views[i],
+                                     key_index_chunk->KeyIndex(offsets[i]));
+                } else {
+                    res.emplace_back(views[i]);
+                }
             }
             return PinWrapper<
                 std::pair<std::vector<ViewType>, FixedVector<bool>>>(
-                {std::move(res), pw.get().second});
+                pw, {std::move(res), pw.get().second});
         } else if constexpr (std::is_same_v<ViewType, ArrayView>) {
             return chunk_array_views_by_offsets(
                 op_ctx, field_id, chunk_id, offsets);
@@ -348,6 +383,24 @@ class SegmentInternalInterface : public SegmentInterface {
         return false;
     }
 
+    // chunk_id of the string field, when it is dictionary encoded, holding
+    // nullptr otherwise
+    virtual PinWrapper<const StringChunk*>
+    chunk_string_dictionary(milvus::OpContext* op_ctx,
+                            FieldId field_id,
+                            int64_t chunk_id) const {
+        return PinWrapper<const StringChunk*>(nullptr);
+    }
+
+    // chunk_id of the json field, when it holds the key index of its rows,
+    // holding nullptr otherwise
+    virtual PinWrapper<const JSONChunk*>
+    chunk_json_key_index(milvus::OpContext* op_ctx,
+                         FieldId field_id,
+                         int64_t chunk_id) const {
+        return PinWrapper<const JSONChunk*>(nullptr);
+    }
+
     const SkipIndex&
     GetSkipIndex() const;
 
@@ -407,6 +460,18 @@ class SegmentInternalInterface : public SegmentInterface {
                      int64_t ins_barrier,
                      Timestamp timestamp) const = 0;
 
+    // deletes visible at timestamp, to be probed by mask_offsets_with_delete
+    virtual DeleteProbe
+    gather_deletes(Timestamp timestamp) const = 0;
+
+    // bitset[i] is set if the row at offsets[i] is deleted per probe,
+    // cheaper than mask_with_delete when checking a few candidate rows
+    virtual void
+    mask_offsets_with_delete(BitsetTypeView& bitset,
+                             const int32_t* offsets,
+                             int64_t count,
+                             const DeleteProbe& probe) const = 0;
+
     // count of chunk that has raw data
     virtual int64_t
     num_chunk_data(FieldId field_id) const = 0;
@@ -11,6 +11,8 @@
 
 #include "TimestampIndex.h"
 
+#include <algorithm>
+
 namespace milvus::segcore {
 
 void
@@ -103,6 +105,207 @@ TimestampIndex::GenerateTTLBitset(const Timestamp* timestamps,
     return bitset;
 }
 
+namespace {
+
+void
+atomic_min(std::atomic<Timestamp>& target, Timestamp value) {
+    auto current = target.load();
+    while (value < current && !target.compare_exchange_weak(current, value)) {
+    }
+}
+
+void
+atomic_max(std::atomic<Timestamp>& target, Timestamp value) {
+    auto current = target.load();
+    while (value > current && !target.compare_exchange_weak(current, value)) {
+    }
+}
+
+}  // namespace
+
+void
+GrowingTimestampIndex::update(int64_t offset,
+                              const Timestamp* timestamps,
+                              int64_t size) {
+    if (size == 0) {
+        return;
+    }
+    size_t num_chunk = (offset + size - 1) / size_per_chunk_ + 1;
+    {
+        std::unique_lock lck(mutex_);
+        while (ranges_.size() < num_chunk) {
+            ranges_.emplace_back();
+        }
+    }
+
+    std::shared_lock lck(mutex_);
+    int64_t end = offset + size;
+    for (int64_t begin = offset; begin < end;) {
+        auto chunk_id = begin / size_per_chunk_;
+        auto len = std::min(size_per_chunk_ - begin % size_per_chunk_,
+                            end - begin);
+        auto [min_v, max_v] =
+            std::minmax_element(timestamps + (begin - offset),
+                                timestamps + (begin - offset) + len);
+        atomic_min(ranges_[chunk_id].min_ts, *min_v);
+        atomic_max(ranges_[chunk_id].max_ts, *max_v);
+        begin += len;
+    }
+}
+
+template <bitset::CompareOpType Op>
+void
+GrowingTimestampIndex::mask_with(
+    BitsetTypeView& bitset_chunk,
+    const ConcurrentVector<Timestamp>& timestamps,
+    Timestamp value) const {
+    static_assert(Op == bitset::CompareOpType::GT ||
+                  Op == bitset::CompareOpType::LE);
+    int64_t size = bitset_chunk.size();
+    BitsetType chunk_mask;
+
+    std::shared_lock lck(mutex_);
+    for (int64_t begin = 0; begin < size;) {
+        auto chunk_id = begin / size_per_chunk_;
+        auto len =
+            std::min(size_per_chunk_ - begin % size_per_chunk_, size - begin);
+        auto min_ts = std::numeric_limits<Timestamp>::min();
+        auto max_ts = std::numeric_limits<Timestamp>::max();
+        if (chunk_id < static_cast<int64_t>(ranges_.size())) {
+            auto& range = ranges_[chunk_id];
+            if (range.min_ts.load() <= range.max_ts.load()) {
+                min_ts = range.min_ts.load();
+                max_ts = range.max_ts.load();
+            }
+        }
+
+        bool all_hit = Op == bitset::CompareOpType::GT ? min_ts > value
+                                                       : max_ts <= value;
+        bool none_hit = Op == bitset::CompareOpType::GT ? max_ts <= value
+                                                        : min_ts > value;
+        if (all_hit) {
+            bitset_chunk.set(begin, static_cast<size_t>(len), true);
+        } else if (!none_hit) {
+            auto data = static_cast<const Timestamp*>(
+                timestamps.get_chunk_data(chunk_id));
+            data += begin % size_per_chunk_;
+            if (chunk_mask.size() < static_cast<size_t>(len)) {
+                chunk_mask.resize(len);
+            }
+            auto chunk_view = chunk_mask.view(0, len);
+            chunk_view.inplace_compare_val<Timestamp, Op>(data, len, value);
+            bitset_chunk.view(begin, len).inplace_or(chunk_view, len);
+        }
+        begin += len;
+    }
+}
+
+void
+GrowingTimestampIndex::mask_newer(
+    BitsetTypeView& bitset_chunk,
+    const ConcurrentVector<Timestamp>& timestamps,
+    Timestamp query_timestamp) const {
+    mask_with<bitset::CompareOpType::GT>(
+        bitset_chunk, timestamps, query_timestamp);
+}
+
+void
+GrowingTimestampIndex::mask_expired(
+    BitsetTypeView& bitset_chunk,
+    const ConcurrentVector<Timestamp>& timestamps,
+    Timestamp expire_ts) const {
+    mask_with<bitset::CompareOpType::LE>(bitset_chunk, timestamps, expire_ts);
+}
+
+void
+GrowingTimestampIndex::clear() {
+    std::unique_lock lck(mutex_);
+    ranges_.clear();
+}
+
+size_t
+GrowingTimestampIndex::size() const {
+    std::shared_lock lck(mutex_);
+    return sizeof(*this) + ranges_.size() * sizeof(ChunkRange);
+}
+
+ZoneMap<Timestamp>
+BuildTimestampZoneMap(const Timestamp* timestamps, int64_t size) {
+    ZoneMap<Timestamp> zones;
+    for (int64_t begin = 0; begin < size; begin += TIMESTAMP_ZONE_ROWS) {
+        auto len = std::min(TIMESTAMP_ZONE_ROWS, size - begin);
+        auto [min_v, max_v] =
+            std::minmax_element(timestamps + begin, timestamps + begin + len);
+        zones.Add(len, *min_v, *max_v);
+    }
+    return zones;
+}
+
+namespace {
+
+template <bitset::CompareOpType Op>
+void
+MaskTimestampZones(BitsetTypeView& bitset_chunk,
+                   const ZoneMap<Timestamp>& zones,
+                   const Timestamp* timestamps,
+                   int64_t begin,
+                   int64_t end,
+                   Timestamp value) {
+    static_assert(Op == bitset::CompareOpType::GT ||
+                  Op == bitset::CompareOpType::LE);
+    AssertInfo(end <= zones.num_rows(),
+               "mask range end {} beyond {} rows of timestamp zones",
+               end,
+               zones.num_rows());
+    BitsetType zone_mask;
+    while (begin < end) {
+        auto zone_id = zones.chunk_of(begin);
+        auto& zone = zones.zone(zone_id);
+        auto len =
+            std::min(zones.rows_until(zone_id) + zone.num_rows, end) - begin;
+        bool all_hit = Op == bitset::CompareOpType::GT ? zone.min > value
+                                                       : zone.max <= value;
+        bool none_hit = Op == bitset::CompareOpType::GT ? zone.max <= value
+                                                        : zone.min > value;
+        if (all_hit) {
+            bitset_chunk.set(begin, static_cast<size_t>(len), true);
+        } else if (!none_hit) {
+            if (zone_mask.size() < static_cast<size_t>(len)) {
+                zone_mask.resize(len);
+            }
+            auto zone_view = zone_mask.view(0, len);
+            zone_view.inplace_compare_val<Timestamp, Op>(
+                timestamps + begin, len, value);
+            bitset_chunk.view(begin, len).inplace_or(zone_view, len);
+        }
+        begin += len;
+    }
+}
+
+}  // namespace
+
+void
+MaskNewerTimestamps(BitsetTypeView& bitset_chunk,
+                    const ZoneMap<Timestamp>& zones,
+                    const Timestamp* timestamps,
+                    int64_t begin,
+                    int64_t end,
+                    Timestamp query_timestamp) {
+    MaskTimestampZones<bitset::CompareOpType::GT>(
+        bitset_chunk, zones, timestamps, begin, end, query_timestamp);
+}
+
+void
+MaskExpiredTimestamps(BitsetTypeView& bitset_chunk,
+                      const ZoneMap<Timestamp>& zones,
+                      const Timestamp* timestamps,
+                      int64_t begin,
+                      int64_t end,
+                      Timestamp expire_ts) {
+    MaskTimestampZones<bitset::CompareOpType::LE>(
+        bitset_chunk, zones, timestamps, begin, end, expire_ts);
+}
+
 std::vector<int64_t>
 GenerateFakeSlices(const Timestamp* timestamps,
                    int64_t size,
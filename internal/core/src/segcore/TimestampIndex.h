@@ -12,10 +12,17 @@
 #pragma once
 
 #include <boost/dynamic_bitset.hpp>
+#include <atomic>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
 #include <vector>
 #include <utility>
 
 #include "common/Schema.h"
+#include "segcore/ConcurrentVector.h"
+#include "segcore/ZoneMap.h"
 namespace milvus::segcore {
 
 class TimestampIndex {
@@ -64,6 +71,85 @@ class TimestampIndex {
     std::vector<Timestamp> timestamp_barriers_;
 };
 
+// Per-chunk min/max timestamps of a growing segment, maintained on insert.
+// Masking skips or bulk-sets whole chunks and only compares the rows of
+// chunks whose timestamp range straddles the given timestamp.
+class GrowingTimestampIndex {
+ public:
+    explicit GrowingTimestampIndex(int64_t size_per_chunk)
+        : size_per_chunk_(size_per_chunk) {
+    }
+
+    // must be called before the rows are acked, so that every visible row
+    // is covered by the range of its chunk
+    void
+    update(int64_t offset, const Timestamp* timestamps, int64_t size);
+
+    // set bits of the rows whose timestamp > query_timestamp
+    void
+    mask_newer(BitsetTypeView& bitset_chunk,
+               const ConcurrentVector<Timestamp>& timestamps,
+               Timestamp query_timestamp) const;
+
+    // set bits of the rows whose timestamp <= expire_ts
+    void
+    mask_expired(BitsetTypeView& bitset_chunk,
+                 const ConcurrentVector<Timestamp>& timestamps,
+                 Timestamp expire_ts) const;
+
+    void
+    clear();
+
+    size_t
+    size() const;
+
+ private:
+    struct ChunkRange {
+        std::atomic<Timestamp> min_ts{std::numeric_limits<Timestamp>::max()};
+        std::atomic<Timestamp> max_ts{0};
+    };
+
+    template <bitset::CompareOpType Op>
+    void
+    mask_with(BitsetTypeView& bitset_chunk,
+              const ConcurrentVector<Timestamp>& timestamps,
+              Timestamp value) const;
+
+ private:
+    const int64_t size_per_chunk_;
+    mutable std::shared_mutex mutex_;
+    // numChunk, only grows under the unique lock
+    std::deque<ChunkRange> ranges_;
+};
+
+// rows of a sealed segment covered by one zone of its timestamp zone map
+constexpr int64_t TIMESTAMP_ZONE_ROWS = 4096;
+
+// min and max timestamp of each TIMESTAMP_ZONE_ROWS rows of a sealed segment
+ZoneMap<Timestamp>
+BuildTimestampZoneMap(const Timestamp* timestamps, int64_t size);
+
+// Set bits of the rows in [begin, end) whose timestamp > query_timestamp.
+// Zones entirely newer are set and zones entirely older are skipped, only
+// the rows of zones straddling query_timestamp are compared.
+void
+MaskNewerTimestamps(BitsetTypeView& bitset_chunk,
+                    const ZoneMap<Timestamp>& zones,
+                    const Timestamp* timestamps,
+                    int64_t begin,
+                    int64_t end,
+                    Timestamp query_timestamp);
+
+// set bits of the rows in [begin, end) whose timestamp <= expire_ts, by zone
+// like MaskNewerTimestamps
+void
+MaskExpiredTimestamps(BitsetTypeView& bitset_chunk,
+                      const ZoneMap<Timestamp>& zones,
+                      const Timestamp* timestamps,
+                      int64_t begin,
+                      int64_t end,
+                      Timestamp expire_ts);
+
 std::vector<int64_t>
 GenerateFakeSlices(const Timestamp* timestamps,
                    int64_t size,
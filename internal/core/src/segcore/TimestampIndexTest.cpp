@@ -66,3 +66,78 @@ TEST(TimestampIndex, Naive) {
     ASSERT_EQ(range.first, 8);
     ASSERT_EQ(range.second, 8);
 }
+
+TEST(TimestampIndex, Growing) {
+    int64_t size_per_chunk = 4;
+    // second chunk straddles 15, third chunk is out of order
+    std::vector<Timestamp> timestamps{1, 2, 3, 4, 10, 16, 12, 20, 30, 5, 31};
+    ConcurrentVector<Timestamp> vec(size_per_chunk);
+    GrowingTimestampIndex index(size_per_chunk);
+    // insert in batches crossing chunk boundaries
+    std::vector<std::pair<int64_t, int64_t>> batches{{0, 3}, {3, 9}, {9, 11}};
+    for (auto [begin, end] : batches) {
+        vec.set_data_raw(begin, timestamps.data() + begin, end - begin);
+        index.update(begin, timestamps.data() + begin, end - begin);
+    }
+
+    for (Timestamp query_ts : {0, 4, 5, 15, 20, 31}) {
+        for (int64_t size : {0, 3, 6, 11}) {
+            BitsetType newer(size);
+            BitsetType expired(size);
+            BitsetTypeView newer_view(newer);
+            BitsetTypeView expired_view(expired);
+            index.mask_newer(newer_view, vec, query_ts);
+            index.mask_expired(expired_view, vec, query_ts);
+            for (int64_t i = 0; i < size; ++i) {
+                ASSERT_EQ(bool(newer[i]), timestamps[i] > query_ts) << i;
+                ASSERT_EQ(bool(expired[i]), timestamps[i] <= query_ts) << i;
+            }
+        }
+    }
+
+    // masks are or-ed into the input
+    BitsetType bitset(8);
+    bitset.set(0);
+    BitsetTypeView view(bitset);
+    index.mask_newer(view, vec, 15);
+    ASSERT_TRUE(bitset[0]);
+    ASSERT_EQ(3, bitset.count());
+
+    index.clear();
+    ASSERT_EQ(sizeof(index), index.size());
+}
+
+TEST(TimestampIndex, SealedZones) {
+    // zones older than, straddling and newer than the query timestamps, and
+    // a short last zone
+    int64_t size = 3 * TIMESTAMP_ZONE_ROWS + 7;
+    std::vector<Timestamp> timestamps(size);
+    for (int64_t i = 0; i < size; ++i) {
+        auto zone = i / TIMESTAMP_ZONE_ROWS;
+        timestamps[i] = zone * 100 + (i * 37) % 100;
+    }
+    auto zones = BuildTimestampZoneMap(timestamps.data(), size);
+    ASSERT_EQ(zones.num_chunks(), 4);
+    ASSERT_EQ(zones.num_rows(), size);
+
+    for (Timestamp ts : {0, 50, 99, 150, 350, 1000}) {
+        for (auto [begin, end] : std::vector<std::pair<int64_t, int64_t>>{
+                 {0, size}, {10, TIMESTAMP_ZONE_ROWS + 10}, {5, 5}}) {
+            BitsetType newer(size);
+            BitsetType expired(size);
+            BitsetTypeView newer_view(newer);
+            BitsetTypeView expired_view(expired);
+            MaskNewerTimestamps(
+                newer_view, zones, timestamps.data(), begin, end, ts);
+            MaskExpiredTimestamps(
+                expired_view, zones, timestamps.data(), begin, end, ts);
+            for (int64_t i = 0; i < size; ++i) {
+                bool in_range = i >= begin && i < end;
+                ASSERT_EQ(bool(newer[i]), in_range && timestamps[i] > ts)
+                    << i;
+                ASSERT_EQ(bool(expired[i]), in_range && timestamps[i] <= ts)
+                    << i;
+            }
+        }
+    }
+}
@@ -11,9 +11,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <cstdlib>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "common/FieldData.h"
@@ -137,6 +139,76 @@ upper_bound(const ConcurrentVector<Timestamp>& timestamps,
             int64_t last,
             Timestamp value);
 
+/**
+ * Returns the first index in [first, last) whose element is not less than value, probing
+ * exponentially from first. Looking up increasing values one after another, each search
+ * starting where the previous one stopped, costs O(log distance) instead of O(log n).
+ *
+ * @param at accessor returning the element at an index
+ * @return The index of answer, last will be returned if every element is less than value.
+ */
+template <typename Accessor, typename T>
+int64_t
+gallop_lower_bound(const Accessor& at,
+                   int64_t first,
+                   int64_t last,
+                   const T& value) {
+    int64_t lo = first;
+    int64_t hi = first;
+    int64_t step = 1;
+    while (hi < last && at(hi) < value) {
+        lo = hi + 1;
+        hi = first + step;
+        step <<= 1;
+    }
+    hi = std::min(hi, last);
+    while (lo < hi) {
+        auto mid = lo + (hi - lo) / 2;
+        if (at(mid) < value) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * Merge-joins pks sorted by value with one sorted pk chunk of num_rows rows, and calls
+ * on_match(chunk_offset, pk_index) for every row equal to one of the pks. A chunk whose
+ * [min, max] does not overlap the pks is skipped without probing.
+ *
+ * @param sorted_pks pairs of (pk, index of the pk in the request), sorted by pk
+ */
+template <typename Accessor, typename T, typename OnMatch>
+void
+merge_join_sorted_pks(const Accessor& at,
+                      int64_t num_rows,
+                      const std::vector<std::pair<T, size_t>>& sorted_pks,
+                      OnMatch&& on_match) {
+    if (num_rows == 0 || sorted_pks.empty()) {
+        return;
+    }
+    const auto min = at(0);
+    const auto max = at(num_rows - 1);
+    auto it = std::lower_bound(
+        sorted_pks.begin(),
+        sorted_pks.end(),
+        min,
+        [](const std::pair<T, size_t>& pk, const decltype(min)& value) {
+            return pk.first < value;
+        });
+    int64_t pos = 0;
+    for (; it != sorted_pks.end() && !(max < it->first); ++it) {
+        pos = gallop_lower_bound(at, pos, num_rows, it->first);
+        // pos is not moved past the matches, a duplicated pk matches again
+        for (auto offset = pos; offset < num_rows && at(offset) == it->first;
+             ++offset) {
+            on_match(offset, it->second);
+        }
+    }
+}
+
 CacheWarmupPolicy
 getCacheWarmupPolicy(bool is_vector, bool is_index, bool in_load_list = true);
 
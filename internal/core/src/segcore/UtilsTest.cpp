@@ -11,10 +11,13 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include "common/Schema.h"
@@ -39,6 +42,45 @@ TEST(Util_Segcore, UpperBound) {
     ASSERT_EQ(10, upper_bound(timestamps, 0, data.size(), 10));
 }
 
+TEST(Util_Segcore, GallopLowerBound) {
+    using milvus::segcore::gallop_lower_bound;
+
+    std::vector<int64_t> data{1, 3, 3, 3, 5, 7, 9, 11, 13, 15};
+    auto at = [&data](int64_t i) { return data[i]; };
+    for (int64_t value = 0; value <= 16; ++value) {
+        for (int64_t first = 0; first <= data.size(); ++first) {
+            auto expected =
+                std::lower_bound(data.begin() + first, data.end(), value) -
+                data.begin();
+            ASSERT_EQ(expected,
+                      gallop_lower_bound(at, first, data.size(), value));
+        }
+    }
+}
+
+TEST(Util_Segcore, MergeJoinSortedPks) {
+    using milvus::segcore::merge_join_sorted_pks;
+
+    std::vector<std::string> chunk{"b", "c", "c", "e", "g"};
+    auto at = [&chunk](int64_t i) { return std::string_view(chunk[i]); };
+    // pk "c" is requested twice, "a" and "z" are out of the chunk range
+    std::vector<std::pair<std::string_view, size_t>> pks{
+        {"a", 0}, {"c", 1}, {"c", 4}, {"d", 2}, {"g", 3}, {"z", 5}};
+    std::vector<std::pair<int64_t, size_t>> matches;
+    merge_join_sorted_pks(
+        at, chunk.size(), pks, [&](int64_t offset, size_t pk_idx) {
+            matches.emplace_back(offset, pk_idx);
+        });
+    std::vector<std::pair<int64_t, size_t>> expected{
+        {1, 1}, {2, 1}, {1, 4}, {2, 4}, {4, 3}};
+    ASSERT_EQ(expected, matches);
+
+    // no overlap with [min, max], nothing is probed
+    std::vector<std::pair<std::string_view, size_t>> out_of_range{{"h", 0}};
+    merge_join_sorted_pks(
+        at, chunk.size(), out_of_range, [&](int64_t, size_t) { FAIL(); });
+}
+
 TEST(Util_Segcore, GetDeleteBitmap) {
     using namespace milvus;
     using namespace milvus::segcore;
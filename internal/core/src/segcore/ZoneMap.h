@@ -0,0 +1,142 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "common/EasyAssert.h"
+#include "common/Types.h"
+
+namespace milvus::segcore {
+
+// Min, max and null count of each chunk of a sealed column, taken once at
+// load time, so that lookups can rule whole chunks in or out without pinning
+// them.
+template <typename T>
+class ZoneMap {
+ public:
+    struct Zone {
+        // of the non-null rows, unset when every row is null
+        T min{};
+        T max{};
+        int64_t num_rows = 0;
+        int64_t null_count = 0;
+    };
+
+    // appends the zone of the next chunk
+    void
+    Add(int64_t num_rows, T min, T max, int64_t null_count = 0) {
+        AssertInfo(null_count <= num_rows,
+                   "null count {} larger than row count {}",
+                   null_count,
+                   num_rows);
+        zones_.push_back(
+            Zone{std::move(min), std::move(max), num_rows, null_count});
+        rows_until_.push_back(num_rows_);
+        num_rows_ += num_rows;
+    }
+
+    bool
+    empty() const {
+        return zones_.empty();
+    }
+
+    int64_t
+    num_chunks() const {
+        return zones_.size();
+    }
+
+    int64_t
+    num_rows() const {
+        return num_rows_;
+    }
+
+    const Zone&
+    zone(int64_t chunk_id) const {
+        return zones_[chunk_id];
+    }
+
+    int64_t
+    rows_until(int64_t chunk_id) const {
+        return rows_until_[chunk_id];
+    }
+
+    // chunk holding the row at offset
+    int64_t
+    chunk_of(int64_t offset) const {
+        auto it =
+            std::upper_bound(rows_until_.begin(), rows_until_.end(), offset);
+        return (it - rows_until_.begin()) - 1;
+    }
+
+    // no row of the chunk satisfies `row op value`
+    bool
+    CanSkip(int64_t chunk_id, OpType op, const T& value) const {
+        auto& zone = zones_[chunk_id];
+        if (zone.null_count == zone.num_rows) {
+            return true;
+        }
+        switch (op) {
+            case OpType::Equal:
+                return value < zone.min || zone.max < value;
+            case OpType::GreaterThan:
+                return !(value < zone.max);
+            case OpType::GreaterEqual:
+                return zone.max < value;
+            case OpType::LessThan:
+                return !(zone.min < value);
+            case OpType::LessEqual:
+                return value < zone.min;
+            default:
+                return false;
+        }
+    }
+
+    // every row of the chunk satisfies `row op value`
+    bool
+    AllMatch(int64_t chunk_id, OpType op, const T& value) const {
+        auto& zone = zones_[chunk_id];
+        if (zone.null_count != 0 || zone.num_rows == 0) {
+            return false;
+        }
+        switch (op) {
+            case OpType::Equal:
+                return !(zone.min < value) && !(value < zone.max);
+            case OpType::GreaterThan:
+                return value < zone.min;
+            case OpType::GreaterEqual:
+                return !(zone.min < value);
+            case OpType::LessThan:
+                return zone.max < value;
+            case OpType::LessEqual:
+                return !(value < zone.max);
+            default:
+                return false;
+        }
+    }
+
+    size_t
+    size() const {
+        return sizeof(*this) + zones_.capacity() * sizeof(Zone) +
+               rows_until_.capacity() * sizeof(int64_t);
+    }
+
+ private:
+    std::vector<Zone> zones_;
+    // numChunk, rows before each chunk
+    std::vector<int64_t> rows_until_;
+    int64_t num_rows_ = 0;
+};
+
+}  // namespace milvus::segcore
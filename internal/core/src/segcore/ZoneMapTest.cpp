@@ -0,0 +1,79 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "segcore/ZoneMap.h"
+
+using namespace milvus;
+using namespace milvus::segcore;
+
+TEST(ZoneMap, SkipAndAllMatch) {
+    ZoneMap<int64_t> zones;
+    zones.Add(10, 0, 9);
+    zones.Add(5, 10, 10);
+    zones.Add(0, 0, 0);
+    zones.Add(4, 20, 30, 1);
+    zones.Add(3, 0, 0, 3);
+    ASSERT_EQ(zones.num_chunks(), 5);
+    ASSERT_EQ(zones.num_rows(), 22);
+    ASSERT_EQ(zones.rows_until(3), 15);
+    ASSERT_EQ(zones.chunk_of(0), 0);
+    ASSERT_EQ(zones.chunk_of(14), 1);
+    // the empty chunk holds no row
+    ASSERT_EQ(zones.chunk_of(15), 3);
+
+    // every op against the values of each chunk, checked by brute force
+    std::vector<std::vector<int64_t>> values{
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9}, {10, 10, 10, 10, 10}, {}, {20, 30, 25}, {}};
+    for (auto op : {OpType::Equal,
+                    OpType::GreaterThan,
+                    OpType::GreaterEqual,
+                    OpType::LessThan,
+                    OpType::LessEqual}) {
+        for (int64_t target : {-1, 0, 5, 9, 10, 11, 20, 25, 30, 31}) {
+            for (int64_t chunk = 0; chunk < zones.num_chunks(); ++chunk) {
+                int64_t hits = 0;
+                for (auto v : values[chunk]) {
+                    bool hit = op == OpType::Equal         ? v == target
+                               : op == OpType::GreaterThan ? v > target
+                               : op == OpType::GreaterEqual ? v >= target
+                               : op == OpType::LessThan     ? v < target
+                                                            : v <= target;
+                    hits += hit;
+                }
+                auto& zone = zones.zone(chunk);
+                ASSERT_EQ(zones.CanSkip(chunk, op, target), hits == 0)
+                    << chunk << " " << target;
+                ASSERT_EQ(zones.AllMatch(chunk, op, target),
+                          zone.num_rows > 0 && hits == zone.num_rows)
+                    << chunk << " " << target;
+            }
+        }
+    }
+
+    // not decided by the zone
+    ASSERT_FALSE(zones.CanSkip(0, OpType::NotEqual, 5));
+    ASSERT_FALSE(zones.AllMatch(0, OpType::NotEqual, 50));
+}
+
+TEST(ZoneMap, String) {
+    ZoneMap<std::string> zones;
+    zones.Add(3, "apple", "banana");
+    zones.Add(2, "cherry", "date");
+    ASSERT_TRUE(zones.CanSkip(0, OpType::Equal, "cherry"));
+    ASSERT_FALSE(zones.CanSkip(1, OpType::Equal, "cherry"));
+    ASSERT_TRUE(zones.AllMatch(1, OpType::GreaterEqual, "cherry"));
+    ASSERT_TRUE(zones.AllMatch(0, OpType::LessThan, "bananas"));
+    ASSERT_FALSE(zones.AllMatch(0, OpType::LessThan, "banana"));
+}
@@ -44,6 +44,11 @@ class GroupReduceHelper : public ReduceHelper {
                               int seg_res_idx,
                               std::vector<int64_t>& real_topks) override;
 
+    bool
+    SupportParallelMerge() const override {
+        return false;
+    }
+
     void
     FillOtherData(int result_count,
                   int64_t nq_begin,
@@ -52,6 +57,9 @@ class GroupReduceHelper : public ReduceHelper {
                       search_res_data) override;
 
  private:
+    // heads of the segments merged for one nq, reused across nqs
+    std::vector<SearchResultPair> pairs_;
+    std::unordered_set<milvus::PkType> pk_set_{};
     std::unordered_set<milvus::GroupByValueType> group_by_val_set_{};
 };
 
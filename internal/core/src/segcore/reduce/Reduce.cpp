@@ -13,14 +13,18 @@
 
 #include "log/Log.h"
 #include <cstdint>
+#include <exception>
+#include <future>
 #include <vector>
 
+#include "common/Common.h"
 #include "common/EasyAssert.h"
 #include "monitor/Monitor.h"
 #include "segcore/SegmentInterface.h"
 #include "segcore/Utils.h"
 #include "segcore/pkVisitor.h"
 #include "segcore/ReduceUtils.h"
+#include "storage/ThreadPools.h"
 
 namespace milvus::segcore {
 
@@ -70,13 +74,40 @@ ReduceHelper::Marshal() {
     // get search result data blobs of slices
     search_result_data_blobs_ =
         std::make_unique<milvus::segcore::SearchResultDataBlobs>();
-    search_result_data_blobs_->blobs.resize(num_slices_);
-    search_result_data_blobs_->costs.resize(num_slices_);
+    std::vector<SearchResultDataSlice> slices;
+    slices.reserve(num_slices_);
     for (int i = 0; i < num_slices_; i++) {
-        auto [proto, cost] =
-            GetSearchResultDataSlice(i, total_search_storage_cost_);
-        search_result_data_blobs_->blobs[i] = std::move(proto);
-        search_result_data_blobs_->costs[i] = cost;
+        slices.emplace_back(
+            GetSearchResultDataSlice(i, total_search_storage_cost_));
+    }
+    search_result_data_blobs_->Marshal(slices);
+}
+
+void
+SearchResultDataBlobs::Marshal(std::vector<SearchResultDataSlice>& slices) {
+    std::vector<size_t> sizes(slices.size());
+    size_t total_size = 0;
+    for (size_t i = 0; i < slices.size(); i++) {
+        sizes[i] = slices[i].ByteSize();
+        total_size += sizes[i];
+    }
+    // left uninitialized, every byte is written below
+    buffer = std::unique_ptr<uint8_t[]>(new uint8_t[total_size]);
+    blobs.resize(slices.size());
+    costs.resize(slices.size());
+    auto target = buffer.get();
+    for (size_t i = 0; i < slices.size(); i++) {
+        auto end = slices[i].SerializeToArray(target);
+        AssertInfo(static_cast<size_t>(end - target) == sizes[i],
+                   "marshaled {} bytes for slice {}, expected {}",
+                   end - target,
+                   i,
+                   sizes[i]);
+        blobs[i] = std::string_view(reinterpret_cast<const char*>(target),
+                                    sizes[i]);
+        costs[i] = slices[i].cost;
+        slices[i].others.reset();
+        target = end;
     }
 }
 
@@ -288,17 +319,13 @@ ReduceHelper::FillEntryData() {
 }
 
 int64_t
-ReduceHelper::ReduceSearchResultForOneNQ(int64_t qi,
-                                         int64_t topk,
-                                         int64_t& offset) {
-    std::priority_queue<SearchResultPair*,
-                        std::vector<SearchResultPair*>,
-                        SearchResultPairComparator>
-        heap;
-    pk_set_.clear();
-    pairs_.clear();
-
-    pairs_.reserve(num_segments_);
+ReduceHelper::MergeOneNQ(int64_t qi,
+                         int64_t topk,
+                         MergeState& state,
+                         std::vector<int64_t>& merged_segments) {
+    auto& pairs = state.pairs;
+    pairs.clear();
+    pairs.reserve(num_segments_);
     for (int i = 0; i < num_segments_; i++) {
         auto search_result = search_results_[i];
         auto offset_beg = search_result->topk_per_nq_prefix_sum_[qi];
@@ -308,45 +335,127 @@ ReduceHelper::ReduceSearchResultForOneNQ(int64_t qi,
         }
         auto primary_key = search_result->primary_keys_[offset_beg];
         auto distance = search_result->distances_[offset_beg];
-        pairs_.emplace_back(
+        pairs.emplace_back(
             primary_key, distance, search_result, i, offset_beg, offset_end);
-        heap.push(&pairs_.back());
     }
 
     // nq has no results for all segments
-    if (heap.size() == 0) {
+    if (pairs.empty()) {
         return 0;
     }
+    state.tree.Reset(&pairs);
+    state.pk_set.Clear(topk);
 
     int64_t dup_cnt = 0;
-    auto start = offset;
-    while (offset - start < topk && !heap.empty()) {
-        auto pilot = heap.top();
-        heap.pop();
+    int64_t count = 0;
+    while (count < topk) {
+        auto pilot = state.tree.Top();
+        if (pilot == nullptr) {
+            break;
+        }
 
         auto index = pilot->segment_index_;
-        auto pk = pilot->primary_key_;
         // no valid search result for this nq, break to next
-        if (pk == INVALID_PK) {
+        if (pilot->primary_key_ == INVALID_PK) {
             break;
         }
-        // remove duplicates
-        if (pk_set_.count(pk) == 0) {
-            pilot->search_result_->result_offsets_.push_back(offset++);
+        // remove duplicates, the set keeps a reference to the pk which
+        // stays valid until the results are refreshed
+        if (state.pk_set.Insert(
+                pilot->search_result_->primary_keys_[pilot->offset_])) {
             final_search_records_[index][qi].push_back(pilot->offset_);
-            pk_set_.insert(pk);
+            merged_segments.push_back(index);
+            count++;
         } else {
             // skip entity with same primary key
             dup_cnt++;
         }
         pilot->advance();
-        if (pilot->primary_key_ != INVALID_PK) {
-            heap.push(pilot);
-        }
+        state.tree.Replay();
     }
     return dup_cnt;
 }
 
+int64_t
+ReduceHelper::ReduceSearchResultForOneNQ(int64_t qi,
+                                         int64_t topk,
+                                         int64_t& offset) {
+    merged_segments_.clear();
+    auto dup_cnt = MergeOneNQ(qi, topk, merge_state_, merged_segments_);
+    for (auto index : merged_segments_) {
+        search_results_[index]->result_offsets_.push_back(offset++);
+    }
+    return dup_cnt;
+}
+
+void
+ReduceHelper::ParallelReduceResultData(int64_t num_tasks) {
+    auto& pool = ThreadPools::GetThreadPool(ThreadPoolPriority::HIGH);
+    num_tasks = std::min<int64_t>(num_tasks, pool.GetMaxThreadNum() + 1);
+
+    std::vector<int64_t> topks(total_nq_);
+    for (int64_t slice_index = 0; slice_index < num_slices_; slice_index++) {
+        std::fill(topks.begin() + slice_nqs_prefix_sum_[slice_index],
+                  topks.begin() + slice_nqs_prefix_sum_[slice_index + 1],
+                  slice_topKs_[slice_index]);
+    }
+
+    // every task merges a range of nqs into its own records, result
+    // offsets are then assigned in nq order on this thread
+    std::vector<std::vector<int64_t>> merged_segments(total_nq_);
+    auto merge_range = [&](int64_t nq_begin, int64_t nq_end) {
+        MergeState state;
+        int64_t dup_cnt = 0;
+        for (int64_t qi = nq_begin; qi < nq_end; qi++) {
+            dup_cnt += MergeOneNQ(qi, topks[qi], state, merged_segments[qi]);
+        }
+        return dup_cnt;
+    };
+
+    std::vector<std::future<int64_t>> futures;
+    futures.reserve(num_tasks - 1);
+    auto nq_per_task = (total_nq_ + num_tasks - 1) / num_tasks;
+    for (int64_t begin = nq_per_task; begin < total_nq_;
+         begin += nq_per_task) {
+        futures.emplace_back(pool.Submit(
+            merge_range, begin, std::min(begin + nq_per_task, total_nq_)));
+    }
+    int64_t filtered_count = 0;
+    std::exception_ptr error;
+    try {
+        filtered_count += merge_range(0, std::min(nq_per_task, total_nq_));
+    } catch (...) {
+        error = std::current_exception();
+    }
+    // wait for all tasks before leaving, they reference this frame
+    for (auto& future : futures) {
+        try {
+            filtered_count += future.get();
+        } catch (...) {
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    for (int64_t slice_index = 0; slice_index < num_slices_; slice_index++) {
+        int64_t offset = 0;
+        for (int64_t qi = slice_nqs_prefix_sum_[slice_index];
+             qi < slice_nqs_prefix_sum_[slice_index + 1];
+             qi++) {
+            for (auto index : merged_segments[qi]) {
+                search_results_[index]->result_offsets_.push_back(offset++);
+            }
+        }
+    }
+    if (filtered_count > 0) {
+        LOG_DEBUG("skip duplicated search result, count = {}", filtered_count);
+    }
+}
+
 void
 ReduceHelper::ReduceResultData() {
     tracer::AutoSpan span("ReduceHelper::ReduceResultData",
@@ -364,6 +473,15 @@ ReduceHelper::ReduceResultData() {
                    "incorrect search result primary key size");
     }
 
+    if (SupportParallelMerge() && num_segments_ > 1) {
+        auto num_tasks = std::min<int64_t>(
+            REDUCE_PARALLELISM.load(), total_nq_ / REDUCE_MIN_NQ_PER_TASK);
+        if (num_tasks > 1) {
+            ParallelReduceResultData(num_tasks);
+            return;
+        }
+    }
+
     int64_t filtered_count = 0;
     for (int64_t slice_index = 0; slice_index < num_slices_; slice_index++) {
         auto nq_begin = slice_nqs_prefix_sum_[slice_index];
@@ -390,7 +508,7 @@ ReduceHelper::FillOtherData(
     //simple batch reduce do nothing for other data
 }
 
-std::pair<std::vector<char>, StorageCost>
+SearchResultDataSlice
 ReduceHelper::GetSearchResultDataSlice(const int slice_index,
                                        const StorageCost& total_cost) {
     auto nq_begin = slice_nqs_prefix_sum_[slice_index];
@@ -406,16 +524,15 @@ ReduceHelper::GetSearchResultDataSlice(const int slice_index,
                         search_result->topk_per_nq_prefix_sum_[nq_begin];
         all_search_count += search_result->total_data_cnt_;
     }
-    // calculate the cost based on this slice's nq and total nq
-    StorageCost cost = total_cost * (1.0 * (nq_end - nq_begin) / total_nq_);
 
-    auto search_result_data =
-        std::make_unique<milvus::proto::schema::SearchResultData>();
+    SearchResultDataSlice slice;
+    // calculate the cost based on this slice's nq and total nq
+    slice.cost = total_cost * (1.0 * (nq_end - nq_begin) / total_nq_);
     // set unify_topK and total_nq
-    search_result_data->set_top_k(slice_topKs_[slice_index]);
-    search_result_data->set_num_queries(nq_end - nq_begin);
-    search_result_data->mutable_topks()->Resize(nq_end - nq_begin, 0);
-    search_result_data->set_all_search_count(all_search_count);
+    slice.top_k = slice_topKs_[slice_index];
+    slice.num_queries = nq_end - nq_begin;
+    slice.topks.resize(nq_end - nq_begin, 0);
+    slice.all_search_count = all_search_count;
 
     // `result_pairs` contains the SearchResult and result_offset info, used for filling output fields
     std::vector<MergeBase> result_pairs(result_count);
@@ -427,19 +544,12 @@ ReduceHelper::GetSearchResultDataSlice(const int slice_index,
     auto pk_type = plan_->schema_->operator[](primary_field_id).get_data_type();
     switch (pk_type) {
         case milvus::DataType::INT64: {
-            auto ids = std::make_unique<milvus::proto::schema::LongArray>();
-            ids->mutable_data()->Resize(result_count, 0);
-            search_result_data->mutable_ids()->set_allocated_int_id(
-                ids.release());
+            slice.int_ids.resize(result_count, 0);
             break;
         }
         case milvus::DataType::VARCHAR: {
-            auto ids = std::make_unique<milvus::proto::schema::StringArray>();
-            std::vector<std::string> string_pks(result_count);
-            // TODO: prevent mem copy
-            *ids->mutable_data() = {string_pks.begin(), string_pks.end()};
-            search_result_data->mutable_ids()->set_allocated_str_id(
-                ids.release());
+            slice.str_pk = true;
+            slice.str_ids.resize(result_count, nullptr);
             break;
         }
         default: {
@@ -449,7 +559,7 @@ ReduceHelper::GetSearchResultDataSlice(const int slice_index,
     }
 
     // reserve space for distances
-    search_result_data->mutable_scores()->Resize(result_count, 0);
+    slice.scores.resize(result_count, 0);
 
     // fill pks and distances
     for (auto qi = nq_begin; qi < nq_end; qi++) {
@@ -472,48 +582,26 @@ ReduceHelper::GetSearchResultDataSlice(const int slice_index,
                                std::to_string(loc) + ", result_count = " +
                                std::to_string(result_count));
                 // set result pks
-                switch (pk_type) {
-                    case milvus::DataType::INT64: {
-                        search_result_data->mutable_ids()
-                            ->mutable_int_id()
-                            ->mutable_data()
-                            ->Set(loc,
-                                  std::visit(Int64PKVisitor{},
-                                             search_result->primary_keys_[ki]));
-                        break;
-                    }
-                    case milvus::DataType::VARCHAR: {
-                        *search_result_data->mutable_ids()
-                             ->mutable_str_id()
-                             ->mutable_data()
-                             ->Mutable(loc) = std::visit(
-                            StrPKVisitor{}, search_result->primary_keys_[ki]);
-                        break;
-                    }
-                    default: {
-                        ThrowInfo(DataTypeInvalid,
-                                  fmt::format("unsupported primary key type {}",
-                                              pk_type));
-                    }
+                if (slice.str_pk) {
+                    slice.str_ids[loc] = &std::get<std::string>(
+                        search_result->primary_keys_[ki]);
+                } else {
+                    slice.int_ids[loc] = std::visit(
+                        Int64PKVisitor{}, search_result->primary_keys_[ki]);
                 }
 
-                search_result_data->mutable_scores()->Set(
-                    loc, search_result->distances_[ki]);
+                slice.scores[loc] = search_result->distances_[ki];
                 // set result offset to fill output fields data
                 result_pairs[loc] = {&search_result->output_fields_data_, ki};
             }
         }
 
         // update result topKs
-        search_result_data->mutable_topks()->Set(qi - nq_begin, topk_count);
+        slice.topks[qi - nq_begin] = topk_count;
     }
 
-    AssertInfo(search_result_data->scores_size() == result_count,
-               "wrong scores size, size = " +
-                   std::to_string(search_result_data->scores_size()) +
-                   ", expected size = " + std::to_string(result_count));
     // fill other wanted data
-    FillOtherData(result_count, nq_begin, nq_end, search_result_data);
+    FillOtherData(result_count, nq_begin, nq_end, slice.others);
 
     // set output fields
     for (auto field_id : plan_->target_entries_) {
@@ -531,15 +619,9 @@ ReduceHelper::GetSearchResultDataSlice(const int slice_index,
                 ->set_element_type(
                     proto::schema::DataType(field_meta.get_element_type()));
         }
-        search_result_data->mutable_fields_data()->AddAllocated(
-            field_data.release());
+        slice.others->mutable_fields_data()->AddAllocated(field_data.release());
     }
-    // SearchResultData to blob
-    auto size = search_result_data->ByteSizeLong();
-    auto buffer = std::vector<char>(size);
-    search_result_data->SerializePartialToArray(buffer.data(), size);
-
-    return {std::move(buffer), cost};
+    return slice;
 }
 
 void
@@ -14,6 +14,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <string_view>
 #include <vector>
 #include <queue>
 #include <unordered_set>
@@ -22,6 +23,7 @@
 #include "common/QueryResult.h"
 #include "query/PlanImpl.h"
 #include "segcore/ReduceStructure.h"
+#include "segcore/ReduceUtils.h"
 #include "common/Tracer.h"
 #include "segcore/segment_c.h"
 
@@ -29,8 +31,14 @@ namespace milvus::segcore {
 
 // SearchResultDataBlobs contains the marshal blobs of many `milvus::proto::schema::SearchResultData`
 struct SearchResultDataBlobs {
-    std::vector<std::vector<char>> blobs;  // the marshal blobs of each slice
-    std::vector<StorageCost> costs;        // the cost of each slice
+    std::unique_ptr<uint8_t[]> buffer;    // the blobs of all slices
+    std::vector<std::string_view> blobs;  // the marshal blobs of each slice
+    std::vector<StorageCost> costs;       // the cost of each slice
+
+    // marshals the slices back to back into one buffer, the fields of every
+    // slice are released once it is written
+    void
+    Marshal(std::vector<SearchResultDataSlice>& slices);
 };
 
 class ReduceHelper {
@@ -83,6 +91,13 @@ class ReduceHelper {
                                int64_t topk,
                                int64_t& result_offset);
 
+    // whether nqs may be merged on several threads at once, false if
+    // ReduceSearchResultForOneNQ is overridden
+    virtual bool
+    SupportParallelMerge() const {
+        return true;
+    }
+
     virtual void
     FillOtherData(int result_count,
                   int64_t nq_begin,
@@ -105,13 +120,32 @@ class ReduceHelper {
     void
     FillEntryData();
 
-    std::pair<std::vector<char>, StorageCost>
+    SearchResultDataSlice
     GetSearchResultDataSlice(const int slice_index,
                              const StorageCost& total_cost);
 
     void
     GetTotalStorageCost();
 
+    // state of one thread merging nqs, reused across nqs
+    struct MergeState {
+        std::vector<SearchResultPair> pairs;
+        SearchResultLoserTree tree;
+        PkDedupSet pk_set;
+    };
+
+    // merges nq qi of all segments into final_search_records_ and appends
+    // the segment index of every kept entry to merged_segments, in order
+    int64_t
+    MergeOneNQ(int64_t qi,
+               int64_t topk,
+               MergeState& state,
+               std::vector<int64_t>& merged_segments);
+
+    // merges the nqs on up to num_tasks threads, capped by the pool size
+    void
+    ParallelReduceResultData(int64_t num_tasks);
+
  protected:
     std::vector<SearchResult*>& search_results_;
     milvus::query::Plan* plan_;
@@ -121,8 +155,8 @@ class ReduceHelper {
     std::vector<int64_t> slice_topKs_;
     // Used for merge results,
     // define these here to avoid allocating them for each query
-    std::vector<SearchResultPair> pairs_;
-    std::unordered_set<milvus::PkType> pk_set_;
+    MergeState merge_state_;
+    std::vector<int64_t> merged_segments_;
     // dim0: num_segments_; dim1: total_nq_; dim2: offset
     std::vector<std::vector<std::vector<int64_t>>> final_search_records_;
     std::vector<int64_t> slice_nqs_;
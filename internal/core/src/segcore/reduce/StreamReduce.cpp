@@ -189,14 +189,13 @@ StreamReducerHelper::SerializeMergedResult() {
     AssertInfo(num_slice_ > 0,
                "Wrong state for num_slice in streamReducer, num_slice:{}",
                num_slice_);
-    search_result_blobs->blobs.resize(num_slice_);
-    search_result_blobs->costs.resize(num_slice_);
+    std::vector<SearchResultDataSlice> slices;
+    slices.reserve(num_slice_);
     for (int i = 0; i < num_slice_; i++) {
-        auto [proto, cost] =
-            GetSearchResultDataSlice(i, total_search_storage_cost_);
-        search_result_blobs->blobs[i] = std::move(proto);
-        search_result_blobs->costs[i] = cost;
+        slices.emplace_back(
+            GetSearchResultDataSlice(i, total_search_storage_cost_));
     }
+    search_result_blobs->Marshal(slices);
     return search_result_blobs.release();
 }
 
@@ -531,18 +530,17 @@ StreamReducerHelper::RefreshSearchResult() {
     }
 }
 
-std::pair<std::vector<char>, StorageCost>
+SearchResultDataSlice
 StreamReducerHelper::GetSearchResultDataSlice(int slice_index,
                                               const StorageCost& total_cost) {
     auto nq_begin = slice_nqs_prefix_sum_[slice_index];
     auto nq_end = slice_nqs_prefix_sum_[slice_index + 1];
 
-    auto search_result_data =
-        std::make_unique<milvus::proto::schema::SearchResultData>();
+    SearchResultDataSlice slice;
     // set unify_topK and total_nq
-    search_result_data->set_top_k(slice_topKs_[slice_index]);
-    search_result_data->set_num_queries(nq_end - nq_begin);
-    search_result_data->mutable_topks()->Resize(nq_end - nq_begin, 0);
+    slice.top_k = slice_topKs_[slice_index];
+    slice.num_queries = nq_end - nq_begin;
+    slice.topks.resize(nq_end - nq_begin, 0);
 
     int64_t result_count = 0;
     if (merged_search_result->has_result_) {
@@ -560,7 +558,7 @@ StreamReducerHelper::GetSearchResultDataSlice(int slice_index,
         result_count = merged_search_result->topk_per_nq_prefix_sum_[nq_end] -
                        merged_search_result->topk_per_nq_prefix_sum_[nq_begin];
     }
-    StorageCost cost = total_cost * (1.0 * (nq_end - nq_begin) / total_nq_);
+    slice.cost = total_cost * (1.0 * (nq_end - nq_begin) / total_nq_);
 
     // `result_pairs` contains the SearchResult and result_offset info, used for filling output fields
     std::vector<MergeBase> result_pairs(result_count);
@@ -572,19 +570,12 @@ StreamReducerHelper::GetSearchResultDataSlice(int slice_index,
     auto pk_type = plan_->schema_->operator[](primary_field_id).get_data_type();
     switch (pk_type) {
         case milvus::DataType::INT64: {
-            auto ids = std::make_unique<milvus::proto::schema::LongArray>();
-            ids->mutable_data()->Resize(result_count, 0);
-            search_result_data->mutable_ids()->set_allocated_int_id(
-                ids.release());
+            slice.int_ids.resize(result_count, 0);
             break;
         }
         case milvus::DataType::VARCHAR: {
-            auto ids = std::make_unique<milvus::proto::schema::StringArray>();
-            std::vector<std::string> string_pks(result_count);
-            // TODO: prevent mem copy
-            *ids->mutable_data() = {string_pks.begin(), string_pks.end()};
-            search_result_data->mutable_ids()->set_allocated_str_id(
-                ids.release());
+            slice.str_pk = true;
+            slice.str_ids.resize(result_count, nullptr);
             break;
         }
         default: {
@@ -594,7 +585,7 @@ StreamReducerHelper::GetSearchResultDataSlice(int slice_index,
     }
 
     // reserve space for distances
-    search_result_data->mutable_scores()->Resize(result_count, 0);
+    slice.scores.resize(result_count, 0);
 
     //reserve space for group_by_values
     std::vector<GroupByValueType> group_by_values;
@@ -623,35 +614,15 @@ StreamReducerHelper::GetSearchResultDataSlice(int slice_index,
                            std::to_string(loc) +
                            ", result_count = " + std::to_string(result_count));
             // set result pks
-            switch (pk_type) {
-                case milvus::DataType::INT64: {
-                    search_result_data->mutable_ids()
-                        ->mutable_int_id()
-                        ->mutable_data()
-                        ->Set(loc,
-                              std::visit(
-                                  Int64PKVisitor{},
-                                  merged_search_result->primary_keys_[ki]));
-                    break;
-                }
-                case milvus::DataType::VARCHAR: {
-                    *search_result_data->mutable_ids()
-                         ->mutable_str_id()
-                         ->mutable_data()
-                         ->Mutable(loc) =
-                        std::visit(StrPKVisitor{},
-                                   merged_search_result->primary_keys_[ki]);
-                    break;
-                }
-                default: {
-                    ThrowInfo(DataTypeInvalid,
-                              fmt::format("unsupported primary key type {}",
-                                          pk_type));
-                }
+            if (slice.str_pk) {
+                slice.str_ids[loc] = &std::get<std::string>(
+                    merged_search_result->primary_keys_[ki]);
+            } else {
+                slice.int_ids[loc] = std::visit(
+                    Int64PKVisitor{}, merged_search_result->primary_keys_[ki]);
             }
 
-            search_result_data->mutable_scores()->Set(
-                loc, merged_search_result->distances_[ki]);
+            slice.scores[loc] = merged_search_result->distances_[ki];
             // set group by values
             if (merged_search_result->group_by_values_.has_value() &&
                 ki < merged_search_result->group_by_values_.value().size())
@@ -663,14 +634,9 @@ StreamReducerHelper::GetSearchResultDataSlice(int slice_index,
         }
 
         // update result topKs
-        search_result_data->mutable_topks()->Set(qi - nq_begin, topk_count);
+        slice.topks[qi - nq_begin] = topk_count;
     }
-    AssembleGroupByValues(search_result_data, group_by_values, plan_);
-
-    AssertInfo(search_result_data->scores_size() == result_count,
-               "wrong scores size, size = " +
-                   std::to_string(search_result_data->scores_size()) +
-                   ", expected size = " + std::to_string(result_count));
+    AssembleGroupByValues(slice.others, group_by_values, plan_);
 
     // set output fields
     for (auto field_id : plan_->target_entries_) {
@@ -688,15 +654,9 @@ StreamReducerHelper::GetSearchResultDataSlice(int slice_index,
                 ->set_element_type(
                     proto::schema::DataType(field_meta.get_element_type()));
         }
-        search_result_data->mutable_fields_data()->AddAllocated(
-            field_data.release());
+        slice.others->mutable_fields_data()->AddAllocated(field_data.release());
     }
-
-    // SearchResultData to blob
-    auto size = search_result_data->ByteSizeLong();
-    auto buffer = std::vector<char>(size);
-    search_result_data->SerializePartialToArray(buffer.data(), size);
-    return {std::move(buffer), cost};
+    return slice;
 }
 
 void
@@ -19,6 +19,7 @@
 #include "query/PlanImpl.h"
 #include "common/QueryResult.h"
 #include "segcore/ReduceStructure.h"
+#include "segcore/ReduceUtils.h"
 #include "common/EasyAssert.h"
 
 namespace milvus::segcore {
@@ -197,7 +198,7 @@ class StreamReducerHelper {
     void
     AssembleMergedResult();
 
-    std::pair<std::vector<char>, StorageCost>
+    SearchResultDataSlice
     GetSearchResultDataSlice(const int slice_index,
                              const StorageCost& total_cost);
 
@@ -15,6 +15,7 @@
 // limitations under the License.
 
 #include "storage/MemFileManagerImpl.h"
+#include <deque>
 #include <memory>
 #include <unordered_map>
 
@@ -152,6 +153,37 @@ MemFileManagerImpl::LoadIndexToMemory(
     return file_to_index_data;
 }
 
+void
+MemFileManagerImpl::StreamIndexToMemory(
+    const std::vector<std::string>& remote_files,
+    milvus::proto::common::LoadPriority priority,
+    const std::function<void(const std::string&, std::unique_ptr<DataCodec>)>&
+        fn) {
+    auto parallel_degree = std::max<uint64_t>(
+        1, DEFAULT_FIELD_MAX_MEMORY_LIMIT / FILE_SLICE_SIZE);
+    std::deque<std::future<std::unique_ptr<DataCodec>>> in_flight;
+    size_t next = 0;
+    auto submit = [&]() {
+        auto futures = GetObjectData(rcm_.get(),
+                                     {remote_files[next++]},
+                                     milvus::PriorityForLoad(priority));
+        in_flight.push_back(std::move(futures[0]));
+    };
+
+    while (next < remote_files.size() && in_flight.size() < parallel_degree) {
+        submit();
+    }
+    for (auto& file : remote_files) {
+        auto index_data = in_flight.front().get();
+        in_flight.pop_front();
+        // keep the window full while the caller consumes this file
+        if (next < remote_files.size()) {
+            submit();
+        }
+        fn(file.substr(file.find_last_of('/') + 1), std::move(index_data));
+    }
+}
+
 std::vector<FieldDataPtr>
 MemFileManagerImpl::CacheRawDataToMemory(const Config& config) {
     auto storage_version =
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <string>
 #include <vector>
@@ -66,6 +67,17 @@ class MemFileManagerImpl : public FileManagerImpl {
     LoadIndexToMemory(const std::vector<std::string>& remote_files,
                       milvus::proto::common::LoadPriority priority);
 
+    // Downloads and decodes remote_files with a bounded number of files in
+    // flight, and calls fn with the name and data of each file in the order
+    // of remote_files as soon as it is ready, so a file can be consumed and
+    // released before the rest are downloaded.
+    void
+    StreamIndexToMemory(
+        const std::vector<std::string>& remote_files,
+        milvus::proto::common::LoadPriority priority,
+        const std::function<void(const std::string&,
+                                 std::unique_ptr<DataCodec>)>& fn);
+
     std::vector<FieldDataPtr>
     CacheRawDataToMemory(const Config& config);
 
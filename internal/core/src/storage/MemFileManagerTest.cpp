@@ -0,0 +1,75 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storage/ChunkManager.h"
+#include "storage/MemFileManagerImpl.h"
+#include "storage/Util.h"
+#include "test_utils/storage_test_utils.h"
+
+using namespace milvus;
+using namespace milvus::storage;
+
+TEST(MemFileManagerTest, StreamIndexToMemory) {
+    auto storage_config = get_default_local_storage_config();
+    auto cm = storage::CreateChunkManager(storage_config);
+    auto fs = storage::InitArrowFileSystem(storage_config);
+    FieldDataMeta field_data_meta = {1, 2, 3, 100};
+    IndexMeta index_meta = {3, 100, 1001, 1, "index"};
+    auto file_manager = std::make_shared<MemFileManagerImpl>(
+        storage::FileManagerContext(field_data_meta, index_meta, cm, fs));
+
+    // more files than are kept in flight
+    const int num_files = 200;
+    BinarySet binary_set;
+    std::vector<std::string> names;
+    for (int i = 0; i < num_files; ++i) {
+        auto size = 100 + i;
+        auto data = std::shared_ptr<uint8_t[]>(new uint8_t[size]);
+        std::memset(data.get(), i % 256, size);
+        names.push_back("binary_" + std::to_string(i));
+        binary_set.Append(names.back(), data, size);
+    }
+    ASSERT_TRUE(file_manager->AddFile(binary_set));
+
+    std::vector<std::string> remote_files;
+    for (auto& [file, size] : file_manager->GetRemotePathsToFileSize()) {
+        remote_files.push_back(file);
+    }
+    ASSERT_EQ(remote_files.size(), num_files);
+
+    size_t index = 0;
+    file_manager->StreamIndexToMemory(
+        remote_files,
+        milvus::proto::common::LoadPriority::HIGH,
+        [&](const std::string& file_name, std::unique_ptr<DataCodec> data) {
+            auto& remote_file = remote_files[index++];
+            ASSERT_EQ(file_name,
+                      remote_file.substr(remote_file.find_last_of('/') + 1));
+            auto binary = binary_set.GetByName(file_name);
+            ASSERT_NE(binary, nullptr);
+            ASSERT_EQ(data->PayloadSize(), binary->size);
+            ASSERT_EQ(std::memcmp(data->PayloadData(),
+                                  binary->data.get(),
+                                  binary->size),
+                      0);
+        });
+    ASSERT_EQ(index, remote_files.size());
+
+    for (auto& file : remote_files) {
+        cm->Remove(file);
+    }
+}
@@ -498,6 +498,15 @@ func SetupCoreConfigChangelCallback() {
 			return nil
 		})
 
+		paramtable.Get().CommonCfg.EnabledAdaptiveConjunctReorder.RegisterCallback(func(ctx context.Context, key, oldValue, newValue string) error {
+			enable, err := strconv.ParseBool(newValue)
+			if err != nil {
+				return err
+			}
+			UpdateDefaultAdaptiveConjunctReorderEnable(enable)
+			return nil
+		})
+
 		paramtable.Get().CommonCfg.EnabledGrowingSegmentJSONKeyStats.RegisterCallback(func(ctx context.Context, key, oldValue, newValue string) error {
 			enable, err := strconv.ParseBool(newValue)
 			if err != nil {
@@ -538,6 +547,51 @@ func SetupCoreConfigChangelCallback() {
 			return nil
 		})
 
+		paramtable.Get().QueryNodeCfg.BruteForceSearchParallelism.RegisterCallback(func(ctx context.Context, key, oldValue, newValue string) error {
+			parallelism, err := strconv.Atoi(newValue)
+			if err != nil {
+				return err
+			}
+			UpdateDefaultBruteForceSearchParallelism(parallelism)
+			return nil
+		})
+
+		paramtable.Get().QueryNodeCfg.BlockedBruteForceMinNq.RegisterCallback(func(ctx context.Context, key, oldValue, newValue string) error {
+			minNq, err := strconv.Atoi(newValue)
+			if err != nil {
+				return err
+			}
+			UpdateDefaultBlockedBruteForceMinNq(minNq)
+			return nil
+		})
+
+		paramtable.Get().QueryNodeCfg.ReduceParallelism.RegisterCallback(func(ctx context.Context, key, oldValue, newValue string) error {
+			parallelism, err := strconv.Atoi(newValue)
+			if err != nil {
+				return err
+			}
+			UpdateDefaultReduceParallelism(parallelism)
+			return nil
+		})
+
+		paramtable.Get().QueryNodeCfg.StringDictionaryMaxCardinality.RegisterCallback(func(ctx context.Context, key, oldValue, newValue string) error {
+			cardinality, err := strconv.Atoi(newValue)
+			if err != nil {
+				return err
+			}
+			UpdateDefaultStringDictionaryMaxCardinality(cardinality)
+			return nil
+		})
+
+		paramtable.Get().QueryNodeCfg.JSONChunkKeyIndexEnabled.RegisterCallback(func(ctx context.Context, key, oldValue, newValue string) error {
+			enable, err := strconv.ParseBool(newValue)
+			if err != nil {
+				return err
+			}
+			UpdateDefaultJSONChunkKeyIndexEnable(enable)
+			return nil
+		})
+
 		paramtable.Get().QueryNodeCfg.ExprResCacheEnabled.RegisterCallback(func(ctx context.Context, key, oldValue, newValue string) error {
 			enable, err := strconv.ParseBool(newValue)
 			if err != nil {
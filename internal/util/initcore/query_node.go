@@ -116,9 +116,27 @@ func doInitQueryNodeOnce(ctx context.Context) error {
 	cDeleteDumpBatchSize := C.int64_t(paramtable.Get().QueryNodeCfg.DeleteDumpBatchSize.GetAsInt64())
 	C.SetDefaultDeleteDumpBatchSize(cDeleteDumpBatchSize)
 
+	cBruteForceSearchParallelism := C.int64_t(paramtable.Get().QueryNodeCfg.BruteForceSearchParallelism.GetAsInt64())
+	C.SetDefaultBruteForceSearchParallelism(cBruteForceSearchParallelism)
+
+	cBlockedBruteForceMinNq := C.int64_t(paramtable.Get().QueryNodeCfg.BlockedBruteForceMinNq.GetAsInt64())
+	C.SetDefaultBlockedBruteForceMinNq(cBlockedBruteForceMinNq)
+
+	cReduceParallelism := C.int64_t(paramtable.Get().QueryNodeCfg.ReduceParallelism.GetAsInt64())
+	C.SetDefaultReduceParallelism(cReduceParallelism)
+
+	cStringDictionaryMaxCardinality := C.int64_t(paramtable.Get().QueryNodeCfg.StringDictionaryMaxCardinality.GetAsInt64())
+	C.SetDefaultStringDictionaryMaxCardinality(cStringDictionaryMaxCardinality)
+
+	cJSONChunkKeyIndexEnabled := C.bool(paramtable.Get().QueryNodeCfg.JSONChunkKeyIndexEnabled.GetAsBool())
+	C.SetDefaultJsonChunkKeyIndexEnable(cJSONChunkKeyIndexEnabled)
+
 	cOptimizeExprEnabled := C.bool(paramtable.Get().CommonCfg.EnabledOptimizeExpr.GetAsBool())
 	C.SetDefaultOptimizeExprEnable(cOptimizeExprEnabled)
 
+	cAdaptiveConjunctReorderEnabled := C.bool(paramtable.Get().CommonCfg.EnabledAdaptiveConjunctReorder.GetAsBool())
+	C.SetDefaultAdaptiveConjunctReorderEnable(cAdaptiveConjunctReorderEnabled)
+
 	cGrowingJSONKeyStatsEnabled := C.bool(paramtable.Get().CommonCfg.EnabledGrowingSegmentJSONKeyStats.GetAsBool())
 	C.SetDefaultGrowingJSONKeyStatsEnable(cGrowingJSONKeyStatsEnabled)
 
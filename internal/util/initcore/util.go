@@ -64,10 +64,34 @@ func UpdateDefaultDeleteDumpBatchSize(size int) {
 	C.SetDefaultDeleteDumpBatchSize(C.int64_t(size))
 }
 
+func UpdateDefaultBruteForceSearchParallelism(parallelism int) {
+	C.SetDefaultBruteForceSearchParallelism(C.int64_t(parallelism))
+}
+
+func UpdateDefaultBlockedBruteForceMinNq(minNq int) {
+	C.SetDefaultBlockedBruteForceMinNq(C.int64_t(minNq))
+}
+
+func UpdateDefaultReduceParallelism(parallelism int) {
+	C.SetDefaultReduceParallelism(C.int64_t(parallelism))
+}
+
+func UpdateDefaultStringDictionaryMaxCardinality(cardinality int) {
+	C.SetDefaultStringDictionaryMaxCardinality(C.int64_t(cardinality))
+}
+
+func UpdateDefaultJSONChunkKeyIndexEnable(enable bool) {
+	C.SetDefaultJsonChunkKeyIndexEnable(C.bool(enable))
+}
+
 func UpdateDefaultOptimizeExprEnable(enable bool) {
 	C.SetDefaultOptimizeExprEnable(C.bool(enable))
 }
 
+func UpdateDefaultAdaptiveConjunctReorderEnable(enable bool) {
+	C.SetDefaultAdaptiveConjunctReorderEnable(C.bool(enable))
+}
+
 func UpdateExprResCacheEnable(enable bool) {
 	C.SetExprResCacheEnable(C.bool(enable))
 }
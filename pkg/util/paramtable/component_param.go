@@ -321,6 +321,7 @@ type commonConfig struct {
 	SyncTaskPoolReleaseTimeoutSeconds ParamItem `refreshable:"true"`
 
 	EnabledOptimizeExpr               ParamItem `refreshable:"true"`
+	EnabledAdaptiveConjunctReorder    ParamItem `refreshable:"true"`
 	EnabledJSONKeyStats               ParamItem `refreshable:"true"`
 	EnabledGrowingSegmentJSONKeyStats ParamItem `refreshable:"true"`
 
@@ -1208,6 +1209,15 @@ This helps Milvus-CDC synchronize incremental data`,
 	}
 	p.EnabledOptimizeExpr.Init(base.mgr)
 
+	p.EnabledAdaptiveConjunctReorder = ParamItem{
+		Key:          "common.enabledAdaptiveConjunctReorder",
+		Version:      "2.6.6",
+		DefaultValue: "false",
+		Doc:          "Indicates whether to reorder AND/OR filter inputs by the selectivity and cost measured at runtime",
+		Export:       true,
+	}
+	p.EnabledAdaptiveConjunctReorder.Init(base.mgr)
+
 	p.UsingJSONStatsForQuery = ParamItem{
 		Key:          "common.usingJSONShreddingForQuery",
 		Version:      "2.6.5",
@@ -3159,6 +3169,17 @@ type queryNodeConfig struct {
 	// delete snapshot dump batch size
 	DeleteDumpBatchSize ParamItem `refreshable:"false"`
 
+	// max chunks of one segment brute-force searched in parallel
+	BruteForceSearchParallelism ParamItem `refreshable:"true"`
+	// min nq of a brute-force search to use the query-blocked kernel
+	BlockedBruteForceMinNq ParamItem `refreshable:"true"`
+	// max tasks merging the nqs of one search reduce in parallel
+	ReduceParallelism ParamItem `refreshable:"true"`
+	// max distinct values of a sealed string chunk to dictionary encode it
+	StringDictionaryMaxCardinality ParamItem `refreshable:"true"`
+	// whether sealed json chunks hold the key index of their rows
+	JSONChunkKeyIndexEnabled ParamItem `refreshable:"true"`
+
 	// expr cache
 	ExprResCacheEnabled       ParamItem `refreshable:"false"`
 	ExprResCacheCapacityBytes ParamItem `refreshable:"false"`
@@ -4221,6 +4242,51 @@ user-task-polling:
 	}
 	p.DeleteDumpBatchSize.Init(base.mgr)
 
+	p.BruteForceSearchParallelism = ParamItem{
+		Key:          "queryNode.segcore.bruteForceSearchParallelism",
+		Version:      "2.6.6",
+		DefaultValue: "1",
+		Doc:          "Max chunks of one segment searched in parallel when brute-force searching it, 1 means sequential.",
+		Export:       true,
+	}
+	p.BruteForceSearchParallelism.Init(base.mgr)
+
+	p.BlockedBruteForceMinNq = ParamItem{
+		Key:          "queryNode.segcore.blockedBruteForceMinNq",
+		Version:      "2.6.6",
+		DefaultValue: "0",
+		Doc:          "Min nq of a brute-force search on float, float16, bfloat16 or int8 vectors to use the query-blocked kernel instead of knowhere, 0 to disable. Its distances may differ from knowhere in the last bits, which can reorder ties in the top-k.",
+		Export:       true,
+	}
+	p.BlockedBruteForceMinNq.Init(base.mgr)
+
+	p.ReduceParallelism = ParamItem{
+		Key:          "queryNode.segcore.reduceParallelism",
+		Version:      "2.6.6",
+		DefaultValue: "1",
+		Doc:          "Max tasks merging the nqs of one search reduce in parallel on the high priority pool, 1 means sequential.",
+		Export:       true,
+	}
+	p.ReduceParallelism.Init(base.mgr)
+
+	p.StringDictionaryMaxCardinality = ParamItem{
+		Key:          "queryNode.segcore.stringDictionaryMaxCardinality",
+		Version:      "2.6.6",
+		DefaultValue: "0",
+		Doc:          "Max distinct values of a sealed varchar chunk to store it as a sorted dictionary plus per-row codes, 0 to disable. Takes effect on chunks loaded afterwards.",
+		Export:       true,
+	}
+	p.StringDictionaryMaxCardinality.Init(base.mgr)
+
+	p.JSONChunkKeyIndexEnabled = ParamItem{
+		Key:          "queryNode.segcore.jsonChunkKeyIndexEnabled",
+		Version:      "2.6.6",
+		DefaultValue: "false",
+		Doc:          "Whether sealed json chunks also store each object in bson with a sorted table of its json pointers, so that json filters look up paths without parsing the json. Uses extra memory. Takes effect on chunks loaded afterwards.",
+		Export:       true,
+	}
+	p.JSONChunkKeyIndexEnabled.Init(base.mgr)
+
 	// expr cache
 	p.ExprResCacheEnabled = ParamItem{
 		Key:          "queryNode.exprCache.enabled",